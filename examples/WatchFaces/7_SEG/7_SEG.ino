@@ -4,6 +4,7 @@
 Watchy7SEG watchy(settings);
 
 void setup(){
+  Watchy::display.setInverted(!DARKMODE); // a change costs one full refresh
   watchy.init();
 }
 
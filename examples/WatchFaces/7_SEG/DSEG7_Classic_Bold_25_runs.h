@@ -0,0 +1,69 @@
+#ifndef DSEG7_Classic_Bold_25_RUNS_H
+#define DSEG7_Classic_Bold_25_RUNS_H
+
+// DSEG7_Classic_Bold_25 subset to "-0-9", glyphs run-length encoded
+// for WatchyDisplay::setFont(const runFont *), generated by
+// extras/host/tools/fontrle. Include it instead of DSEG7_Classic_Bold_25.h.
+
+const uint8_t DSEG7_Classic_Bold_25Runs[] PROGMEM = {
+    0x10, 0x1A, 0x10, 0x0C, 0x10, 0x1A,
+    // '-'
+    0x10, 0x2D, 0x20, 0x1D, 0x11, 0x20, 0x0D, 0x12, 0x27, 0x04, 0x93, 0x20,
+    0x03, 0xB2, 0x00, 0x20, 0x03, 0xB2, 0x27, 0x04, 0x93, 0x20, 0x0D, 0x12,
+    0x20, 0x1D, 0x11, 0x10, 0x2D,
+    // '0'
+    0x10, 0x21, 0x10, 0x12, 0x17, 0x03, 0x10, 0x12, 0x00, 0x10, 0x12, 0x17,
+    0x03, 0x10, 0x12, 0x10, 0x21,
+    // '1'
+    0x10, 0x2D, 0x20, 0x2C, 0x11, 0x20, 0x3A, 0x12, 0x17, 0xD3, 0x20, 0x3A,
+    0x12, 0x10, 0x2C, 0x10, 0x0D, 0x17, 0x04, 0x10, 0x0D, 0x10, 0x1D, 0x10,
+    0x2D,
+    // '2'
+    0x10, 0x0D, 0x20, 0x0C, 0x11, 0x20, 0x1A, 0x12, 0x17, 0xB3, 0x20, 0x1A,
+    0x12, 0x10, 0x0C, 0x20, 0x1A, 0x12, 0x17, 0xB3, 0x20, 0x1A, 0x12, 0x20,
+    0x0C, 0x11, 0x10, 0x0D,
+    // '3'
+    0x20, 0x11, 0xD1, 0x20, 0x03, 0xB2, 0x27, 0x04, 0x93, 0x20, 0x0D, 0x12,
+    0x10, 0x2C, 0x20, 0x3A, 0x12, 0x17, 0xD3, 0x10, 0xE2, 0x10, 0xF1,
+    // '4'
+    0x10, 0x2D, 0x10, 0x1D, 0x10, 0x0D, 0x17, 0x04, 0x10, 0x0D, 0x10, 0x2C,
+    0x20, 0x3A, 0x12, 0x17, 0xD3, 0x20, 0x3A, 0x12, 0x20, 0x2C, 0x11, 0x10,
+    0x2D,
+    // '5'
+    0x10, 0x2D, 0x10, 0x1D, 0x10, 0x0D, 0x17, 0x04, 0x10, 0x0D, 0x10, 0x2C,
+    0x20, 0x0D, 0x12, 0x27, 0x04, 0x93, 0x20, 0x0D, 0x12, 0x20, 0x1D, 0x11,
+    0x10, 0x2D,
+    // '6'
+    0x10, 0x2D, 0x20, 0x1D, 0x11, 0x20, 0x0D, 0x12, 0x27, 0x04, 0x93, 0x20,
+    0x03, 0xB2, 0x00, 0x10, 0xE2, 0x17, 0xD3, 0x10, 0xE2, 0x10, 0xF1,
+    // '7'
+    0x10, 0x2D, 0x20, 0x1D, 0x11, 0x20, 0x0D, 0x12, 0x27, 0x04, 0x93, 0x20,
+    0x0D, 0x12, 0x10, 0x2C, 0x20, 0x0D, 0x12, 0x27, 0x04, 0x93, 0x20, 0x0D,
+    0x12, 0x20, 0x1D, 0x11, 0x10, 0x2D,
+    // '8'
+    0x10, 0x2D, 0x20, 0x1D, 0x11, 0x20, 0x0D, 0x12, 0x27, 0x04, 0x93, 0x20,
+    0x0D, 0x12, 0x10, 0x2C, 0x20, 0x3A, 0x12, 0x17, 0xD3, 0x20, 0x3A, 0x12,
+    0x20, 0x2C, 0x11, 0x10, 0x2D,
+    // '9'
+};
+
+const GFXglyph DSEG7_Classic_Bold_25RunGlyphs[] PROGMEM = {
+    {0, 13, 3, 21, 4, -14}, // '-'
+    {0, 0, 0, 1, -2, -3}, // '.'
+    {0, 0, 0, 10, 1, -17}, // '/'
+    {6, 17, 25, 21, 2, -25}, // '0'
+    {35, 4, 23, 21, 15, -24}, // '1'
+    {52, 17, 25, 21, 2, -25}, // '2'
+    {77, 15, 25, 21, 4, -25}, // '3'
+    {105, 17, 23, 21, 2, -24}, // '4'
+    {128, 17, 25, 21, 2, -25}, // '5'
+    {153, 17, 25, 21, 2, -25}, // '6'
+    {179, 17, 24, 21, 2, -25}, // '7'
+    {202, 17, 25, 21, 2, -25}, // '8'
+    {232, 17, 25, 21, 2, -25}, // '9'
+};
+
+const runFont DSEG7_Classic_Bold_25 PROGMEM = {{(uint8_t *)DSEG7_Classic_Bold_25Runs,
+    (GFXglyph *)DSEG7_Classic_Bold_25RunGlyphs, 0x2D, 0x39, 28}};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef DSEG7_Classic_Regular_39_RUNS_H
+#define DSEG7_Classic_Regular_39_RUNS_H
+
+// DSEG7_Classic_Regular_39 subset to "-0-9", glyphs run-length encoded
+// for WatchyDisplay::setFont(const runFont *), generated by
+// extras/host/tools/fontrle. Include it instead of DSEG7_Classic_Regular_39.h.
+
+const uint8_t DSEG7_Classic_Regular_39Runs[] PROGMEM = {
+    0x20, 0x1F, 0x03, 0x20, 0x0F, 0x05, 0x20, 0x1F, 0x03,
+    // '-'
+    0x21, 0x2F, 0x05, 0x40, 0x02, 0x1F, 0x03, 0x12, 0x40, 0x03, 0x1F, 0x01,
+    0x13, 0x3C, 0x03, 0xF0, 0x24, 0x30, 0x03, 0xF0, 0x33, 0x30, 0x02, 0xF0,
+    0x52, 0x00, 0x30, 0x01, 0xF0, 0x62, 0x30, 0x02, 0xF0, 0x43, 0x3C, 0x03,
+    0xF0, 0x24, 0x40, 0x03, 0x1F, 0x01, 0x13, 0x40, 0x02, 0x1F, 0x03, 0x12,
+    0x21, 0x2F, 0x05,
+    // '0'
+    0x10, 0x22, 0x10, 0x13, 0x1C, 0x04, 0x10, 0x13, 0x10, 0x22, 0x00, 0x10,
+    0x22, 0x10, 0x13, 0x1C, 0x04, 0x10, 0x13, 0x10, 0x22,
+    // '1'
+    0x21, 0x2F, 0x05, 0x30, 0x3F, 0x03, 0x12, 0x30, 0x4F, 0x01, 0x13, 0x2C,
+    0xF0, 0x54, 0x20, 0xF0, 0x63, 0x30, 0x3F, 0x03, 0x12, 0x20, 0x2F, 0x05,
+    0x30, 0x01, 0x2F, 0x03, 0x10, 0x02, 0x1C, 0x03, 0x30, 0x03, 0x1F, 0x01,
+    0x30, 0x02, 0x1F, 0x03, 0x21, 0x2F, 0x05,
+    // '2'
+    0x21, 0x0F, 0x05, 0x30, 0x1F, 0x03, 0x12, 0x30, 0x2F, 0x01, 0x13, 0x2C,
+    0xF0, 0x34, 0x20, 0xF0, 0x43, 0x30, 0x1F, 0x03, 0x12, 0x20, 0x0F, 0x05,
+    0x30, 0x1F, 0x03, 0x12, 0x20, 0xF0, 0x43, 0x2C, 0xF0, 0x34, 0x30, 0x2F,
+    0x01, 0x13, 0x30, 0x1F, 0x03, 0x12, 0x21, 0x0F, 0x05,
+    // '3'
+    0x30, 0x02, 0xF0, 0x52, 0x30, 0x03, 0xF0, 0x33, 0x3C, 0x03, 0xF0, 0x24,
+    0x30, 0x03, 0xF0, 0x33, 0x40, 0x02, 0x1F, 0x03, 0x12, 0x20, 0x2F, 0x05,
+    0x30, 0x3F, 0x03, 0x12, 0x20, 0xF0, 0x63, 0x2C, 0xF0, 0x54, 0x20, 0xF0,
+    0x63, 0x20, 0xF0, 0x72,
+    // '4'
+    0x21, 0x2F, 0x05, 0x30, 0x02, 0x1F, 0x03, 0x30, 0x03, 0x1F, 0x01, 0x1D,
+    0x03, 0x30, 0x02, 0x1F, 0x03, 0x20, 0x2F, 0x05, 0x30, 0x3F, 0x03, 0x12,
+    0x20, 0xF0, 0x63, 0x2C, 0xF0, 0x54, 0x30, 0x4F, 0x01, 0x13, 0x30, 0x3F,
+    0x03, 0x12, 0x21, 0x2F, 0x05,
+    // '5'
+    0x21, 0x2F, 0x05, 0x30, 0x02, 0x1F, 0x03, 0x30, 0x03, 0x1F, 0x01, 0x1D,
+    0x03, 0x30, 0x02, 0x1F, 0x03, 0x20, 0x2F, 0x05, 0x40, 0x01, 0x2F, 0x03,
+    0x12, 0x30, 0x02, 0xF0, 0x43, 0x3C, 0x03, 0xF0, 0x24, 0x40, 0x03, 0x1F,
+    0x01, 0x13, 0x40, 0x02, 0x1F, 0x03, 0x12, 0x21, 0x2F, 0x05,
+    // '6'
+    0x21, 0x2F, 0x05, 0x40, 0x02, 0x1F, 0x03, 0x12, 0x40, 0x03, 0x1F, 0x01,
+    0x13, 0x3C, 0x03, 0xF0, 0x24, 0x30, 0x03, 0xF0, 0x33, 0x30, 0x02, 0xF0,
+    0x52, 0x00, 0x20, 0xF0, 0x72, 0x20, 0xF0, 0x63, 0x2C, 0xF0, 0x54, 0x20,
+    0xF0, 0x63, 0x20, 0xF0, 0x72,
+    // '7'
+    0x21, 0x2F, 0x05, 0x40, 0x02, 0x1F, 0x03, 0x12, 0x40, 0x03, 0x1F, 0x01,
+    0x13, 0x3C, 0x03, 0xF0, 0x24, 0x30, 0x03, 0xF0, 0x33, 0x40, 0x02, 0x1F,
+    0x03, 0x12, 0x20, 0x2F, 0x05, 0x40, 0x01, 0x2F, 0x03, 0x12, 0x30, 0x02,
+    0xF0, 0x43, 0x3C, 0x03, 0xF0, 0x24, 0x40, 0x03, 0x1F, 0x01, 0x13, 0x40,
+    0x02, 0x1F, 0x03, 0x12, 0x21, 0x2F, 0x05,
+    // '8'
+    0x21, 0x2F, 0x05, 0x40, 0x02, 0x1F, 0x03, 0x12, 0x40, 0x03, 0x1F, 0x01,
+    0x13, 0x3C, 0x03, 0xF0, 0x24, 0x30, 0x03, 0xF0, 0x33, 0x40, 0x02, 0x1F,
+    0x03, 0x12, 0x20, 0x2F, 0x05, 0x30, 0x3F, 0x03, 0x12, 0x20, 0xF0, 0x63,
+    0x2C, 0xF0, 0x54, 0x30, 0x4F, 0x01, 0x13, 0x30, 0x3F, 0x03, 0x12, 0x21,
+    0x2F, 0x05,
+    // '9'
+};
+
+const GFXglyph DSEG7_Classic_Regular_39RunGlyphs[] PROGMEM = {
+    {0, 21, 3, 33, 6, -21}, // '-'
+    {0, 0, 0, 1, -2, -5}, // '.'
+    {0, 0, 0, 15, 1, -26}, // '/'
+    {9, 25, 39, 33, 4, -39}, // '0'
+    {60, 5, 35, 33, 24, -37}, // '1'
+    {81, 25, 39, 33, 4, -39}, // '2'
+    {124, 23, 39, 33, 6, -39}, // '3'
+    {169, 25, 35, 33, 4, -37}, // '4'
+    {209, 25, 39, 33, 4, -39}, // '5'
+    {250, 25, 39, 33, 4, -39}, // '6'
+    {296, 25, 37, 33, 4, -39}, // '7'
+    {337, 25, 39, 33, 4, -39}, // '8'
+    {392, 25, 39, 33, 4, -39}, // '9'
+};
+
+const runFont DSEG7_Classic_Regular_39 PROGMEM = {{(uint8_t *)DSEG7_Classic_Regular_39Runs,
+    (GFXglyph *)DSEG7_Classic_Regular_39RunGlyphs, 0x2D, 0x39, 43}};
+
+#endif
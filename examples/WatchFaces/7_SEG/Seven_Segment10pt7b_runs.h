@@ -0,0 +1,191 @@
+#ifndef Seven_Segment10pt7b_RUNS_H
+#define Seven_Segment10pt7b_RUNS_H
+
+// Seven_Segment10pt7b subset to "A-Za-z", glyphs run-length encoded
+// for WatchyDisplay::setFont(const runFont *), generated by
+// extras/host/tools/fontrle. Include it instead of Seven_Segment10pt7b.h.
+
+const uint8_t Seven_Segment10pt7bRuns[] PROGMEM = {
+    0x10, 0x16, 0x25, 0x01, 0x61, 0x10, 0x16, 0x25, 0x01, 0x61,
+    // 'A'
+    0x10, 0x16, 0x24, 0x01, 0x61, 0x10, 0x16, 0x25, 0x01, 0x61, 0x10, 0x16,
+    // 'B'
+    0x10, 0x15, 0x1B, 0x01, 0x10, 0x15,
+    // 'C'
+    0x10, 0x16, 0x2B, 0x01, 0x61, 0x10, 0x16,
+    // 'D'
+    0x10, 0x15, 0x14, 0x01, 0x10, 0x15, 0x15, 0x01, 0x10, 0x15,
+    // 'E'
+    0x10, 0x15, 0x14, 0x01, 0x10, 0x15, 0x16, 0x01,
+    // 'F'
+    0x10, 0x16, 0x14, 0x01, 0x10, 0x25, 0x25, 0x01, 0x61, 0x10, 0x16,
+    // 'G'
+    0x26, 0x01, 0x61, 0x10, 0x16, 0x25, 0x01, 0x61,
+    // 'H'
+    0x1D, 0x01,
+    // 'I'
+    0x16, 0x71, 0x25, 0x01, 0x61, 0x10, 0x16,
+    // 'J'
+    0x20, 0x01, 0x61, 0x20, 0x01, 0x42, 0x20, 0x01, 0x32, 0x20, 0x01, 0x22,
+    0x20, 0x01, 0x12, 0x20, 0x01, 0x11, 0x10, 0x16, 0x26, 0x01, 0x61,
+    // 'K'
+    0x1C, 0x01, 0x10, 0x15,
+    // 'L'
+    0x20, 0x14, 0x14, 0x35, 0x01, 0x41, 0x41, 0x26, 0x01, 0x91,
+    // 'M'
+    0x10, 0x16, 0x2C, 0x01, 0x61,
+    // 'N'
+    0x10, 0x16, 0x2B, 0x01, 0x61, 0x10, 0x16,
+    // 'O'
+    0x10, 0x16, 0x24, 0x01, 0x61, 0x10, 0x16, 0x16, 0x01,
+    // 'P'
+    0x10, 0x16, 0x2A, 0x01, 0x61, 0x20, 0x01, 0x52, 0x10, 0x17,
+    // 'Q'
+    0x10, 0x16, 0x24, 0x01, 0x61, 0x10, 0x16, 0x10, 0x01, 0x20, 0x01, 0x12,
+    0x20, 0x01, 0x22, 0x20, 0x01, 0x32, 0x20, 0x01, 0x42, 0x20, 0x01, 0x51,
+    0x20, 0x01, 0x61,
+    // 'R'
+    0x10, 0x16, 0x14, 0x01, 0x10, 0x16, 0x15, 0x71, 0x10, 0x16,
+    // 'S'
+    0x20, 0x04, 0x14, 0x1C, 0x41,
+    // 'T'
+    0x2C, 0x01, 0x61, 0x10, 0x16,
+    // 'U'
+    0x28, 0x01, 0x61, 0x21, 0x11, 0x41, 0x20, 0x12, 0x22, 0x21, 0x21, 0x21,
+    // 'V'
+    0x26, 0x01, 0x91, 0x35, 0x01, 0x41, 0x41, 0x20, 0x14, 0x14,
+    // 'W'
+    0x20, 0x01, 0x61, 0x20, 0x02, 0x42, 0x20, 0x11, 0x41, 0x20, 0x12, 0x22,
+    0x21, 0x21, 0x21, 0x01, 0x21, 0x21, 0x21, 0x20, 0x12, 0x22, 0x20, 0x11,
+    0x41, 0x20, 0x02, 0x42, 0x20, 0x01, 0x61,
+    // 'X'
+    0x25, 0x01, 0x61, 0x10, 0x16, 0x15, 0x71, 0x10, 0x16,
+    // 'Y'
+    0x10, 0x07, 0x11, 0x61, 0x10, 0x52, 0x10, 0x51, 0x10, 0x42, 0x10, 0x41,
+    0x10, 0x31, 0x10, 0x22, 0x10, 0x21, 0x10, 0x12, 0x11, 0x11, 0x10, 0x17,
+    // 'Z'
+    0x10, 0x16, 0x25, 0x01, 0x61, 0x10, 0x16, 0x25, 0x01, 0x61,
+    // 'a'
+    0x10, 0x16, 0x24, 0x01, 0x61, 0x10, 0x16, 0x25, 0x01, 0x61, 0x10, 0x16,
+    // 'b'
+    0x10, 0x15, 0x1B, 0x01, 0x10, 0x15,
+    // 'c'
+    0x10, 0x16, 0x2B, 0x01, 0x61, 0x10, 0x16,
+    // 'd'
+    0x10, 0x15, 0x14, 0x01, 0x10, 0x15, 0x15, 0x01, 0x10, 0x15,
+    // 'e'
+    0x10, 0x15, 0x14, 0x01, 0x10, 0x15, 0x16, 0x01,
+    // 'f'
+    0x10, 0x16, 0x14, 0x01, 0x10, 0x25, 0x25, 0x01, 0x61, 0x10, 0x16,
+    // 'g'
+    0x26, 0x01, 0x61, 0x10, 0x16, 0x25, 0x01, 0x61,
+    // 'h'
+    0x1D, 0x01,
+    // 'i'
+    0x16, 0x71, 0x25, 0x01, 0x61, 0x10, 0x16,
+    // 'j'
+    0x20, 0x01, 0x61, 0x20, 0x01, 0x42, 0x20, 0x01, 0x32, 0x20, 0x01, 0x22,
+    0x20, 0x01, 0x12, 0x20, 0x01, 0x11, 0x10, 0x16, 0x26, 0x01, 0x61,
+    // 'k'
+    0x1C, 0x01, 0x10, 0x15,
+    // 'l'
+    0x20, 0x14, 0x14, 0x35, 0x01, 0x41, 0x41, 0x26, 0x01, 0x91,
+    // 'm'
+    0x10, 0x16, 0x2C, 0x01, 0x61,
+    // 'n'
+    0x10, 0x16, 0x2B, 0x01, 0x61, 0x10, 0x16,
+    // 'o'
+    0x10, 0x16, 0x24, 0x01, 0x61, 0x10, 0x16, 0x16, 0x01,
+    // 'p'
+    0x10, 0x16, 0x2A, 0x01, 0x61, 0x20, 0x01, 0x52, 0x10, 0x17,
+    // 'q'
+    0x10, 0x16, 0x24, 0x01, 0x61, 0x10, 0x16, 0x10, 0x01, 0x20, 0x01, 0x12,
+    0x20, 0x01, 0x22, 0x20, 0x01, 0x32, 0x20, 0x01, 0x42, 0x20, 0x01, 0x51,
+    0x20, 0x01, 0x61,
+    // 'r'
+    0x10, 0x16, 0x14, 0x01, 0x10, 0x16, 0x15, 0x71, 0x10, 0x16,
+    // 's'
+    0x20, 0x04, 0x14, 0x1C, 0x41,
+    // 't'
+    0x2C, 0x01, 0x61, 0x10, 0x16,
+    // 'u'
+    0x28, 0x01, 0x61, 0x21, 0x11, 0x41, 0x20, 0x12, 0x22, 0x21, 0x21, 0x21,
+    // 'v'
+    0x26, 0x01, 0x91, 0x35, 0x01, 0x41, 0x41, 0x20, 0x14, 0x14,
+    // 'w'
+    0x20, 0x01, 0x61, 0x20, 0x02, 0x42, 0x20, 0x11, 0x41, 0x20, 0x12, 0x22,
+    0x21, 0x21, 0x21, 0x01, 0x21, 0x21, 0x21, 0x20, 0x12, 0x22, 0x20, 0x11,
+    0x41, 0x20, 0x02, 0x42, 0x20, 0x01, 0x61,
+    // 'x'
+    0x25, 0x01, 0x61, 0x10, 0x16, 0x15, 0x71, 0x10, 0x16,
+    // 'y'
+    0x10, 0x07, 0x11, 0x61, 0x10, 0x52, 0x10, 0x51, 0x10, 0x42, 0x10, 0x41,
+    0x10, 0x31, 0x10, 0x22, 0x10, 0x21, 0x10, 0x12, 0x11, 0x11, 0x10, 0x17,
+    // 'z'
+};
+
+const GFXglyph Seven_Segment10pt7bRunGlyphs[] PROGMEM = {
+    {0, 8, 14, 10, 1, -13}, // 'A'
+    {10, 8, 14, 10, 1, -13}, // 'B'
+    {22, 6, 14, 9, 1, -13}, // 'C'
+    {28, 8, 14, 10, 1, -13}, // 'D'
+    {35, 6, 14, 9, 1, -13}, // 'E'
+    {45, 6, 14, 9, 1, -13}, // 'F'
+    {53, 8, 14, 10, 1, -13}, // 'G'
+    {64, 8, 14, 10, 1, -13}, // 'H'
+    {72, 1, 14, 4, 1, -13}, // 'I'
+    {74, 8, 14, 10, 1, -13}, // 'J'
+    {81, 8, 14, 10, 1, -13}, // 'K'
+    {104, 6, 14, 9, 1, -13}, // 'L'
+    {108, 11, 14, 14, 1, -13}, // 'M'
+    {118, 8, 14, 10, 1, -13}, // 'N'
+    {123, 8, 14, 10, 1, -13}, // 'O'
+    {130, 8, 14, 10, 1, -13}, // 'P'
+    {139, 8, 14, 10, 1, -13}, // 'Q'
+    {149, 8, 14, 10, 1, -13}, // 'R'
+    {176, 8, 14, 10, 1, -13}, // 'S'
+    {186, 9, 14, 12, 1, -13}, // 'T'
+    {191, 8, 14, 10, 1, -13}, // 'U'
+    {196, 8, 14, 10, 1, -13}, // 'V'
+    {208, 11, 14, 14, 1, -13}, // 'W'
+    {218, 8, 14, 10, 1, -13}, // 'X'
+    {249, 8, 14, 10, 1, -13}, // 'Y'
+    {258, 8, 14, 10, 1, -13}, // 'Z'
+    {0, 0, 0, 8, 1, -13}, // '['
+    {0, 0, 0, 11, 1, -13}, // '\\'
+    {0, 0, 0, 8, 1, -13}, // ']'
+    {0, 0, 0, 16, 1, -8}, // '^'
+    {0, 0, 0, 12, 1, 0}, // '_'
+    {0, 0, 0, 7, 1, -13}, // '`'
+    {282, 8, 14, 10, 1, -13}, // 'a'
+    {292, 8, 14, 10, 1, -13}, // 'b'
+    {304, 6, 14, 9, 1, -13}, // 'c'
+    {310, 8, 14, 10, 1, -13}, // 'd'
+    {317, 6, 14, 9, 1, -13}, // 'e'
+    {327, 6, 14, 9, 1, -13}, // 'f'
+    {335, 8, 14, 10, 1, -13}, // 'g'
+    {346, 8, 14, 10, 1, -13}, // 'h'
+    {354, 1, 14, 4, 1, -13}, // 'i'
+    {356, 8, 14, 10, 1, -13}, // 'j'
+    {363, 8, 14, 10, 1, -13}, // 'k'
+    {386, 6, 14, 9, 1, -13}, // 'l'
+    {390, 11, 14, 14, 1, -13}, // 'm'
+    {400, 8, 14, 10, 1, -13}, // 'n'
+    {405, 8, 14, 10, 1, -13}, // 'o'
+    {412, 8, 14, 10, 1, -13}, // 'p'
+    {421, 8, 14, 10, 1, -13}, // 'q'
+    {431, 8, 14, 10, 1, -13}, // 'r'
+    {458, 8, 14, 10, 1, -13}, // 's'
+    {468, 9, 14, 12, 1, -13}, // 't'
+    {473, 8, 14, 10, 1, -13}, // 'u'
+    {478, 8, 14, 10, 1, -13}, // 'v'
+    {490, 11, 14, 14, 1, -13}, // 'w'
+    {500, 8, 14, 10, 1, -13}, // 'x'
+    {531, 8, 14, 10, 1, -13}, // 'y'
+    {540, 8, 14, 10, 1, -13}, // 'z'
+};
+
+const runFont Seven_Segment10pt7b PROGMEM = {{(uint8_t *)Seven_Segment10pt7bRuns,
+    (GFXglyph *)Seven_Segment10pt7bRunGlyphs, 0x41, 0x7A, 20}};
+
+#endif
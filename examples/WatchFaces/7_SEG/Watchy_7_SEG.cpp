@@ -1,29 +1,40 @@
 #include "Watchy_7_SEG.h"
 
-#define DARKMODE true
-
 const uint8_t BATTERY_SEGMENT_WIDTH = 7;
 const uint8_t BATTERY_SEGMENT_HEIGHT = 11;
 const uint8_t BATTERY_SEGMENT_SPACING = 9;
 const uint8_t WEATHER_ICON_WIDTH = 48;
 const uint8_t WEATHER_ICON_HEIGHT = 32;
 
+// the background, the date and the icons that stay put
+bool Watchy7SEG::drawStaticLayer(){
+    display.fillScreen(GxEPD_BLACK);
+    display.setTextColor(GxEPD_WHITE);
+    drawDate();
+    display.drawBitmap(10, 165, steps, 19, 23, GxEPD_WHITE);
+    display.drawBitmap(154, 73, battery, 37, 21, GxEPD_WHITE);
+    display.fillRect(159, 78, 27, BATTERY_SEGMENT_HEIGHT, GxEPD_BLACK);//clear battery segments
+    return true;
+}
+
+uint32_t Watchy7SEG::staticLayerKey(){
+    return (uint32_t)currentTime.Year << 16 | currentTime.Month << 8 | currentTime.Day;
+}
+
 void Watchy7SEG::drawWatchFace(){
-    display.fillScreen(DARKMODE ? GxEPD_BLACK : GxEPD_WHITE);
-    display.setTextColor(DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+    display.setTextColor(GxEPD_WHITE);
     drawTime();
-    drawDate();
     drawSteps();
     drawWeather();
     drawBattery();
-    display.drawBitmap(120, 77, WIFI_CONFIGURED ? wifi : wifioff, 26, 18, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+    display.drawBitmap(120, 77, WIFI_CONFIGURED ? wifi : wifioff, 26, 18, GxEPD_WHITE);
     if(BLE_CONFIGURED){
-        display.drawBitmap(100, 75, bluetooth, 13, 21, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+        display.drawBitmap(100, 75, bluetooth, 13, 21, GxEPD_WHITE);
     }
 }
 
 void Watchy7SEG::drawTime(){
-    display.setFont(&DSEG7_Classic_Bold_53);
+    display.setFont(&DSEG7_Classic_Bold_53_digits);
     display.setCursor(5, 53+5);
     int displayHour;
     if(HOUR_12_24==12){
@@ -45,21 +56,9 @@ void Watchy7SEG::drawTime(){
 void Watchy7SEG::drawDate(){
     display.setFont(&Seven_Segment10pt7b);
 
-    int16_t  x1, y1;
-    uint16_t w, h;
-
-    String dayOfWeek = dayStr(currentTime.Wday);
-    display.getTextBounds(dayOfWeek, 5, 85, &x1, &y1, &w, &h);
-    if(currentTime.Wday == 4){
-        w = w - 5;
-    }
-    display.setCursor(85 - w, 85);
-    display.println(dayOfWeek);
-
-    String month = monthShortStr(currentTime.Month);
-    display.getTextBounds(month, 60, 110, &x1, &y1, &w, &h);
-    display.setCursor(85 - w, 110);
-    display.println(month);
+    // right aligned, Wednesday is too long and sticks out 5 pixels
+    display.drawText(currentTime.Wday == 4 ? 90 : 85, 85, dayStr(currentTime.Wday), WatchyDisplay::ALIGN_RIGHT);
+    display.drawText(85, 110, monthShortStr(currentTime.Month), WatchyDisplay::ALIGN_RIGHT);
 
     display.setFont(&DSEG7_Classic_Bold_25);
     display.setCursor(5, 120);
@@ -71,18 +70,13 @@ void Watchy7SEG::drawDate(){
     display.println(tmYearToCalendar(currentTime.Year));// offset from 1970, since year is stored in uint8_t
 }
 void Watchy7SEG::drawSteps(){
-    // reset step counter at midnight
-    if (currentTime.Hour == 0 && currentTime.Minute == 0){
-      sensor.resetStepCounter();
-    }
+    // the step counter is reset at midnight by Watchy's JOB_STEP_RESET
     uint32_t stepCount = sensor.getCounter();
-    display.drawBitmap(10, 165, steps, 19, 23, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+    display.setFont(&DSEG7_Classic_Bold_25); // the date's, once drawn after it
     display.setCursor(35, 190);
     display.println(stepCount);
 }
 void Watchy7SEG::drawBattery(){
-    display.drawBitmap(154, 73, battery, 37, 21, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
-    display.fillRect(159, 78, 27, BATTERY_SEGMENT_HEIGHT, DARKMODE ? GxEPD_BLACK : GxEPD_WHITE);//clear battery segments
     int8_t batteryLevel = 0;
     float VBAT = getBatteryVoltage();
     if(VBAT > 4.1){
@@ -99,7 +93,7 @@ void Watchy7SEG::drawBattery(){
     }
 
     for(int8_t batterySegments = 0; batterySegments < batteryLevel; batterySegments++){
-        display.fillRect(159 + (batterySegments * BATTERY_SEGMENT_SPACING), 78, BATTERY_SEGMENT_WIDTH, BATTERY_SEGMENT_HEIGHT, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+        display.fillRect(159 + (batterySegments * BATTERY_SEGMENT_SPACING), 78, BATTERY_SEGMENT_WIDTH, BATTERY_SEGMENT_HEIGHT, GxEPD_WHITE);
     }
 }
 
@@ -110,19 +104,19 @@ void Watchy7SEG::drawWeather(){
     int8_t temperature = currentWeather.temperature;
     int16_t weatherConditionCode = currentWeather.weatherConditionCode;
 
+    // the ink ends at x = 159, in the smaller font if it would reach x = 87
+    char degrees[5];
+    snprintf(degrees, sizeof(degrees), "%d", temperature);
     display.setFont(&DSEG7_Classic_Regular_39);
-    int16_t  x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(String(temperature), 0, 0, &x1, &y1, &w, &h);
-    if(159 - w - x1 > 87){
-        display.setCursor(159 - w - x1, 150);
+    textBounds bounds = display.measureText(degrees);
+    if(159 - bounds.w - bounds.x > 87){
+        display.drawText(159 - bounds.w - bounds.x, 150, degrees);
     }else{
         display.setFont(&DSEG7_Classic_Bold_25);
-        display.getTextBounds(String(temperature), 0, 0, &x1, &y1, &w, &h);
-        display.setCursor(159 - w - x1, 136);
+        bounds = display.measureText(degrees);
+        display.drawText(159 - bounds.w - bounds.x, 136, degrees);
     }
-    display.println(temperature);
-    display.drawBitmap(165, 110, currentWeather.isMetric ? celsius : fahrenheit, 26, 20, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+    display.drawBitmap(165, 110, currentWeather.isMetric ? celsius : fahrenheit, 26, 20, GxEPD_WHITE);
     const unsigned char* weatherIcon;
 
     //https://openweathermap.org/weather-conditions
@@ -144,5 +138,5 @@ void Watchy7SEG::drawWeather(){
     weatherIcon = thunderstorm;
     }else
     return;
-    display.drawBitmap(145, 158, weatherIcon, WEATHER_ICON_WIDTH, WEATHER_ICON_HEIGHT, DARKMODE ? GxEPD_WHITE : GxEPD_BLACK);
+    display.drawBitmap(145, 158, weatherIcon, WEATHER_ICON_WIDTH, WEATHER_ICON_HEIGHT, GxEPD_WHITE);
 }
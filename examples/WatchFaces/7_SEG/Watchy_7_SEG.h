@@ -2,16 +2,18 @@
 #define WATCHY_7_SEG_H
 
 #include <Watchy.h>
-#include "Seven_Segment10pt7b.h"
+#include "Seven_Segment10pt7b_runs.h"
 #include "DSEG7_Classic_Regular_15.h"
-#include "DSEG7_Classic_Bold_25.h"
-#include "DSEG7_Classic_Regular_39.h"
+#include "DSEG7_Classic_Bold_25_runs.h"
+#include "DSEG7_Classic_Regular_39_runs.h"
 #include "icons.h"
 
 class Watchy7SEG : public Watchy{
     using Watchy::Watchy;
     public:
         void drawWatchFace();
+        bool drawStaticLayer();
+        uint32_t staticLayerKey();
         void drawTime();
         void drawDate();
         void drawSteps();
@@ -12,6 +12,8 @@
 #define NTP_SERVER "pool.ntp.org"
 #define GMT_OFFSET_SEC 3600 * -5 //New York is UTC -5
 #define DST_OFFSET_SEC 3600
+//Display Settings
+#define DARKMODE true //false: light mode, the display inverts the face and the menus
 
 watchySettings settings{
     CITY_ID,
@@ -0,0 +1,10 @@
+#include "Watchy_Analog.h"
+#include "settings.h"
+
+WatchyAnalog watchy(settings);
+
+void setup(){
+  watchy.init();
+}
+
+void loop(){}
@@ -0,0 +1,71 @@
+#include "Watchy_Analog.h"
+
+const int16_t CENTER_X = 100;
+const int16_t CENTER_Y = 100;
+const int16_t DIAL_R = 97;
+
+// the dial and the date, the hands are drawn over them every minute
+bool WatchyAnalog::drawStaticLayer(){
+    display.fillScreen(GxEPD_BLACK);
+    drawDial();
+    drawDate();
+    return true;
+}
+
+uint32_t WatchyAnalog::staticLayerKey(){
+    return (uint32_t)currentTime.Year << 16 | currentTime.Month << 8 | currentTime.Day;
+}
+
+void WatchyAnalog::drawWatchFace(){
+    // two sprite blits, no trigonometry
+    uint16_t hourPosition = (currentTime.Hour % 12) * 60 + currentTime.Minute;
+    display.drawHand(CENTER_X, CENTER_Y, &hourHand, hourPosition, GxEPD_WHITE);
+    display.drawHand(CENTER_X, CENTER_Y, &minuteHand, currentTime.Minute, GxEPD_WHITE);
+    display.fillCircle(CENTER_X, CENTER_Y, 6, GxEPD_WHITE);
+    display.fillCircle(CENTER_X, CENTER_Y, 2, GxEPD_BLACK);
+}
+
+// Q16 to the nearest integer
+static int16_t roundFixed(int32_t v){
+    return fixedToInt(v >= 0 ? v + FIXED_ONE / 2 : v - FIXED_ONE / 2);
+}
+
+// A point r from the center at angle, moved by `halves` half pixels at a
+// right angle, clockwise
+static void dialPoint(int16_t angle, int16_t r, int8_t halves, int16_t &x, int16_t &y){
+    int32_t s = fixedSin(angle);
+    int32_t c = fixedCos(angle);
+    x = CENTER_X + roundFixed(r * s + halves * c / 2);
+    y = CENTER_Y + roundFixed(-r * c + halves * s / 2);
+}
+
+// a tick per minute, three pixels wide on the hours
+void WatchyAnalog::drawDial(){
+    for(int16_t minute = 0; minute < 60; minute++){
+        int16_t angle = minute * (ANGLE_STEPS / 60);
+        int16_t x0, y0, x1, y1;
+        if(minute % 5 != 0){
+            dialPoint(angle, DIAL_R - 4, 0, x0, y0);
+            dialPoint(angle, DIAL_R, 0, x1, y1);
+            display.drawLine(x0, y0, x1, y1, GxEPD_WHITE);
+            continue;
+        }
+        int16_t x2, y2, x3, y3;
+        dialPoint(angle, DIAL_R - 12, -3, x0, y0);
+        dialPoint(angle, DIAL_R, -3, x1, y1);
+        dialPoint(angle, DIAL_R, 3, x2, y2);
+        dialPoint(angle, DIAL_R - 12, 3, x3, y3);
+        display.fillTriangle(x0, y0, x1, y1, x2, y2, GxEPD_WHITE);
+        display.fillTriangle(x0, y0, x2, y2, x3, y3, GxEPD_WHITE);
+    }
+}
+
+// the day of the month in a window at 3 o'clock
+void WatchyAnalog::drawDate(){
+    char day[4];
+    snprintf(day, sizeof(day), "%d", currentTime.Day);
+    display.drawRect(136, 89, 32, 22, GxEPD_WHITE);
+    display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(GxEPD_WHITE);
+    display.drawText(152, 105, day, WatchyDisplay::ALIGN_CENTER);
+}
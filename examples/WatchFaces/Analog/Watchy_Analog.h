@@ -0,0 +1,17 @@
+#ifndef WATCHY_ANALOG_H
+#define WATCHY_ANALOG_H
+
+#include <Watchy.h>
+#include "hands.h"
+
+class WatchyAnalog : public Watchy{
+    using Watchy::Watchy;
+    public:
+        void drawWatchFace();
+        bool drawStaticLayer();
+        uint32_t staticLayerKey();
+        void drawDial();
+        void drawDate();
+};
+
+#endif
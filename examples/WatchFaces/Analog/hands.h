@@ -0,0 +1,1690 @@
+#ifndef HANDS_H
+#define HANDS_H
+
+// The Analog face's hands for WatchyDisplay::drawHand(), the hour hand at
+// each minute of its turn. Regenerate with extras/host/build/handsprites.
+
+// hourHand: 720 positions a turn, 181 sprites for the first quarter in 17030 bytes.
+// Generated by extras/host/tools/handsprites from 0,14 -5,0 0,-56 5,0
+const uint8_t hourHandSpans[] PROGMEM = {
+    0xC8, 0x47, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03,
+    0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFB, 0x0B, 0xFC, 0x09, 0xFC, 0x09,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04,
+    0xFF, 0x04, 0xFF, 0x04, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x02, 0x00, 0x01, 0x00, 0x01,
+    0xC9, 0x45, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04,
+    0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x04, 0xFE, 0x05, 0xFE, 0x06,
+    0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06,
+    0xFE, 0x06, 0xFE, 0x06, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x02, 0x00, 0x01, 0x00, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xFF, 0x04, 0xFF, 0x04,
+    0xFF, 0x04, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
+    0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06,
+    0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFF, 0x03, 0xFF, 0x02, 0xFF, 0x02, 0x00, 0x01,
+    0xC9, 0x45, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+    0x02, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
+    0xFF, 0x05, 0xFF, 0x05, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x06,
+    0xFE, 0x06, 0xFE, 0x06, 0xFE, 0x07, 0xFE, 0x07, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x06, 0xFE, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFF, 0x03, 0xFF, 0x02, 0xFF, 0x02, 0x00, 0x00,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x01,
+    0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02,
+    0x01, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03,
+    0x01, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05,
+    0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFF, 0x05, 0xFE, 0x06, 0xFE, 0x07,
+    0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x06, 0xFE, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFF, 0x03, 0xFF, 0x02, 0xFF, 0x02, 0x00, 0x00,
+    0xC9, 0x45, 0x00, 0x00, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01,
+    0x03, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03,
+    0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0xFF, 0x05, 0xFF, 0x05,
+    0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFE, 0x07,
+    0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07,
+    0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x06, 0xFE, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFF, 0x02, 0xFF, 0x02, 0xFF, 0x02, 0xFF, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01,
+    0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x03,
+    0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x04, 0x01, 0x04, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
+    0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06,
+    0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07,
+    0xFE, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFE, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFE, 0x03, 0xFF, 0x02, 0xFF, 0x01, 0xFF, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+    0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+    0x02, 0x03, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04,
+    0x01, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x05, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06,
+    0xFF, 0x06, 0xFF, 0x06, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07,
+    0xFE, 0x07, 0xFE, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFE, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFE, 0x03, 0xFF, 0x02, 0xFF, 0x01, 0xFF, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01,
+    0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+    0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03,
+    0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04,
+    0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06,
+    0xFF, 0x06, 0xFF, 0x06, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07,
+    0xFE, 0x07, 0xFE, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFE, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFE, 0x03, 0xFF, 0x02, 0xFF, 0x01, 0xFF, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02,
+    0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x01, 0x04, 0x01, 0x04,
+    0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x00, 0x05, 0x00, 0x05,
+    0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0xFF, 0x06, 0xFF, 0x06,
+    0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07,
+    0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFE, 0x04, 0xFE, 0x04,
+    0xFE, 0x03, 0xFF, 0x02, 0xFF, 0x01, 0xFF, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01,
+    0x05, 0x01, 0x05, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+    0x04, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04,
+    0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFE, 0x08, 0xFE, 0x08,
+    0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFE, 0x04, 0xFE, 0x03,
+    0xFE, 0x03, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01,
+    0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x04, 0x02, 0x04, 0x02,
+    0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04,
+    0x02, 0x04, 0x02, 0x04, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+    0x01, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFE, 0x08,
+    0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFD, 0x09, 0xFD, 0x09,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFE, 0x04, 0xFE, 0x03,
+    0xFE, 0x03, 0xFE, 0x02, 0xFF, 0x01, 0x00, 0x00,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01,
+    0x06, 0x01, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x02, 0x04,
+    0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+    0x01, 0x05, 0x01, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFE, 0x08,
+    0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFD, 0x09, 0xFD, 0x09,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFE, 0x04, 0xFE, 0x03,
+    0xFE, 0x03, 0xFE, 0x02, 0xFE, 0x02, 0x00, 0x00,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01,
+    0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+    0x05, 0x02, 0x05, 0x02, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x05,
+    0x02, 0x05, 0x02, 0x05, 0x02, 0x04, 0x02, 0x04, 0x01, 0x05, 0x01, 0x05,
+    0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFD, 0x09,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x05, 0xFE, 0x03,
+    0xFE, 0x03, 0xFE, 0x02, 0xFE, 0x02, 0x00, 0x00,
+    0xC9, 0x45, 0x00, 0x00, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01,
+    0x07, 0x01, 0x06, 0x02, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x05, 0x02,
+    0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x04, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+    0x03, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x01, 0x06,
+    0x01, 0x06, 0x01, 0x06, 0x01, 0x05, 0x01, 0x05, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFD, 0x09,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x05, 0xFE, 0x03,
+    0xFE, 0x03, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x07, 0x01,
+    0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02,
+    0x06, 0x02, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x04,
+    0x03, 0x04, 0x03, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05,
+    0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x00, 0x07,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFD, 0x09,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x05, 0xFE, 0x03,
+    0xFE, 0x03, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01,
+    0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x06, 0x02,
+    0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+    0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04,
+    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05,
+    0x02, 0x05, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07,
+    0xFF, 0x07, 0xFF, 0x07, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFC, 0x08, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x05, 0xFD, 0x04,
+    0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x08, 0x01,
+    0x08, 0x01, 0x08, 0x01, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02,
+    0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x05, 0x03, 0x05, 0x03,
+    0x05, 0x03, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x04, 0x02, 0x05, 0x02, 0x05,
+    0x02, 0x05, 0x02, 0x05, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xFF, 0x08, 0xFF, 0x08,
+    0xFF, 0x07, 0xFF, 0x07, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFC, 0x08, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x04,
+    0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x09, 0x01, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x07, 0x02, 0x07, 0x02,
+    0x07, 0x02, 0x07, 0x02, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02,
+    0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x02, 0x06,
+    0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06,
+    0x01, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xFF, 0x08,
+    0xFF, 0x08, 0xFF, 0x07, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFC, 0x08, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x04,
+    0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x09, 0x01,
+    0x09, 0x01, 0x09, 0x01, 0x08, 0x02, 0x08, 0x02, 0x08, 0x01, 0x07, 0x02,
+    0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x05, 0x04, 0x05, 0x04, 0x05, 0x03, 0x05, 0x03, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05,
+    0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x05, 0x01, 0x06, 0x01, 0x06,
+    0x01, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xFF, 0x08,
+    0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x08,
+    0xFE, 0x08, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFC, 0x08, 0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x04,
+    0xFD, 0x03, 0xFE, 0x02, 0xFE, 0x01, 0xFE, 0x01,
+    0xC9, 0x45, 0x00, 0x00, 0x0A, 0x01, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02,
+    0x08, 0x02, 0x07, 0x03, 0x07, 0x02, 0x07, 0x02, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04,
+    0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05,
+    0x03, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x01, 0x07, 0x01, 0x06,
+    0x01, 0x06, 0x01, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x08, 0xFE, 0x08,
+    0xFE, 0x08, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08,
+    0xFC, 0x08, 0xFD, 0x06, 0xFD, 0x05, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x04,
+    0xFD, 0x03, 0xFE, 0x02, 0xFE, 0x01, 0x00, 0x00,
+    0xCA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x01,
+    0x09, 0x02, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x08, 0x02, 0x08, 0x02,
+    0x08, 0x02, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04,
+    0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05,
+    0x03, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x01, 0x07, 0x01, 0x07,
+    0x01, 0x06, 0x01, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xFF, 0x08,
+    0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09, 0xFE, 0x08, 0xFE, 0x08,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x08,
+    0xFC, 0x07, 0xFD, 0x05, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x04, 0xFD, 0x03,
+    0xFD, 0x02, 0xFE, 0x01, 0x00, 0x00,
+    0xCA, 0x44, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01,
+    0x0A, 0x01, 0x0A, 0x01, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x08, 0x02,
+    0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x03, 0x07, 0x03, 0x07, 0x03,
+    0x06, 0x04, 0x06, 0x04, 0x06, 0x03, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04,
+    0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x03, 0x06, 0x03, 0x05,
+    0x03, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x01, 0x07,
+    0x01, 0x07, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xFF, 0x08,
+    0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09, 0xFE, 0x08,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x08,
+    0xFC, 0x07, 0xFD, 0x05, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x04, 0xFD, 0x03,
+    0xFD, 0x02, 0xFD, 0x02, 0x00, 0x00,
+    0xCA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x0B, 0x01, 0x0B, 0x01,
+    0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+    0x09, 0x02, 0x08, 0x03, 0x08, 0x02, 0x08, 0x02, 0x07, 0x03, 0x07, 0x03,
+    0x07, 0x03, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x05, 0x05, 0x05, 0x04,
+    0x05, 0x04, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x03, 0x06,
+    0x03, 0x06, 0x03, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x01, 0x07,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+    0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09, 0xFE, 0x08,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x08,
+    0xFC, 0x07, 0xFD, 0x05, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x03, 0xFD, 0x03,
+    0xFD, 0x02, 0xFD, 0x02, 0xFD, 0x01,
+    0xCA, 0x44, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x0B, 0x01,
+    0x0B, 0x01, 0x0B, 0x01, 0x0A, 0x02, 0x0A, 0x01, 0x0A, 0x01, 0x09, 0x02,
+    0x09, 0x02, 0x09, 0x02, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x07, 0x03,
+    0x07, 0x03, 0x07, 0x03, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05,
+    0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07,
+    0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09, 0xFE, 0x09,
+    0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x08,
+    0xFC, 0x07, 0xFD, 0x05, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x03, 0xFD, 0x03,
+    0xFD, 0x02, 0xFD, 0x02, 0xFD, 0x01,
+    0xCA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x0C, 0x01, 0x00, 0x00,
+    0x0B, 0x01, 0x0B, 0x01, 0x0B, 0x01, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02,
+    0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03,
+    0x07, 0x04, 0x07, 0x04, 0x07, 0x03, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05,
+    0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x07, 0x02, 0x06, 0x02, 0x06,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x07,
+    0x00, 0x07, 0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x08, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x08,
+    0xFC, 0x07, 0xFC, 0x06, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x03, 0xFD, 0x03,
+    0xFD, 0x02, 0xFD, 0x01, 0xFD, 0x01,
+    0xCA, 0x44, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x0C, 0x01,
+    0x0C, 0x01, 0x0B, 0x02, 0x0B, 0x01, 0x0B, 0x01, 0x0A, 0x02, 0x0A, 0x02,
+    0x0A, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x02, 0x08, 0x03, 0x08, 0x03,
+    0x08, 0x03, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x06, 0x04, 0x06, 0x04,
+    0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x04, 0x05,
+    0x04, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x07, 0x02, 0x06,
+    0x02, 0x06, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x07, 0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x08,
+    0xFC, 0x07, 0xFC, 0x06, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x03, 0xFD, 0x03,
+    0xFD, 0x02, 0xFD, 0x01, 0xFD, 0x01,
+    0xCA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x01, 0x0D, 0x01, 0x00, 0x00,
+    0x0C, 0x01, 0x0C, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x0B, 0x02, 0x0A, 0x02,
+    0x0A, 0x02, 0x0A, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x08, 0x03,
+    0x08, 0x03, 0x08, 0x03, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x06, 0x05,
+    0x06, 0x04, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06,
+    0x04, 0x05, 0x04, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x07,
+    0x02, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07,
+    0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x05, 0xFD, 0x04, 0xFD, 0x03, 0xFD, 0x02,
+    0xFD, 0x02, 0xFD, 0x01, 0xFD, 0x01,
+    0xCA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x01, 0x0D, 0x01,
+    0x0D, 0x01, 0x0C, 0x01, 0x0C, 0x01, 0x0C, 0x01, 0x0B, 0x02, 0x0B, 0x02,
+    0x0B, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03,
+    0x08, 0x04, 0x08, 0x04, 0x08, 0x03, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04,
+    0x06, 0x05, 0x06, 0x05, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x06,
+    0x04, 0x06, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x07,
+    0x02, 0x07, 0x02, 0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08,
+    0x00, 0x08, 0xFF, 0x09, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07,
+    0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x05, 0xFD, 0x03, 0xFD, 0x02,
+    0xFD, 0x02, 0xFD, 0x01, 0x00, 0x00,
+    0xCA, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x0D, 0x01,
+    0x0D, 0x01, 0x0D, 0x01, 0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x01, 0x0B, 0x02,
+    0x0B, 0x02, 0x0B, 0x02, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x03, 0x09, 0x03,
+    0x09, 0x03, 0x08, 0x04, 0x08, 0x04, 0x08, 0x03, 0x07, 0x04, 0x07, 0x04,
+    0x07, 0x04, 0x06, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06,
+    0x02, 0x07, 0x02, 0x07, 0x01, 0x08, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07,
+    0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x05, 0xFD, 0x03, 0xFD, 0x02,
+    0xFD, 0x02, 0xFD, 0x01, 0x00, 0x00,
+    0xCB, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x01, 0x0E, 0x01, 0x0E, 0x01,
+    0x0D, 0x01, 0x0D, 0x01, 0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x0B, 0x02,
+    0x0B, 0x02, 0x0B, 0x02, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x04, 0x09, 0x03,
+    0x09, 0x03, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x07, 0x04, 0x07, 0x04,
+    0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x05,
+    0x04, 0x06, 0x04, 0x06, 0x03, 0x07, 0x03, 0x06, 0x03, 0x06, 0x02, 0x07,
+    0x02, 0x07, 0x02, 0x07, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0xFF, 0x09, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07,
+    0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x05, 0xFC, 0x04, 0xFD, 0x02, 0xFD, 0x02,
+    0xFD, 0x01, 0x00, 0x00,
+    0xCB, 0x43, 0x00, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x0E, 0x01, 0x0E, 0x01,
+    0x0E, 0x01, 0x0D, 0x02, 0x0D, 0x01, 0x0D, 0x01, 0x0C, 0x02, 0x0C, 0x02,
+    0x0B, 0x03, 0x0B, 0x02, 0x0B, 0x02, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x04,
+    0x09, 0x04, 0x09, 0x03, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x07, 0x05,
+    0x07, 0x04, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x05,
+    0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x03, 0x07, 0x03, 0x06, 0x02, 0x07,
+    0x02, 0x07, 0x02, 0x07, 0x01, 0x08, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08,
+    0x00, 0x08, 0xFF, 0x09, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07,
+    0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02,
+    0xFD, 0x01, 0x00, 0x00,
+    0xCB, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x0F, 0x01, 0x00, 0x00,
+    0x0E, 0x01, 0x0E, 0x01, 0x0D, 0x02, 0x0D, 0x02, 0x0D, 0x01, 0x0C, 0x02,
+    0x0C, 0x02, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x02, 0x0A, 0x03, 0x0A, 0x03,
+    0x09, 0x04, 0x09, 0x04, 0x09, 0x03, 0x08, 0x04, 0x08, 0x04, 0x07, 0x05,
+    0x07, 0x05, 0x07, 0x04, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06,
+    0x05, 0x05, 0x04, 0x06, 0x04, 0x06, 0x03, 0x07, 0x03, 0x07, 0x03, 0x06,
+    0x02, 0x07, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08, 0x01, 0x07, 0x00, 0x08,
+    0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07,
+    0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00,
+    0xCB, 0x43, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0x01, 0x0F, 0x01,
+    0x0F, 0x01, 0x0E, 0x01, 0x0E, 0x01, 0x0D, 0x02, 0x0D, 0x02, 0x0D, 0x02,
+    0x0C, 0x02, 0x0C, 0x02, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0A, 0x03,
+    0x0A, 0x03, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04, 0x08, 0x04, 0x08, 0x04,
+    0x07, 0x05, 0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06,
+    0x05, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x03, 0x07, 0x03, 0x07,
+    0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x08, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07,
+    0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02,
+    0xFC, 0x01, 0xFC, 0x01,
+    0xCB, 0x43, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x10, 0x01, 0x00, 0x00,
+    0x0F, 0x01, 0x0F, 0x01, 0x0E, 0x02, 0x0E, 0x01, 0x0D, 0x02, 0x0D, 0x02,
+    0x0D, 0x02, 0x0C, 0x03, 0x0C, 0x02, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03,
+    0x0A, 0x04, 0x0A, 0x03, 0x09, 0x04, 0x09, 0x04, 0x08, 0x05, 0x08, 0x04,
+    0x08, 0x04, 0x07, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05,
+    0x05, 0x06, 0x05, 0x06, 0x04, 0x06, 0x04, 0x06, 0x03, 0x07, 0x03, 0x07,
+    0x03, 0x07, 0x02, 0x07, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08, 0x01, 0x07,
+    0x00, 0x08, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07,
+    0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02,
+    0xFC, 0x01, 0xFC, 0x01,
+    0xCB, 0x43, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x10, 0x01, 0x10, 0x01,
+    0x10, 0x01, 0x0F, 0x01, 0x0F, 0x01, 0x0E, 0x02, 0x0E, 0x02, 0x0D, 0x02,
+    0x0D, 0x02, 0x0D, 0x02, 0x0C, 0x03, 0x0C, 0x03, 0x0B, 0x03, 0x0B, 0x03,
+    0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x03, 0x09, 0x04, 0x09, 0x04, 0x08, 0x05,
+    0x08, 0x04, 0x07, 0x05, 0x07, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x05,
+    0x05, 0x06, 0x05, 0x06, 0x04, 0x07, 0x04, 0x06, 0x04, 0x06, 0x03, 0x07,
+    0x03, 0x07, 0x02, 0x08, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07,
+    0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02,
+    0xFC, 0x01, 0x00, 0x00,
+    0xCB, 0x43, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x01, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x01, 0x0F, 0x02, 0x0F, 0x01, 0x0E, 0x02, 0x0E, 0x02,
+    0x0D, 0x03, 0x0D, 0x02, 0x0D, 0x02, 0x0C, 0x03, 0x0C, 0x03, 0x0B, 0x03,
+    0x0B, 0x03, 0x0A, 0x04, 0x0A, 0x04, 0x09, 0x04, 0x09, 0x04, 0x09, 0x04,
+    0x08, 0x05, 0x08, 0x05, 0x07, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x05, 0x05, 0x06, 0x05, 0x06, 0x04, 0x07, 0x04, 0x06, 0x03, 0x07,
+    0x03, 0x07, 0x02, 0x08, 0x02, 0x07, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07,
+    0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02,
+    0xFC, 0x01, 0x00, 0x00,
+    0xCC, 0x42, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01,
+    0x10, 0x01, 0x10, 0x01, 0x0F, 0x02, 0x0F, 0x02, 0x0E, 0x02, 0x0E, 0x02,
+    0x0D, 0x03, 0x0D, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0B, 0x04,
+    0x0B, 0x03, 0x0A, 0x04, 0x0A, 0x04, 0x09, 0x05, 0x09, 0x04, 0x08, 0x05,
+    0x08, 0x05, 0x08, 0x05, 0x07, 0x05, 0x07, 0x05, 0x06, 0x06, 0x06, 0x06,
+    0x05, 0x06, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07, 0x04, 0x06, 0x03, 0x07,
+    0x03, 0x07, 0x02, 0x08, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08, 0x00, 0x09,
+    0x00, 0x08, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x09, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x06,
+    0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x01,
+    0x00, 0x00,
+    0xCC, 0x42, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x11, 0x01, 0x11, 0x01,
+    0x11, 0x01, 0x10, 0x01, 0x10, 0x01, 0x0F, 0x02, 0x0F, 0x02, 0x0E, 0x02,
+    0x0E, 0x02, 0x0D, 0x03, 0x0D, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03,
+    0x0B, 0x04, 0x0B, 0x03, 0x0A, 0x04, 0x0A, 0x04, 0x09, 0x05, 0x09, 0x04,
+    0x08, 0x05, 0x08, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07, 0x03, 0x07,
+    0x03, 0x07, 0x02, 0x08, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x09, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x06,
+    0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x01,
+    0x00, 0x00,
+    0xCC, 0x42, 0x00, 0x00, 0x00, 0x00, 0x12, 0x01, 0x12, 0x01, 0x11, 0x01,
+    0x11, 0x01, 0x11, 0x01, 0x10, 0x02, 0x10, 0x01, 0x0F, 0x02, 0x0F, 0x02,
+    0x0E, 0x03, 0x0E, 0x02, 0x0D, 0x03, 0x0D, 0x03, 0x0C, 0x03, 0x0C, 0x03,
+    0x0B, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x09, 0x05,
+    0x09, 0x04, 0x08, 0x05, 0x08, 0x05, 0x07, 0x06, 0x07, 0x05, 0x06, 0x06,
+    0x06, 0x06, 0x05, 0x07, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07, 0x03, 0x07,
+    0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x06,
+    0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x01,
+    0x00, 0x00,
+    0xCC, 0x42, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x12, 0x01, 0x12, 0x01,
+    0x11, 0x02, 0x11, 0x01, 0x11, 0x01, 0x10, 0x02, 0x10, 0x02, 0x0F, 0x02,
+    0x0F, 0x02, 0x0E, 0x03, 0x0E, 0x02, 0x0D, 0x03, 0x0D, 0x03, 0x0C, 0x04,
+    0x0C, 0x03, 0x0B, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x09, 0x05,
+    0x09, 0x05, 0x08, 0x05, 0x08, 0x05, 0x07, 0x06, 0x07, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x05, 0x06, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07,
+    0x03, 0x07, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x08, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x06,
+    0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x01,
+    0x00, 0x00,
+    0xCC, 0x42, 0x00, 0x00, 0x00, 0x00, 0x13, 0x01, 0x13, 0x01, 0x12, 0x01,
+    0x12, 0x01, 0x11, 0x02, 0x11, 0x01, 0x11, 0x01, 0x10, 0x02, 0x10, 0x02,
+    0x0F, 0x02, 0x0F, 0x02, 0x0E, 0x03, 0x0E, 0x03, 0x0D, 0x03, 0x0D, 0x03,
+    0x0C, 0x04, 0x0C, 0x03, 0x0B, 0x04, 0x0B, 0x04, 0x0A, 0x05, 0x0A, 0x04,
+    0x09, 0x05, 0x09, 0x05, 0x08, 0x05, 0x08, 0x05, 0x07, 0x06, 0x07, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07,
+    0x03, 0x08, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x06,
+    0xFC, 0x05, 0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0x00, 0x00,
+    0xFB, 0x01,
+    0xCC, 0x42, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x13, 0x01, 0x13, 0x01,
+    0x12, 0x02, 0x12, 0x01, 0x11, 0x02, 0x11, 0x02, 0x10, 0x02, 0x10, 0x02,
+    0x0F, 0x03, 0x0F, 0x02, 0x0E, 0x03, 0x0E, 0x03, 0x0D, 0x04, 0x0D, 0x03,
+    0x0C, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x0B, 0x04, 0x0A, 0x05, 0x0A, 0x05,
+    0x09, 0x05, 0x09, 0x05, 0x08, 0x06, 0x08, 0x05, 0x07, 0x06, 0x07, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x05, 0x07, 0x04, 0x07, 0x04, 0x07,
+    0x03, 0x08, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x01, 0x09, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFD, 0x0A, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A,
+    0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x06,
+    0xFC, 0x05, 0xFC, 0x04, 0xFB, 0x04, 0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01,
+    0x00, 0x00,
+    0xCD, 0x40, 0x00, 0x00, 0x14, 0x01, 0x14, 0x01, 0x13, 0x01, 0x13, 0x01,
+    0x12, 0x02, 0x12, 0x01, 0x11, 0x02, 0x11, 0x02, 0x10, 0x02, 0x10, 0x02,
+    0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0D, 0x04, 0x0D, 0x03,
+    0x0C, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x0B, 0x04, 0x0A, 0x05, 0x0A, 0x05,
+    0x09, 0x05, 0x09, 0x05, 0x08, 0x06, 0x08, 0x05, 0x07, 0x06, 0x07, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07,
+    0x03, 0x08, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x08, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A,
+    0xFD, 0x0A, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x05,
+    0xFB, 0x05, 0xFB, 0x04, 0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01,
+    0xCD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x14, 0x01, 0x13, 0x01,
+    0x13, 0x01, 0x12, 0x02, 0x12, 0x02, 0x11, 0x02, 0x11, 0x02, 0x10, 0x03,
+    0x10, 0x02, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x03, 0x0E, 0x03, 0x0D, 0x04,
+    0x0D, 0x03, 0x0C, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x0B, 0x04, 0x0A, 0x05,
+    0x0A, 0x04, 0x09, 0x05, 0x08, 0x06, 0x08, 0x06, 0x07, 0x06, 0x07, 0x06,
+    0x06, 0x07, 0x06, 0x06, 0x05, 0x07, 0x05, 0x07, 0x04, 0x07, 0x04, 0x07,
+    0x03, 0x08, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x01, 0x08, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x0A, 0xFD, 0x0A,
+    0xFD, 0x0A, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x06, 0xFB, 0x06, 0xFB, 0x06,
+    0xFB, 0x05, 0xFB, 0x04, 0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01,
+    0xCD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x14, 0x01, 0x14, 0x01,
+    0x13, 0x02, 0x13, 0x01, 0x12, 0x02, 0x12, 0x02, 0x11, 0x02, 0x11, 0x02,
+    0x10, 0x03, 0x10, 0x02, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x03, 0x0E, 0x03,
+    0x0D, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0B, 0x05, 0x0B, 0x04, 0x0A, 0x05,
+    0x0A, 0x05, 0x09, 0x05, 0x09, 0x05, 0x08, 0x06, 0x08, 0x05, 0x07, 0x06,
+    0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x05, 0x07, 0x04, 0x08, 0x04, 0x07,
+    0x03, 0x08, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x01, 0x09, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05,
+    0xFB, 0x05, 0xFB, 0x04, 0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01,
+    0xCD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x14, 0x01,
+    0x14, 0x01, 0x13, 0x02, 0x13, 0x01, 0x12, 0x02, 0x12, 0x02, 0x11, 0x02,
+    0x11, 0x02, 0x10, 0x03, 0x10, 0x02, 0x0F, 0x03, 0x0E, 0x04, 0x0E, 0x03,
+    0x0D, 0x04, 0x0D, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0B, 0x05, 0x0B, 0x04,
+    0x0A, 0x05, 0x0A, 0x05, 0x09, 0x05, 0x08, 0x06, 0x08, 0x06, 0x07, 0x06,
+    0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x05, 0x07, 0x05, 0x07, 0x04, 0x07,
+    0x04, 0x07, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x01, 0x09, 0x01, 0x08,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x09, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x07, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05,
+    0xFB, 0x04, 0xFB, 0x04, 0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01,
+    0xCD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x15, 0x01,
+    0x14, 0x02, 0x14, 0x01, 0x13, 0x02, 0x13, 0x01, 0x12, 0x02, 0x12, 0x02,
+    0x11, 0x02, 0x11, 0x02, 0x10, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x04,
+    0x0E, 0x03, 0x0D, 0x04, 0x0D, 0x04, 0x0C, 0x04, 0x0B, 0x05, 0x0B, 0x05,
+    0x0A, 0x05, 0x0A, 0x05, 0x09, 0x06, 0x09, 0x05, 0x08, 0x06, 0x08, 0x06,
+    0x07, 0x06, 0x06, 0x07, 0x06, 0x07, 0x05, 0x07, 0x05, 0x07, 0x04, 0x08,
+    0x04, 0x07, 0x03, 0x08, 0x03, 0x08, 0x02, 0x08, 0x01, 0x09, 0x01, 0x09,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x0A, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x09,
+    0xFD, 0x0A, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09,
+    0xFC, 0x09, 0xFC, 0x08, 0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05,
+    0xFB, 0x04, 0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x02, 0xFB, 0x01,
+    0xCE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0x15, 0x01, 0x15, 0x01,
+    0x14, 0x02, 0x14, 0x01, 0x13, 0x02, 0x13, 0x02, 0x12, 0x02, 0x11, 0x03,
+    0x11, 0x03, 0x10, 0x03, 0x10, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x04,
+    0x0E, 0x03, 0x0D, 0x04, 0x0C, 0x05, 0x0C, 0x04, 0x0B, 0x05, 0x0B, 0x05,
+    0x0A, 0x05, 0x0A, 0x05, 0x09, 0x06, 0x08, 0x06, 0x08, 0x06, 0x07, 0x07,
+    0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x05, 0x07, 0x04, 0x08, 0x04, 0x07,
+    0x03, 0x08, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x01, 0x09, 0x00, 0x09,
+    0x00, 0x09, 0xFF, 0x0A, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x08, 0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04,
+    0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01, 0x00, 0x00,
+    0xCE, 0x3F, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x16, 0x01, 0x15, 0x01,
+    0x15, 0x01, 0x14, 0x02, 0x14, 0x01, 0x13, 0x02, 0x13, 0x02, 0x12, 0x02,
+    0x11, 0x03, 0x11, 0x03, 0x10, 0x03, 0x10, 0x03, 0x0F, 0x03, 0x0E, 0x04,
+    0x0E, 0x04, 0x0D, 0x04, 0x0D, 0x04, 0x0C, 0x05, 0x0C, 0x04, 0x0B, 0x05,
+    0x0A, 0x06, 0x0A, 0x05, 0x09, 0x06, 0x09, 0x05, 0x08, 0x06, 0x07, 0x07,
+    0x07, 0x06, 0x06, 0x07, 0x06, 0x07, 0x05, 0x07, 0x05, 0x07, 0x04, 0x08,
+    0x03, 0x08, 0x03, 0x08, 0x02, 0x09, 0x02, 0x08, 0x01, 0x09, 0x01, 0x08,
+    0x00, 0x09, 0xFF, 0x0A, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09,
+    0xFB, 0x09, 0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04,
+    0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01, 0x00, 0x00,
+    0xCE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x16, 0x01,
+    0x15, 0x02, 0x15, 0x01, 0x14, 0x02, 0x14, 0x01, 0x13, 0x02, 0x12, 0x03,
+    0x12, 0x02, 0x11, 0x03, 0x11, 0x03, 0x10, 0x03, 0x0F, 0x04, 0x0F, 0x03,
+    0x0E, 0x04, 0x0E, 0x04, 0x0D, 0x04, 0x0C, 0x05, 0x0C, 0x05, 0x0B, 0x05,
+    0x0B, 0x05, 0x0A, 0x05, 0x0A, 0x05, 0x09, 0x06, 0x08, 0x06, 0x08, 0x06,
+    0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x05, 0x08, 0x05, 0x07, 0x04, 0x08,
+    0x04, 0x07, 0x03, 0x08, 0x02, 0x09, 0x02, 0x08, 0x01, 0x09, 0x01, 0x09,
+    0x00, 0x09, 0xFF, 0x0A, 0xFF, 0x09, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09,
+    0xFB, 0x09, 0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04,
+    0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01, 0x00, 0x00,
+    0xCE, 0x3F, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x17, 0x01, 0x16, 0x01,
+    0x16, 0x01, 0x15, 0x02, 0x15, 0x01, 0x14, 0x02, 0x13, 0x02, 0x13, 0x02,
+    0x12, 0x03, 0x12, 0x02, 0x11, 0x03, 0x10, 0x04, 0x10, 0x03, 0x0F, 0x04,
+    0x0F, 0x03, 0x0E, 0x04, 0x0D, 0x05, 0x0D, 0x04, 0x0C, 0x05, 0x0C, 0x05,
+    0x0B, 0x05, 0x0A, 0x06, 0x0A, 0x05, 0x09, 0x06, 0x09, 0x06, 0x08, 0x06,
+    0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x06, 0x07, 0x05, 0x07, 0x04, 0x08,
+    0x04, 0x08, 0x03, 0x08, 0x03, 0x08, 0x02, 0x08, 0x01, 0x09, 0x01, 0x09,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x0A, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09,
+    0xFB, 0x09, 0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04,
+    0xFB, 0x03, 0xFB, 0x02, 0xFB, 0x01, 0xFA, 0x01,
+    0xCE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x17, 0x01,
+    0x16, 0x01, 0x16, 0x01, 0x15, 0x02, 0x14, 0x02, 0x14, 0x02, 0x13, 0x03,
+    0x13, 0x02, 0x12, 0x03, 0x11, 0x03, 0x11, 0x03, 0x10, 0x04, 0x10, 0x03,
+    0x0F, 0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0D, 0x05, 0x0C, 0x05, 0x0C, 0x05,
+    0x0B, 0x05, 0x0B, 0x05, 0x0A, 0x06, 0x09, 0x06, 0x09, 0x06, 0x08, 0x06,
+    0x08, 0x06, 0x07, 0x07, 0x06, 0x07, 0x06, 0x07, 0x05, 0x08, 0x04, 0x08,
+    0x04, 0x08, 0x03, 0x08, 0x03, 0x08, 0x02, 0x09, 0x01, 0x09, 0x01, 0x09,
+    0x00, 0x09, 0x00, 0x09, 0xFF, 0x0A, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFC, 0x09,
+    0xFB, 0x09, 0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04,
+    0xFB, 0x03, 0xFB, 0x02, 0xFA, 0x02, 0xFA, 0x01,
+    0xCF, 0x3E, 0x19, 0x01, 0x00, 0x00, 0x18, 0x01, 0x17, 0x01, 0x17, 0x01,
+    0x16, 0x02, 0x16, 0x01, 0x15, 0x02, 0x14, 0x02, 0x14, 0x02, 0x13, 0x03,
+    0x12, 0x03, 0x12, 0x03, 0x11, 0x03, 0x11, 0x03, 0x10, 0x04, 0x0F, 0x04,
+    0x0F, 0x04, 0x0E, 0x04, 0x0D, 0x05, 0x0D, 0x05, 0x0C, 0x05, 0x0C, 0x05,
+    0x0B, 0x05, 0x0A, 0x06, 0x0A, 0x06, 0x09, 0x06, 0x08, 0x07, 0x08, 0x06,
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x08, 0x05, 0x07, 0x04, 0x08,
+    0x03, 0x08, 0x03, 0x08, 0x02, 0x09, 0x02, 0x08, 0x01, 0x09, 0x00, 0x09,
+    0x00, 0x09, 0xFF, 0x0A, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFB, 0x0A, 0xFB, 0x09,
+    0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04, 0xFB, 0x03,
+    0xFA, 0x03, 0xFA, 0x02, 0xFA, 0x01,
+    0xCF, 0x3E, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00, 0x18, 0x01, 0x17, 0x01,
+    0x17, 0x01, 0x16, 0x02, 0x15, 0x02, 0x15, 0x02, 0x14, 0x02, 0x14, 0x02,
+    0x13, 0x03, 0x12, 0x03, 0x12, 0x03, 0x11, 0x03, 0x10, 0x04, 0x10, 0x03,
+    0x0F, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0D, 0x05, 0x0C, 0x05, 0x0C, 0x05,
+    0x0B, 0x06, 0x0B, 0x05, 0x0A, 0x06, 0x09, 0x06, 0x09, 0x06, 0x08, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x08, 0x05, 0x07, 0x04, 0x08,
+    0x04, 0x08, 0x03, 0x08, 0x02, 0x09, 0x02, 0x08, 0x01, 0x09, 0x00, 0x0A,
+    0x00, 0x09, 0xFF, 0x0A, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFB, 0x0A, 0xFB, 0x09,
+    0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04, 0xFB, 0x03,
+    0xFA, 0x03, 0xFA, 0x02, 0x00, 0x00,
+    0xCF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00, 0x18, 0x01,
+    0x17, 0x01, 0x17, 0x01, 0x16, 0x02, 0x15, 0x02, 0x15, 0x02, 0x14, 0x02,
+    0x13, 0x03, 0x13, 0x03, 0x12, 0x03, 0x11, 0x04, 0x11, 0x03, 0x10, 0x04,
+    0x0F, 0x04, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0C, 0x05,
+    0x0C, 0x05, 0x0B, 0x05, 0x0A, 0x06, 0x0A, 0x06, 0x09, 0x06, 0x08, 0x07,
+    0x08, 0x06, 0x07, 0x07, 0x06, 0x08, 0x06, 0x07, 0x05, 0x08, 0x04, 0x08,
+    0x04, 0x08, 0x03, 0x08, 0x02, 0x09, 0x02, 0x09, 0x01, 0x09, 0x00, 0x0A,
+    0x00, 0x09, 0xFF, 0x0A, 0xFE, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFB, 0x0A, 0xFB, 0x09,
+    0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFB, 0x04, 0xFA, 0x04,
+    0xFA, 0x03, 0xFA, 0x01, 0x00, 0x00,
+    0xCF, 0x3E, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x00, 0x19, 0x01, 0x18, 0x01,
+    0x18, 0x01, 0x17, 0x02, 0x16, 0x02, 0x16, 0x02, 0x15, 0x02, 0x14, 0x03,
+    0x14, 0x02, 0x13, 0x03, 0x12, 0x04, 0x12, 0x03, 0x11, 0x04, 0x10, 0x04,
+    0x10, 0x04, 0x0F, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0D, 0x05, 0x0C, 0x06,
+    0x0C, 0x05, 0x0B, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x09, 0x06, 0x08, 0x07,
+    0x08, 0x07, 0x07, 0x07, 0x06, 0x08, 0x06, 0x07, 0x05, 0x08, 0x04, 0x08,
+    0x04, 0x08, 0x03, 0x09, 0x02, 0x09, 0x02, 0x09, 0x01, 0x09, 0x01, 0x09,
+    0x00, 0x09, 0xFF, 0x0A, 0xFF, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A,
+    0xFC, 0x0B, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xFB, 0x0A, 0xFB, 0x09,
+    0xFB, 0x08, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFA, 0x05, 0xFA, 0x04,
+    0xFA, 0x02, 0xFA, 0x01, 0x00, 0x00,
+    0xD0, 0x3D, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x00, 0x19, 0x01, 0x18, 0x01,
+    0x18, 0x01, 0x17, 0x02, 0x16, 0x02, 0x16, 0x02, 0x15, 0x02, 0x14, 0x03,
+    0x14, 0x02, 0x13, 0x03, 0x12, 0x03, 0x12, 0x03, 0x11, 0x04, 0x10, 0x04,
+    0x0F, 0x05, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x05, 0x0D, 0x05, 0x0C, 0x05,
+    0x0B, 0x06, 0x0B, 0x06, 0x0A, 0x06, 0x09, 0x07, 0x09, 0x06, 0x08, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x05, 0x08, 0x05, 0x08, 0x04, 0x08,
+    0x03, 0x09, 0x03, 0x08, 0x02, 0x09, 0x01, 0x09, 0x01, 0x09, 0x00, 0x09,
+    0xFF, 0x0A, 0xFF, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A, 0xFC, 0x0B,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08,
+    0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFA, 0x05, 0xFA, 0x03, 0xFA, 0x02,
+    0xFA, 0x01, 0x00, 0x00,
+    0xD0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x19, 0x01, 0x19, 0x01,
+    0x18, 0x01, 0x17, 0x02, 0x17, 0x02, 0x16, 0x02, 0x15, 0x03, 0x15, 0x02,
+    0x14, 0x03, 0x13, 0x03, 0x13, 0x03, 0x12, 0x03, 0x11, 0x04, 0x11, 0x03,
+    0x10, 0x04, 0x0F, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0D, 0x05, 0x0C, 0x06,
+    0x0C, 0x05, 0x0B, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x09, 0x06, 0x08, 0x07,
+    0x08, 0x07, 0x07, 0x07, 0x06, 0x08, 0x05, 0x08, 0x05, 0x08, 0x04, 0x08,
+    0x03, 0x09, 0x03, 0x08, 0x02, 0x09, 0x01, 0x0A, 0x01, 0x09, 0x00, 0x0A,
+    0xFF, 0x0A, 0xFF, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A, 0xFC, 0x0B,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08,
+    0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFA, 0x04, 0xFA, 0x03, 0xFA, 0x02,
+    0xFA, 0x01, 0x00, 0x00,
+    0xD0, 0x3D, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x1A, 0x01, 0x19, 0x01,
+    0x19, 0x01, 0x18, 0x01, 0x17, 0x02, 0x17, 0x02, 0x16, 0x02, 0x15, 0x03,
+    0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 0x12, 0x04, 0x12, 0x03, 0x11, 0x04,
+    0x10, 0x04, 0x0F, 0x05, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x06, 0x0D, 0x05,
+    0x0C, 0x06, 0x0B, 0x06, 0x0B, 0x06, 0x0A, 0x06, 0x09, 0x07, 0x08, 0x07,
+    0x08, 0x07, 0x07, 0x07, 0x06, 0x08, 0x06, 0x07, 0x05, 0x08, 0x04, 0x08,
+    0x04, 0x08, 0x03, 0x09, 0x02, 0x09, 0x01, 0x0A, 0x01, 0x09, 0x00, 0x0A,
+    0xFF, 0x0A, 0xFF, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A, 0xFC, 0x0B,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08,
+    0xFB, 0x07, 0xFB, 0x06, 0xFA, 0x06, 0xFA, 0x04, 0xFA, 0x03, 0xFA, 0x02,
+    0xFA, 0x01, 0x00, 0x00,
+    0xD0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x00, 0x1A, 0x01,
+    0x19, 0x01, 0x18, 0x02, 0x18, 0x01, 0x17, 0x02, 0x16, 0x03, 0x16, 0x02,
+    0x15, 0x03, 0x14, 0x03, 0x13, 0x04, 0x13, 0x03, 0x12, 0x04, 0x11, 0x04,
+    0x11, 0x04, 0x10, 0x04, 0x0F, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0D, 0x05,
+    0x0C, 0x06, 0x0C, 0x05, 0x0B, 0x06, 0x0A, 0x06, 0x09, 0x07, 0x09, 0x07,
+    0x08, 0x07, 0x07, 0x08, 0x07, 0x07, 0x06, 0x08, 0x05, 0x08, 0x04, 0x09,
+    0x04, 0x08, 0x03, 0x09, 0x02, 0x09, 0x02, 0x09, 0x01, 0x09, 0x00, 0x0A,
+    0xFF, 0x0A, 0xFF, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A, 0xFC, 0x0B,
+    0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x0A, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08,
+    0xFB, 0x07, 0xFB, 0x06, 0xFA, 0x05, 0xFA, 0x04, 0xFA, 0x03, 0xFA, 0x02,
+    0xFA, 0x01, 0x00, 0x00,
+    0xD0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x01, 0x1A, 0x01,
+    0x1A, 0x01, 0x19, 0x01, 0x18, 0x02, 0x18, 0x01, 0x17, 0x02, 0x16, 0x02,
+    0x15, 0x03, 0x15, 0x03, 0x14, 0x03, 0x13, 0x04, 0x12, 0x04, 0x12, 0x04,
+    0x11, 0x04, 0x10, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0E, 0x05, 0x0D, 0x06,
+    0x0D, 0x05, 0x0C, 0x06, 0x0B, 0x06, 0x0A, 0x07, 0x0A, 0x06, 0x09, 0x07,
+    0x08, 0x07, 0x07, 0x08, 0x07, 0x07, 0x06, 0x08, 0x05, 0x08, 0x05, 0x08,
+    0x04, 0x08, 0x03, 0x09, 0x02, 0x09, 0x02, 0x09, 0x01, 0x09, 0x00, 0x0A,
+    0xFF, 0x0A, 0xFF, 0x0A, 0xFE, 0x0A, 0xFD, 0x0B, 0xFD, 0x0A, 0xFC, 0x0B,
+    0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08,
+    0xFB, 0x07, 0xFA, 0x07, 0xFA, 0x05, 0xFA, 0x04, 0xFA, 0x03, 0xFA, 0x02,
+    0xF9, 0x02, 0x00, 0x00,
+    0xD1, 0x3B, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x1B, 0x01, 0x1A, 0x01,
+    0x19, 0x02, 0x19, 0x01, 0x18, 0x02, 0x17, 0x02, 0x17, 0x02, 0x16, 0x02,
+    0x15, 0x03, 0x14, 0x03, 0x14, 0x03, 0x13, 0x03, 0x12, 0x04, 0x11, 0x04,
+    0x11, 0x04, 0x10, 0x04, 0x0F, 0x05, 0x0E, 0x05, 0x0E, 0x05, 0x0D, 0x05,
+    0x0C, 0x06, 0x0B, 0x06, 0x0B, 0x06, 0x0A, 0x06, 0x09, 0x07, 0x08, 0x07,
+    0x08, 0x07, 0x07, 0x07, 0x06, 0x08, 0x05, 0x09, 0x05, 0x08, 0x04, 0x09,
+    0x03, 0x09, 0x02, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x00, 0x0A, 0xFF, 0x0B,
+    0xFF, 0x0A, 0xFE, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B,
+    0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFB, 0x07,
+    0xFA, 0x07, 0xFA, 0x05, 0xFA, 0x04, 0xFA, 0x03, 0xFA, 0x02, 0xF9, 0x01,
+    0xD1, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0x00, 0x00, 0x1B, 0x01,
+    0x1A, 0x01, 0x19, 0x02, 0x19, 0x01, 0x18, 0x02, 0x17, 0x02, 0x16, 0x03,
+    0x15, 0x03, 0x15, 0x03, 0x14, 0x03, 0x13, 0x04, 0x12, 0x04, 0x12, 0x04,
+    0x11, 0x04, 0x10, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0E, 0x05, 0x0D, 0x06,
+    0x0C, 0x06, 0x0C, 0x06, 0x0B, 0x06, 0x0A, 0x07, 0x09, 0x07, 0x09, 0x07,
+    0x08, 0x07, 0x07, 0x08, 0x06, 0x08, 0x06, 0x08, 0x05, 0x08, 0x04, 0x09,
+    0x03, 0x09, 0x03, 0x09, 0x02, 0x09, 0x01, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
+    0xFF, 0x0A, 0xFE, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B,
+    0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFB, 0x07,
+    0xFA, 0x07, 0xFA, 0x05, 0xFA, 0x04, 0xFA, 0x03, 0xF9, 0x02, 0xF9, 0x01,
+    0xD1, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0x1B, 0x01,
+    0x1B, 0x01, 0x1A, 0x01, 0x19, 0x02, 0x18, 0x02, 0x17, 0x03, 0x17, 0x02,
+    0x16, 0x03, 0x15, 0x03, 0x14, 0x04, 0x14, 0x03, 0x13, 0x04, 0x12, 0x04,
+    0x11, 0x05, 0x11, 0x04, 0x10, 0x05, 0x0F, 0x05, 0x0E, 0x06, 0x0D, 0x06,
+    0x0D, 0x06, 0x0C, 0x06, 0x0B, 0x07, 0x0A, 0x07, 0x0A, 0x06, 0x09, 0x07,
+    0x08, 0x07, 0x07, 0x08, 0x07, 0x07, 0x06, 0x08, 0x05, 0x08, 0x04, 0x09,
+    0x03, 0x09, 0x03, 0x09, 0x02, 0x09, 0x01, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
+    0xFF, 0x0A, 0xFE, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B,
+    0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFB, 0x07,
+    0xFA, 0x06, 0xFA, 0x05, 0xFA, 0x04, 0xFA, 0x03, 0xF9, 0x02, 0xF9, 0x01,
+    0xD2, 0x3A, 0x00, 0x00, 0x1D, 0x01, 0x00, 0x00, 0x1C, 0x01, 0x1B, 0x01,
+    0x1A, 0x02, 0x1A, 0x01, 0x19, 0x02, 0x18, 0x02, 0x17, 0x03, 0x16, 0x03,
+    0x16, 0x03, 0x15, 0x03, 0x14, 0x04, 0x13, 0x04, 0x12, 0x05, 0x12, 0x04,
+    0x11, 0x04, 0x10, 0x05, 0x0F, 0x05, 0x0F, 0x05, 0x0E, 0x05, 0x0D, 0x06,
+    0x0C, 0x06, 0x0B, 0x07, 0x0B, 0x06, 0x0A, 0x07, 0x09, 0x07, 0x08, 0x08,
+    0x08, 0x07, 0x07, 0x08, 0x06, 0x08, 0x05, 0x09, 0x04, 0x09, 0x04, 0x08,
+    0x03, 0x09, 0x02, 0x09, 0x01, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0xFF, 0x0A,
+    0xFE, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A,
+    0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFA, 0x08, 0xFA, 0x06,
+    0xFA, 0x05, 0xFA, 0x04, 0xFA, 0x02, 0xF9, 0x02, 0xF9, 0x01,
+    0xD2, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0x1C, 0x01, 0x1C, 0x01,
+    0x1B, 0x01, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x03, 0x18, 0x02, 0x17, 0x03,
+    0x16, 0x03, 0x15, 0x04, 0x14, 0x04, 0x14, 0x03, 0x13, 0x04, 0x12, 0x04,
+    0x11, 0x05, 0x10, 0x05, 0x10, 0x05, 0x0F, 0x05, 0x0E, 0x06, 0x0D, 0x06,
+    0x0C, 0x07, 0x0C, 0x06, 0x0B, 0x07, 0x0A, 0x07, 0x09, 0x07, 0x08, 0x08,
+    0x08, 0x07, 0x07, 0x08, 0x06, 0x08, 0x05, 0x09, 0x05, 0x08, 0x04, 0x09,
+    0x03, 0x09, 0x02, 0x0A, 0x01, 0x0A, 0x01, 0x09, 0x00, 0x0A, 0xFF, 0x0A,
+    0xFE, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A,
+    0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFA, 0x08, 0xFA, 0x06,
+    0xFA, 0x05, 0xFA, 0x04, 0xF9, 0x03, 0xF9, 0x02, 0xF9, 0x01,
+    0xD2, 0x3A, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0x1C, 0x01,
+    0x1B, 0x02, 0x1B, 0x01, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x03, 0x17, 0x03,
+    0x17, 0x03, 0x16, 0x03, 0x15, 0x03, 0x14, 0x04, 0x13, 0x04, 0x12, 0x05,
+    0x12, 0x04, 0x11, 0x05, 0x10, 0x05, 0x0F, 0x06, 0x0E, 0x06, 0x0E, 0x05,
+    0x0D, 0x06, 0x0C, 0x06, 0x0B, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x09, 0x07,
+    0x08, 0x08, 0x07, 0x08, 0x06, 0x08, 0x05, 0x09, 0x05, 0x08, 0x04, 0x09,
+    0x03, 0x09, 0x02, 0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x00, 0x0A, 0xFF, 0x0B,
+    0xFE, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A,
+    0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFA, 0x08, 0xFA, 0x06,
+    0xFA, 0x05, 0xFA, 0x04, 0xF9, 0x03, 0xF9, 0x02, 0x00, 0x00,
+    0xD2, 0x3A, 0x00, 0x00, 0x1F, 0x01, 0x1E, 0x01, 0x00, 0x00, 0x1D, 0x01,
+    0x1C, 0x01, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x19, 0x02, 0x18, 0x02,
+    0x17, 0x03, 0x16, 0x03, 0x15, 0x04, 0x15, 0x03, 0x14, 0x04, 0x13, 0x04,
+    0x12, 0x05, 0x11, 0x05, 0x10, 0x05, 0x10, 0x05, 0x0F, 0x05, 0x0E, 0x06,
+    0x0D, 0x06, 0x0C, 0x07, 0x0B, 0x07, 0x0B, 0x06, 0x0A, 0x07, 0x09, 0x07,
+    0x08, 0x08, 0x07, 0x08, 0x06, 0x09, 0x06, 0x08, 0x05, 0x09, 0x04, 0x09,
+    0x03, 0x09, 0x02, 0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x00, 0x0A, 0xFF, 0x0B,
+    0xFE, 0x0B, 0xFD, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A,
+    0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFA, 0x08, 0xFA, 0x06,
+    0xFA, 0x05, 0xFA, 0x03, 0xF9, 0x03, 0xF9, 0x02, 0x00, 0x00,
+    0xD3, 0x39, 0x00, 0x00, 0x1F, 0x01, 0x1E, 0x01, 0x1D, 0x01, 0x1D, 0x01,
+    0x1C, 0x01, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x03, 0x17, 0x03,
+    0x17, 0x03, 0x16, 0x03, 0x15, 0x04, 0x14, 0x04, 0x13, 0x04, 0x12, 0x05,
+    0x12, 0x04, 0x11, 0x05, 0x10, 0x05, 0x0F, 0x06, 0x0E, 0x06, 0x0D, 0x06,
+    0x0D, 0x06, 0x0C, 0x06, 0x0B, 0x07, 0x0A, 0x07, 0x09, 0x08, 0x08, 0x08,
+    0x07, 0x08, 0x07, 0x08, 0x06, 0x08, 0x05, 0x09, 0x04, 0x09, 0x03, 0x0A,
+    0x02, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x00, 0x0A, 0xFF, 0x0B, 0xFE, 0x0B,
+    0xFD, 0x0C, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B,
+    0xFB, 0x0A, 0xFB, 0x09, 0xFB, 0x08, 0xFA, 0x08, 0xFA, 0x06, 0xFA, 0x05,
+    0xF9, 0x04, 0xF9, 0x03, 0xF9, 0x02, 0x00, 0x00,
+    0xD3, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0x1D, 0x01,
+    0x1C, 0x02, 0x1B, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x03,
+    0x17, 0x03, 0x16, 0x04, 0x15, 0x04, 0x15, 0x03, 0x14, 0x04, 0x13, 0x04,
+    0x12, 0x05, 0x11, 0x05, 0x10, 0x06, 0x0F, 0x06, 0x0F, 0x05, 0x0E, 0x06,
+    0x0D, 0x06, 0x0C, 0x07, 0x0B, 0x07, 0x0A, 0x07, 0x09, 0x08, 0x09, 0x07,
+    0x08, 0x08, 0x07, 0x08, 0x06, 0x08, 0x05, 0x09, 0x04, 0x09, 0x03, 0x0A,
+    0x03, 0x09, 0x02, 0x0A, 0x01, 0x0A, 0x00, 0x0A, 0xFF, 0x0B, 0xFE, 0x0B,
+    0xFD, 0x0C, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B,
+    0xFB, 0x0A, 0xFB, 0x09, 0xFA, 0x09, 0xFA, 0x08, 0xFA, 0x06, 0xFA, 0x05,
+    0xF9, 0x04, 0xF9, 0x03, 0xF9, 0x01, 0xF8, 0x01,
+    0xD3, 0x39, 0x00, 0x00, 0x20, 0x01, 0x1F, 0x01, 0x00, 0x00, 0x1E, 0x01,
+    0x1D, 0x01, 0x1C, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x03,
+    0x18, 0x03, 0x17, 0x03, 0x16, 0x03, 0x15, 0x04, 0x14, 0x04, 0x13, 0x05,
+    0x12, 0x05, 0x11, 0x05, 0x11, 0x05, 0x10, 0x05, 0x0F, 0x06, 0x0E, 0x06,
+    0x0D, 0x06, 0x0C, 0x07, 0x0B, 0x07, 0x0A, 0x08, 0x0A, 0x07, 0x09, 0x07,
+    0x08, 0x08, 0x07, 0x08, 0x06, 0x09, 0x05, 0x09, 0x04, 0x09, 0x03, 0x0A,
+    0x03, 0x09, 0x02, 0x0A, 0x01, 0x0A, 0x00, 0x0A, 0xFF, 0x0B, 0xFE, 0x0B,
+    0xFD, 0x0C, 0xFD, 0x0B, 0xFC, 0x0C, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B,
+    0xFB, 0x0A, 0xFB, 0x09, 0xFA, 0x09, 0xFA, 0x08, 0xFA, 0x06, 0xFA, 0x05,
+    0xF9, 0x04, 0xF9, 0x03, 0xF9, 0x01, 0xF8, 0x01,
+    0xD3, 0x39, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x1F, 0x01, 0x1E, 0x01,
+    0x1D, 0x02, 0x1C, 0x02, 0x1C, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03,
+    0x18, 0x03, 0x17, 0x03, 0x16, 0x04, 0x15, 0x04, 0x14, 0x05, 0x14, 0x04,
+    0x13, 0x04, 0x12, 0x05, 0x11, 0x05, 0x10, 0x06, 0x0F, 0x06, 0x0E, 0x06,
+    0x0D, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0B, 0x07, 0x0A, 0x07, 0x09, 0x08,
+    0x08, 0x08, 0x07, 0x08, 0x06, 0x09, 0x05, 0x09, 0x04, 0x0A, 0x04, 0x09,
+    0x03, 0x09, 0x02, 0x0A, 0x01, 0x0A, 0x00, 0x0B, 0xFF, 0x0B, 0xFE, 0x0B,
+    0xFD, 0x0C, 0xFD, 0x0B, 0xFC, 0x0C, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B,
+    0xFB, 0x0A, 0xFB, 0x09, 0xFA, 0x09, 0xFA, 0x07, 0xFA, 0x06, 0xF9, 0x06,
+    0xF9, 0x04, 0xF9, 0x03, 0xF9, 0x01, 0xF8, 0x01,
+    0xD4, 0x38, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x1F, 0x01, 0x1E, 0x01,
+    0x1D, 0x02, 0x1C, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x03, 0x19, 0x03,
+    0x18, 0x03, 0x17, 0x03, 0x16, 0x04, 0x15, 0x04, 0x14, 0x04, 0x13, 0x05,
+    0x12, 0x05, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x06, 0x0F, 0x06, 0x0E, 0x06,
+    0x0D, 0x06, 0x0C, 0x07, 0x0B, 0x07, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x08,
+    0x07, 0x09, 0x06, 0x09, 0x06, 0x08, 0x05, 0x09, 0x04, 0x09, 0x03, 0x0A,
+    0x02, 0x0A, 0x01, 0x0A, 0x00, 0x0B, 0xFF, 0x0B, 0xFE, 0x0B, 0xFD, 0x0C,
+    0xFD, 0x0B, 0xFC, 0x0C, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A,
+    0xFB, 0x09, 0xFA, 0x09, 0xFA, 0x07, 0xFA, 0x06, 0xF9, 0x05, 0xF9, 0x04,
+    0xF9, 0x02, 0xF8, 0x02, 0x00, 0x00,
+    0xD4, 0x38, 0x00, 0x00, 0x21, 0x01, 0x20, 0x01, 0x1F, 0x01, 0x1F, 0x01,
+    0x1E, 0x01, 0x1D, 0x02, 0x1C, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x03,
+    0x18, 0x03, 0x17, 0x04, 0x16, 0x04, 0x15, 0x04, 0x14, 0x05, 0x13, 0x05,
+    0x13, 0x05, 0x12, 0x05, 0x11, 0x05, 0x10, 0x06, 0x0F, 0x06, 0x0E, 0x06,
+    0x0D, 0x07, 0x0C, 0x07, 0x0B, 0x07, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x09,
+    0x08, 0x08, 0x07, 0x08, 0x06, 0x09, 0x05, 0x09, 0x04, 0x09, 0x03, 0x0A,
+    0x02, 0x0A, 0x01, 0x0A, 0x00, 0x0B, 0xFF, 0x0B, 0xFE, 0x0C, 0xFD, 0x0C,
+    0xFD, 0x0B, 0xFC, 0x0C, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A,
+    0xFB, 0x09, 0xFA, 0x09, 0xFA, 0x07, 0xFA, 0x06, 0xF9, 0x05, 0xF9, 0x04,
+    0xF9, 0x02, 0xF8, 0x02, 0x00, 0x00,
+    0xD4, 0x38, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0x20, 0x01, 0x1F, 0x01,
+    0x1E, 0x02, 0x1D, 0x02, 0x1C, 0x02, 0x1B, 0x03, 0x1A, 0x03, 0x19, 0x03,
+    0x19, 0x03, 0x18, 0x03, 0x17, 0x03, 0x16, 0x04, 0x15, 0x04, 0x14, 0x05,
+    0x13, 0x05, 0x12, 0x05, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x06, 0x0E, 0x07,
+    0x0D, 0x07, 0x0C, 0x07, 0x0B, 0x08, 0x0B, 0x07, 0x0A, 0x07, 0x09, 0x08,
+    0x08, 0x08, 0x07, 0x08, 0x06, 0x09, 0x05, 0x09, 0x04, 0x0A, 0x03, 0x0A,
+    0x02, 0x0A, 0x01, 0x0B, 0x00, 0x0B, 0xFF, 0x0B, 0xFE, 0x0C, 0xFD, 0x0C,
+    0xFD, 0x0B, 0xFC, 0x0C, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A,
+    0xFB, 0x09, 0xFA, 0x09, 0xFA, 0x07, 0xFA, 0x06, 0xF9, 0x05, 0xF9, 0x04,
+    0xF9, 0x02, 0xF8, 0x02, 0x00, 0x00,
+    0xD5, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x1F, 0x01,
+    0x1E, 0x02, 0x1D, 0x02, 0x1C, 0x02, 0x1B, 0x03, 0x1A, 0x03, 0x19, 0x03,
+    0x18, 0x04, 0x17, 0x04, 0x16, 0x04, 0x15, 0x05, 0x14, 0x05, 0x13, 0x05,
+    0x12, 0x06, 0x11, 0x06, 0x10, 0x06, 0x10, 0x06, 0x0F, 0x06, 0x0E, 0x06,
+    0x0D, 0x07, 0x0C, 0x07, 0x0B, 0x07, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x08,
+    0x07, 0x09, 0x06, 0x09, 0x05, 0x09, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0A,
+    0x01, 0x0B, 0x00, 0x0B, 0xFF, 0x0B, 0xFE, 0x0C, 0xFD, 0x0C, 0xFD, 0x0B,
+    0xFC, 0x0C, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A, 0xFB, 0x09,
+    0xFA, 0x09, 0xFA, 0x07, 0xF9, 0x07, 0xF9, 0x05, 0xF9, 0x04, 0xF8, 0x03,
+    0xF8, 0x01,
+    0xD5, 0x36, 0x00, 0x00, 0x22, 0x01, 0x21, 0x01, 0x20, 0x01, 0x1F, 0x02,
+    0x1E, 0x02, 0x1D, 0x02, 0x1C, 0x03, 0x1B, 0x03, 0x1B, 0x02, 0x1A, 0x03,
+    0x19, 0x03, 0x18, 0x03, 0x17, 0x04, 0x16, 0x04, 0x15, 0x04, 0x14, 0x05,
+    0x13, 0x05, 0x12, 0x05, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x06, 0x0E, 0x07,
+    0x0D, 0x07, 0x0C, 0x07, 0x0B, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x09,
+    0x07, 0x09, 0x06, 0x09, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0B,
+    0x01, 0x0B, 0x00, 0x0B, 0xFF, 0x0C, 0xFE, 0x0C, 0xFD, 0x0C, 0xFD, 0x0C,
+    0xFC, 0x0C, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A,
+    0xFA, 0x09, 0xFA, 0x07, 0xF9, 0x07, 0xF9, 0x05, 0xF9, 0x03, 0xF8, 0x03,
+    0xF8, 0x01,
+    0xD5, 0x36, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x21, 0x01, 0x20, 0x01,
+    0x1F, 0x02, 0x1E, 0x02, 0x1D, 0x02, 0x1C, 0x02, 0x1B, 0x03, 0x1A, 0x03,
+    0x19, 0x03, 0x18, 0x04, 0x17, 0x04, 0x16, 0x04, 0x15, 0x05, 0x14, 0x05,
+    0x13, 0x05, 0x12, 0x06, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x07, 0x0E, 0x07,
+    0x0D, 0x07, 0x0C, 0x08, 0x0B, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x09,
+    0x07, 0x09, 0x06, 0x09, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0B,
+    0x01, 0x0B, 0x00, 0x0B, 0xFF, 0x0C, 0xFE, 0x0C, 0xFD, 0x0C, 0xFD, 0x0C,
+    0xFC, 0x0C, 0xFC, 0x0B, 0xFB, 0x0C, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A,
+    0xFA, 0x09, 0xFA, 0x07, 0xF9, 0x07, 0xF9, 0x05, 0xF9, 0x03, 0xF8, 0x03,
+    0xF8, 0x01,
+    0xD6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0x20, 0x01,
+    0x1F, 0x01, 0x1E, 0x02, 0x1D, 0x02, 0x1C, 0x02, 0x1B, 0x03, 0x1A, 0x03,
+    0x19, 0x03, 0x18, 0x03, 0x17, 0x04, 0x16, 0x04, 0x15, 0x04, 0x14, 0x05,
+    0x13, 0x05, 0x12, 0x05, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x06, 0x0E, 0x07,
+    0x0D, 0x07, 0x0C, 0x07, 0x0B, 0x07, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x09,
+    0x06, 0x0A, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0B, 0x02, 0x0B, 0x01, 0x0B,
+    0x00, 0x0B, 0xFF, 0x0C, 0xFE, 0x0C, 0xFD, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C,
+    0xFC, 0x0B, 0xFB, 0x0C, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A, 0xFA, 0x09,
+    0xFA, 0x07, 0xF9, 0x07, 0xF9, 0x05, 0xF9, 0x03, 0xF8, 0x02, 0xF8, 0x01,
+    0xD6, 0x35, 0x00, 0x00, 0x23, 0x01, 0x22, 0x01, 0x21, 0x01, 0x20, 0x02,
+    0x1F, 0x02, 0x1E, 0x02, 0x1D, 0x02, 0x1C, 0x03, 0x1B, 0x03, 0x1A, 0x03,
+    0x19, 0x04, 0x18, 0x04, 0x17, 0x04, 0x16, 0x05, 0x15, 0x05, 0x14, 0x05,
+    0x13, 0x05, 0x12, 0x06, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x07, 0x0E, 0x07,
+    0x0D, 0x07, 0x0C, 0x07, 0x0B, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x09,
+    0x07, 0x09, 0x06, 0x09, 0x05, 0x09, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0A,
+    0x01, 0x0B, 0x00, 0x0B, 0xFE, 0x0C, 0xFD, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C,
+    0xFC, 0x0B, 0xFB, 0x0C, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A, 0xFA, 0x09,
+    0xFA, 0x07, 0xF9, 0x07, 0xF9, 0x05, 0xF8, 0x04, 0xF8, 0x02, 0xF8, 0x01,
+    0xD6, 0x35, 0x00, 0x00, 0x00, 0x00, 0x23, 0x01, 0x22, 0x01, 0x21, 0x01,
+    0x20, 0x01, 0x1F, 0x02, 0x1E, 0x02, 0x1D, 0x02, 0x1C, 0x03, 0x1B, 0x03,
+    0x1A, 0x03, 0x18, 0x04, 0x17, 0x05, 0x16, 0x05, 0x15, 0x05, 0x14, 0x05,
+    0x13, 0x06, 0x12, 0x06, 0x11, 0x06, 0x10, 0x07, 0x0F, 0x07, 0x0E, 0x07,
+    0x0D, 0x07, 0x0C, 0x08, 0x0B, 0x08, 0x0A, 0x08, 0x09, 0x09, 0x08, 0x09,
+    0x07, 0x09, 0x06, 0x09, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0A,
+    0x01, 0x0B, 0x00, 0x0B, 0xFF, 0x0B, 0xFD, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C,
+    0xFC, 0x0B, 0xFB, 0x0C, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A, 0xFA, 0x09,
+    0xF9, 0x08, 0xF9, 0x06, 0xF9, 0x05, 0xF8, 0x04, 0xF8, 0x02, 0x00, 0x00,
+    0xD7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x21, 0x02, 0x20, 0x02,
+    0x1F, 0x02, 0x1E, 0x02, 0x1D, 0x03, 0x1C, 0x03, 0x1B, 0x03, 0x1A, 0x04,
+    0x19, 0x04, 0x18, 0x04, 0x17, 0x04, 0x16, 0x05, 0x15, 0x05, 0x14, 0x05,
+    0x13, 0x05, 0x12, 0x06, 0x11, 0x06, 0x0F, 0x07, 0x0E, 0x07, 0x0D, 0x08,
+    0x0C, 0x08, 0x0B, 0x08, 0x0A, 0x08, 0x09, 0x09, 0x08, 0x09, 0x07, 0x09,
+    0x06, 0x0A, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0B, 0x01, 0x0B,
+    0x00, 0x0B, 0xFF, 0x0B, 0xFD, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C, 0xFC, 0x0B,
+    0xFB, 0x0C, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A, 0xFA, 0x09, 0xF9, 0x08,
+    0xF9, 0x06, 0xF9, 0x05, 0xF8, 0x04, 0xF8, 0x02, 0xF7, 0x01,
+    0xD7, 0x34, 0x25, 0x01, 0x24, 0x01, 0x23, 0x01, 0x22, 0x01, 0x21, 0x02,
+    0x20, 0x02, 0x1F, 0x02, 0x1E, 0x02, 0x1D, 0x03, 0x1C, 0x03, 0x1B, 0x03,
+    0x19, 0x04, 0x18, 0x04, 0x17, 0x05, 0x16, 0x05, 0x15, 0x05, 0x14, 0x05,
+    0x13, 0x06, 0x12, 0x06, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x07, 0x0E, 0x07,
+    0x0D, 0x07, 0x0B, 0x08, 0x0A, 0x09, 0x09, 0x09, 0x08, 0x09, 0x07, 0x09,
+    0x06, 0x0A, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0B, 0x01, 0x0B,
+    0x00, 0x0B, 0xFF, 0x0B, 0xFD, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C, 0xFC, 0x0B,
+    0xFB, 0x0C, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A, 0xFA, 0x09, 0xF9, 0x08,
+    0xF9, 0x06, 0xF9, 0x04, 0xF8, 0x04, 0xF8, 0x02, 0xF7, 0x01,
+    0xD7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x24, 0x01, 0x23, 0x01, 0x22, 0x01,
+    0x21, 0x01, 0x1F, 0x03, 0x1E, 0x03, 0x1D, 0x03, 0x1C, 0x03, 0x1B, 0x03,
+    0x1A, 0x04, 0x19, 0x04, 0x18, 0x04, 0x17, 0x04, 0x16, 0x05, 0x14, 0x06,
+    0x13, 0x06, 0x12, 0x06, 0x11, 0x07, 0x10, 0x07, 0x0F, 0x07, 0x0E, 0x07,
+    0x0D, 0x08, 0x0C, 0x08, 0x0B, 0x08, 0x0A, 0x08, 0x08, 0x09, 0x07, 0x0A,
+    0x06, 0x0A, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0B, 0x02, 0x0B, 0x01, 0x0B,
+    0x00, 0x0B, 0xFF, 0x0C, 0xFD, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C,
+    0xFB, 0x0C, 0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A, 0xFA, 0x09, 0xF9, 0x08,
+    0xF9, 0x06, 0xF8, 0x05, 0xF8, 0x03, 0xF8, 0x02, 0xF7, 0x01,
+    0xD8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x23, 0x01, 0x22, 0x02, 0x21, 0x02,
+    0x20, 0x02, 0x1F, 0x02, 0x1E, 0x02, 0x1D, 0x03, 0x1C, 0x03, 0x1A, 0x04,
+    0x19, 0x04, 0x18, 0x05, 0x17, 0x05, 0x16, 0x05, 0x15, 0x05, 0x14, 0x05,
+    0x13, 0x06, 0x12, 0x06, 0x10, 0x07, 0x0F, 0x07, 0x0E, 0x08, 0x0D, 0x08,
+    0x0C, 0x08, 0x0B, 0x08, 0x0A, 0x08, 0x09, 0x09, 0x08, 0x09, 0x06, 0x0A,
+    0x05, 0x0A, 0x04, 0x0B, 0x03, 0x0B, 0x02, 0x0B, 0x01, 0x0B, 0x00, 0x0B,
+    0xFF, 0x0C, 0xFE, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C,
+    0xFB, 0x0B, 0xFB, 0x0A, 0xFA, 0x0A, 0xFA, 0x09, 0xF9, 0x08, 0xF9, 0x06,
+    0xF8, 0x05, 0xF8, 0x03, 0xF7, 0x02, 0x00, 0x00,
+    0xD8, 0x33, 0x26, 0x01, 0x25, 0x01, 0x24, 0x01, 0x23, 0x01, 0x22, 0x01,
+    0x21, 0x02, 0x20, 0x02, 0x1E, 0x03, 0x1D, 0x03, 0x1C, 0x03, 0x1B, 0x04,
+    0x1A, 0x04, 0x19, 0x04, 0x18, 0x04, 0x16, 0x05, 0x15, 0x06, 0x14, 0x06,
+    0x13, 0x06, 0x12, 0x06, 0x11, 0x06, 0x10, 0x07, 0x0F, 0x07, 0x0D, 0x08,
+    0x0C, 0x08, 0x0B, 0x09, 0x0A, 0x09, 0x09, 0x09, 0x08, 0x09, 0x07, 0x09,
+    0x05, 0x0B, 0x04, 0x0B, 0x03, 0x0B, 0x02, 0x0B, 0x01, 0x0B, 0x00, 0x0C,
+    0xFF, 0x0C, 0xFE, 0x0C, 0xFD, 0x0C, 0xFC, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C,
+    0xFB, 0x0B, 0xFA, 0x0B, 0xFA, 0x0A, 0xFA, 0x09, 0xF9, 0x08, 0xF9, 0x06,
+    0xF8, 0x05, 0xF8, 0x03, 0xF7, 0x02, 0x00, 0x00,
+    0xD8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x25, 0x01, 0x24, 0x01, 0x22, 0x02,
+    0x21, 0x02, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x03, 0x1D, 0x03, 0x1C, 0x03,
+    0x1A, 0x04, 0x19, 0x04, 0x18, 0x05, 0x17, 0x05, 0x16, 0x05, 0x15, 0x05,
+    0x13, 0x06, 0x12, 0x07, 0x11, 0x07, 0x10, 0x07, 0x0F, 0x07, 0x0E, 0x07,
+    0x0D, 0x08, 0x0B, 0x09, 0x0A, 0x09, 0x09, 0x09, 0x08, 0x09, 0x07, 0x0A,
+    0x06, 0x0A, 0x04, 0x0B, 0x03, 0x0B, 0x02, 0x0B, 0x01, 0x0C, 0x00, 0x0C,
+    0xFF, 0x0C, 0xFE, 0x0C, 0xFD, 0x0C, 0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C,
+    0xFB, 0x0B, 0xFA, 0x0B, 0xFA, 0x0A, 0xFA, 0x09, 0xF9, 0x08, 0xF9, 0x06,
+    0xF8, 0x05, 0xF8, 0x03, 0xF7, 0x02, 0x00, 0x00,
+    0xD9, 0x31, 0x00, 0x00, 0x25, 0x01, 0x24, 0x01, 0x23, 0x02, 0x22, 0x02,
+    0x21, 0x02, 0x20, 0x02, 0x1E, 0x03, 0x1D, 0x03, 0x1C, 0x04, 0x1B, 0x04,
+    0x1A, 0x04, 0x19, 0x04, 0x17, 0x05, 0x16, 0x05, 0x15, 0x06, 0x14, 0x06,
+    0x13, 0x06, 0x11, 0x07, 0x10, 0x07, 0x0F, 0x08, 0x0E, 0x08, 0x0D, 0x08,
+    0x0C, 0x08, 0x0A, 0x09, 0x09, 0x09, 0x08, 0x0A, 0x07, 0x0A, 0x06, 0x0A,
+    0x05, 0x0A, 0x03, 0x0B, 0x02, 0x0C, 0x01, 0x0C, 0x00, 0x0C, 0xFF, 0x0C,
+    0xFE, 0x0C, 0xFD, 0x0C, 0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B,
+    0xFA, 0x0B, 0xFA, 0x0A, 0xF9, 0x0A, 0xF9, 0x08, 0xF9, 0x06, 0xF8, 0x05,
+    0xF8, 0x03, 0xF7, 0x02,
+    0xD9, 0x31, 0x27, 0x01, 0x26, 0x01, 0x25, 0x01, 0x24, 0x01, 0x23, 0x01,
+    0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1D, 0x03, 0x1B, 0x04,
+    0x1A, 0x04, 0x19, 0x05, 0x18, 0x05, 0x17, 0x05, 0x15, 0x06, 0x14, 0x06,
+    0x13, 0x06, 0x12, 0x07, 0x11, 0x07, 0x0F, 0x08, 0x0E, 0x08, 0x0D, 0x08,
+    0x0C, 0x08, 0x0B, 0x09, 0x09, 0x0A, 0x08, 0x0A, 0x07, 0x0A, 0x06, 0x0A,
+    0x05, 0x0A, 0x04, 0x0B, 0x02, 0x0C, 0x01, 0x0C, 0x00, 0x0C, 0xFF, 0x0C,
+    0xFE, 0x0C, 0xFD, 0x0C, 0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B,
+    0xFA, 0x0B, 0xFA, 0x0A, 0xF9, 0x0A, 0xF9, 0x08, 0xF8, 0x07, 0xF8, 0x05,
+    0xF8, 0x03, 0xF7, 0x01,
+    0xD9, 0x31, 0x00, 0x00, 0x00, 0x00, 0x26, 0x01, 0x24, 0x02, 0x23, 0x02,
+    0x22, 0x02, 0x21, 0x02, 0x20, 0x02, 0x1E, 0x03, 0x1D, 0x04, 0x1C, 0x04,
+    0x1B, 0x04, 0x1A, 0x04, 0x18, 0x05, 0x17, 0x05, 0x16, 0x05, 0x15, 0x06,
+    0x13, 0x07, 0x12, 0x07, 0x11, 0x07, 0x10, 0x07, 0x0F, 0x07, 0x0D, 0x09,
+    0x0C, 0x09, 0x0B, 0x09, 0x0A, 0x09, 0x08, 0x0A, 0x07, 0x0A, 0x06, 0x0A,
+    0x05, 0x0B, 0x04, 0x0B, 0x02, 0x0C, 0x01, 0x0C, 0x00, 0x0C, 0xFF, 0x0C,
+    0xFE, 0x0C, 0xFD, 0x0D, 0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B,
+    0xFA, 0x0B, 0xFA, 0x0A, 0xF9, 0x0A, 0xF9, 0x08, 0xF8, 0x07, 0xF8, 0x05,
+    0xF7, 0x03, 0xF7, 0x01,
+    0xDA, 0x30, 0x00, 0x00, 0x26, 0x01, 0x25, 0x01, 0x24, 0x01, 0x23, 0x02,
+    0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1D, 0x03, 0x1B, 0x04,
+    0x1A, 0x04, 0x19, 0x05, 0x18, 0x05, 0x16, 0x06, 0x15, 0x06, 0x14, 0x06,
+    0x13, 0x06, 0x11, 0x07, 0x10, 0x08, 0x0F, 0x08, 0x0E, 0x08, 0x0C, 0x09,
+    0x0B, 0x09, 0x0A, 0x09, 0x09, 0x09, 0x07, 0x0A, 0x06, 0x0B, 0x05, 0x0B,
+    0x04, 0x0B, 0x02, 0x0C, 0x01, 0x0C, 0x00, 0x0C, 0xFF, 0x0C, 0xFE, 0x0D,
+    0xFD, 0x0D, 0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0B,
+    0xFA, 0x0A, 0xF9, 0x0A, 0xF9, 0x08, 0xF8, 0x07, 0xF8, 0x04, 0xF7, 0x03,
+    0xF7, 0x01,
+    0xDA, 0x30, 0x28, 0x01, 0x27, 0x01, 0x26, 0x01, 0x25, 0x01, 0x23, 0x02,
+    0x22, 0x02, 0x21, 0x02, 0x20, 0x02, 0x1E, 0x04, 0x1D, 0x04, 0x1C, 0x04,
+    0x1B, 0x04, 0x19, 0x05, 0x18, 0x05, 0x17, 0x05, 0x16, 0x05, 0x14, 0x07,
+    0x13, 0x07, 0x12, 0x07, 0x10, 0x08, 0x0F, 0x08, 0x0E, 0x08, 0x0D, 0x08,
+    0x0B, 0x09, 0x0A, 0x09, 0x09, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x05, 0x0B,
+    0x04, 0x0B, 0x03, 0x0B, 0x01, 0x0C, 0x00, 0x0C, 0xFF, 0x0D, 0xFE, 0x0D,
+    0xFD, 0x0D, 0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0B,
+    0xFA, 0x0A, 0xF9, 0x0A, 0xF9, 0x08, 0xF8, 0x07, 0xF8, 0x04, 0xF7, 0x03,
+    0xF7, 0x01,
+    0xDA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x02, 0x24, 0x02,
+    0x23, 0x02, 0x22, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1C, 0x04,
+    0x1B, 0x04, 0x1A, 0x05, 0x19, 0x05, 0x17, 0x06, 0x16, 0x06, 0x15, 0x06,
+    0x13, 0x07, 0x12, 0x07, 0x11, 0x07, 0x10, 0x07, 0x0E, 0x08, 0x0D, 0x09,
+    0x0C, 0x09, 0x0A, 0x0A, 0x09, 0x0A, 0x08, 0x0A, 0x07, 0x0A, 0x05, 0x0B,
+    0x04, 0x0B, 0x03, 0x0B, 0x01, 0x0C, 0x00, 0x0D, 0xFF, 0x0D, 0xFE, 0x0D,
+    0xFD, 0x0D, 0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0B,
+    0xFA, 0x0A, 0xF9, 0x0A, 0xF9, 0x08, 0xF8, 0x06, 0xF8, 0x04, 0xF7, 0x03,
+    0xF7, 0x01,
+    0xDB, 0x2F, 0x00, 0x00, 0x27, 0x01, 0x26, 0x01, 0x25, 0x01, 0x23, 0x02,
+    0x22, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1E, 0x04, 0x1D, 0x04, 0x1C, 0x04,
+    0x1A, 0x05, 0x19, 0x05, 0x18, 0x05, 0x16, 0x06, 0x15, 0x06, 0x14, 0x06,
+    0x12, 0x08, 0x11, 0x08, 0x10, 0x08, 0x0F, 0x08, 0x0D, 0x09, 0x0C, 0x09,
+    0x0B, 0x09, 0x09, 0x0A, 0x08, 0x0A, 0x07, 0x0A, 0x05, 0x0B, 0x04, 0x0B,
+    0x03, 0x0C, 0x01, 0x0D, 0x00, 0x0D, 0xFF, 0x0D, 0xFE, 0x0D, 0xFD, 0x0D,
+    0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0B, 0xFA, 0x0B,
+    0xF9, 0x0A, 0xF9, 0x08, 0xF8, 0x06, 0xF7, 0x05, 0xF7, 0x03, 0xF6, 0x01,
+    0xDB, 0x2F, 0x29, 0x01, 0x28, 0x01, 0x27, 0x01, 0x25, 0x02, 0x24, 0x02,
+    0x23, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1C, 0x04,
+    0x1B, 0x04, 0x1A, 0x05, 0x18, 0x06, 0x17, 0x06, 0x16, 0x06, 0x14, 0x07,
+    0x13, 0x07, 0x12, 0x07, 0x10, 0x08, 0x0F, 0x08, 0x0E, 0x08, 0x0C, 0x09,
+    0x0B, 0x09, 0x0A, 0x09, 0x08, 0x0A, 0x07, 0x0B, 0x06, 0x0B, 0x04, 0x0C,
+    0x03, 0x0C, 0x02, 0x0C, 0x00, 0x0D, 0xFF, 0x0D, 0xFE, 0x0D, 0xFD, 0x0D,
+    0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0B, 0xFA, 0x0B,
+    0xF9, 0x0A, 0xF8, 0x09, 0xF8, 0x06, 0xF7, 0x05, 0xF7, 0x02, 0xF6, 0x01,
+    0xDB, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0x25, 0x02,
+    0x24, 0x02, 0x22, 0x03, 0x21, 0x03, 0x1F, 0x04, 0x1E, 0x04, 0x1D, 0x04,
+    0x1B, 0x05, 0x1A, 0x05, 0x19, 0x05, 0x17, 0x06, 0x16, 0x06, 0x15, 0x06,
+    0x13, 0x07, 0x12, 0x07, 0x11, 0x07, 0x0F, 0x08, 0x0E, 0x08, 0x0C, 0x0A,
+    0x0B, 0x0A, 0x0A, 0x0A, 0x08, 0x0B, 0x07, 0x0B, 0x06, 0x0B, 0x04, 0x0C,
+    0x03, 0x0C, 0x02, 0x0C, 0x00, 0x0D, 0xFF, 0x0D, 0xFE, 0x0D, 0xFD, 0x0D,
+    0xFC, 0x0D, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0B, 0xF9, 0x0C,
+    0xF9, 0x0A, 0xF8, 0x09, 0xF8, 0x06, 0xF7, 0x05, 0xF7, 0x02, 0xF6, 0x01,
+    0xDC, 0x2E, 0x00, 0x00, 0x28, 0x01, 0x27, 0x01, 0x26, 0x01, 0x24, 0x02,
+    0x23, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1D, 0x04, 0x1C, 0x04,
+    0x1B, 0x04, 0x19, 0x06, 0x18, 0x06, 0x16, 0x07, 0x15, 0x07, 0x14, 0x07,
+    0x12, 0x08, 0x11, 0x08, 0x0F, 0x09, 0x0E, 0x09, 0x0D, 0x09, 0x0B, 0x0A,
+    0x0A, 0x0A, 0x09, 0x0A, 0x07, 0x0B, 0x06, 0x0B, 0x04, 0x0C, 0x03, 0x0C,
+    0x02, 0x0C, 0x00, 0x0D, 0xFF, 0x0D, 0xFE, 0x0D, 0xFD, 0x0D, 0xFC, 0x0D,
+    0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0B, 0xF9, 0x0C, 0xF9, 0x0A,
+    0xF8, 0x09, 0xF8, 0x06, 0xF7, 0x05, 0xF7, 0x02, 0x00, 0x00,
+    0xDC, 0x2E, 0x00, 0x00, 0x29, 0x01, 0x28, 0x01, 0x26, 0x02, 0x25, 0x02,
+    0x24, 0x02, 0x22, 0x03, 0x21, 0x03, 0x1F, 0x04, 0x1E, 0x04, 0x1C, 0x05,
+    0x1B, 0x05, 0x1A, 0x05, 0x18, 0x06, 0x17, 0x06, 0x15, 0x07, 0x14, 0x07,
+    0x13, 0x07, 0x11, 0x08, 0x10, 0x08, 0x0E, 0x09, 0x0D, 0x09, 0x0C, 0x09,
+    0x0A, 0x0A, 0x09, 0x0A, 0x07, 0x0B, 0x06, 0x0B, 0x05, 0x0B, 0x03, 0x0C,
+    0x02, 0x0C, 0x00, 0x0D, 0xFF, 0x0D, 0xFE, 0x0D, 0xFD, 0x0D, 0xFC, 0x0D,
+    0xFC, 0x0C, 0xFB, 0x0C, 0xFA, 0x0C, 0xFA, 0x0C, 0xF9, 0x0C, 0xF9, 0x0A,
+    0xF8, 0x09, 0xF8, 0x06, 0xF7, 0x04, 0xF6, 0x03, 0x00, 0x00,
+    0xDD, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x27, 0x01, 0x26, 0x01, 0x24, 0x02,
+    0x23, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1D, 0x04, 0x1C, 0x04,
+    0x1A, 0x05, 0x19, 0x05, 0x17, 0x06, 0x16, 0x06, 0x14, 0x07, 0x13, 0x07,
+    0x12, 0x07, 0x10, 0x08, 0x0F, 0x08, 0x0D, 0x09, 0x0C, 0x09, 0x0A, 0x0A,
+    0x09, 0x0A, 0x08, 0x0A, 0x06, 0x0B, 0x05, 0x0B, 0x03, 0x0D, 0x02, 0x0D,
+    0x00, 0x0E, 0xFF, 0x0E, 0xFE, 0x0E, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D,
+    0xFB, 0x0D, 0xFA, 0x0D, 0xFA, 0x0C, 0xF9, 0x0C, 0xF9, 0x0A, 0xF8, 0x09,
+    0xF8, 0x06, 0xF7, 0x04, 0xF6, 0x02,
+    0xDD, 0x2C, 0x00, 0x00, 0x29, 0x01, 0x28, 0x01, 0x26, 0x02, 0x25, 0x02,
+    0x24, 0x02, 0x22, 0x03, 0x21, 0x03, 0x1F, 0x04, 0x1E, 0x04, 0x1C, 0x05,
+    0x1B, 0x05, 0x19, 0x06, 0x18, 0x06, 0x16, 0x07, 0x15, 0x07, 0x13, 0x08,
+    0x12, 0x08, 0x11, 0x08, 0x0F, 0x09, 0x0E, 0x09, 0x0C, 0x0A, 0x0B, 0x0A,
+    0x09, 0x0B, 0x08, 0x0B, 0x06, 0x0C, 0x05, 0x0C, 0x03, 0x0D, 0x02, 0x0D,
+    0x00, 0x0E, 0xFF, 0x0E, 0xFE, 0x0E, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D,
+    0xFB, 0x0D, 0xFA, 0x0D, 0xFA, 0x0C, 0xF9, 0x0C, 0xF9, 0x0A, 0xF8, 0x09,
+    0xF7, 0x07, 0xF7, 0x04, 0xF6, 0x02,
+    0xDD, 0x2C, 0x00, 0x00, 0x2A, 0x01, 0x29, 0x01, 0x27, 0x02, 0x26, 0x02,
+    0x24, 0x03, 0x23, 0x03, 0x21, 0x04, 0x20, 0x04, 0x1E, 0x04, 0x1D, 0x04,
+    0x1B, 0x05, 0x1A, 0x05, 0x18, 0x06, 0x17, 0x06, 0x15, 0x07, 0x14, 0x07,
+    0x12, 0x08, 0x11, 0x08, 0x0F, 0x09, 0x0E, 0x09, 0x0C, 0x0A, 0x0B, 0x0A,
+    0x09, 0x0B, 0x08, 0x0B, 0x06, 0x0C, 0x05, 0x0C, 0x03, 0x0D, 0x02, 0x0D,
+    0x01, 0x0D, 0xFF, 0x0E, 0xFE, 0x0E, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D,
+    0xFB, 0x0D, 0xFA, 0x0D, 0xFA, 0x0C, 0xF9, 0x0C, 0xF9, 0x0A, 0xF8, 0x08,
+    0xF7, 0x07, 0xF7, 0x04, 0xF6, 0x02,
+    0xDE, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x28, 0x01, 0x26, 0x02, 0x25, 0x02,
+    0x23, 0x03, 0x22, 0x03, 0x20, 0x04, 0x1F, 0x04, 0x1D, 0x05, 0x1C, 0x05,
+    0x1A, 0x06, 0x19, 0x06, 0x17, 0x07, 0x16, 0x07, 0x14, 0x08, 0x13, 0x08,
+    0x11, 0x09, 0x10, 0x09, 0x0E, 0x09, 0x0D, 0x09, 0x0B, 0x0A, 0x0A, 0x0A,
+    0x08, 0x0B, 0x07, 0x0B, 0x05, 0x0C, 0x04, 0x0C, 0x02, 0x0D, 0x01, 0x0D,
+    0xFF, 0x0E, 0xFE, 0x0E, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D, 0xFB, 0x0D,
+    0xFA, 0x0D, 0xFA, 0x0C, 0xF9, 0x0C, 0xF8, 0x0B, 0xF8, 0x08, 0xF7, 0x06,
+    0xF7, 0x04, 0xF6, 0x02,
+    0xDE, 0x2B, 0x00, 0x00, 0x2A, 0x01, 0x29, 0x01, 0x27, 0x02, 0x26, 0x02,
+    0x24, 0x03, 0x23, 0x03, 0x21, 0x04, 0x20, 0x04, 0x1E, 0x05, 0x1C, 0x05,
+    0x1B, 0x05, 0x19, 0x06, 0x18, 0x06, 0x16, 0x07, 0x15, 0x07, 0x13, 0x08,
+    0x12, 0x08, 0x10, 0x09, 0x0F, 0x09, 0x0D, 0x0A, 0x0B, 0x0B, 0x0A, 0x0B,
+    0x08, 0x0C, 0x07, 0x0B, 0x05, 0x0C, 0x04, 0x0C, 0x02, 0x0D, 0x01, 0x0D,
+    0xFF, 0x0E, 0xFE, 0x0E, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D, 0xFB, 0x0D,
+    0xFA, 0x0D, 0xFA, 0x0C, 0xF9, 0x0C, 0xF8, 0x0B, 0xF8, 0x08, 0xF7, 0x06,
+    0xF6, 0x04, 0xF6, 0x01,
+    0xDE, 0x2B, 0x00, 0x00, 0x2B, 0x01, 0x2A, 0x01, 0x28, 0x02, 0x26, 0x02,
+    0x25, 0x02, 0x23, 0x03, 0x22, 0x03, 0x20, 0x04, 0x1F, 0x04, 0x1D, 0x05,
+    0x1B, 0x06, 0x1A, 0x06, 0x18, 0x07, 0x17, 0x07, 0x15, 0x08, 0x14, 0x07,
+    0x12, 0x08, 0x10, 0x09, 0x0F, 0x09, 0x0D, 0x0A, 0x0C, 0x0A, 0x0A, 0x0B,
+    0x09, 0x0B, 0x07, 0x0C, 0x05, 0x0D, 0x04, 0x0D, 0x02, 0x0D, 0x01, 0x0D,
+    0xFF, 0x0E, 0xFE, 0x0E, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D, 0xFB, 0x0D,
+    0xFA, 0x0D, 0xFA, 0x0C, 0xF9, 0x0C, 0xF8, 0x0B, 0xF8, 0x08, 0xF7, 0x06,
+    0xF6, 0x04, 0xF6, 0x01,
+    0xDF, 0x2A, 0x00, 0x00, 0x2A, 0x01, 0x29, 0x01, 0x27, 0x02, 0x26, 0x02,
+    0x24, 0x03, 0x22, 0x04, 0x21, 0x04, 0x1F, 0x05, 0x1E, 0x04, 0x1C, 0x05,
+    0x1A, 0x06, 0x19, 0x06, 0x17, 0x07, 0x16, 0x07, 0x14, 0x08, 0x12, 0x09,
+    0x11, 0x09, 0x0F, 0x0A, 0x0E, 0x09, 0x0C, 0x0A, 0x0A, 0x0B, 0x09, 0x0B,
+    0x07, 0x0C, 0x06, 0x0C, 0x04, 0x0D, 0x02, 0x0E, 0x01, 0x0E, 0xFF, 0x0E,
+    0xFE, 0x0E, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D, 0xFB, 0x0D, 0xFA, 0x0D,
+    0xFA, 0x0C, 0xF9, 0x0C, 0xF8, 0x0B, 0xF8, 0x08, 0xF7, 0x06, 0xF6, 0x04,
+    0xF6, 0x01,
+    0xDF, 0x2A, 0x00, 0x00, 0x2B, 0x01, 0x2A, 0x01, 0x28, 0x02, 0x26, 0x03,
+    0x25, 0x03, 0x23, 0x03, 0x22, 0x03, 0x20, 0x04, 0x1E, 0x05, 0x1D, 0x05,
+    0x1B, 0x06, 0x19, 0x07, 0x18, 0x07, 0x16, 0x07, 0x14, 0x08, 0x13, 0x08,
+    0x11, 0x09, 0x10, 0x09, 0x0E, 0x0A, 0x0C, 0x0B, 0x0B, 0x0B, 0x09, 0x0B,
+    0x07, 0x0C, 0x06, 0x0C, 0x04, 0x0D, 0x02, 0x0E, 0x01, 0x0E, 0xFF, 0x0F,
+    0xFE, 0x0F, 0xFD, 0x0E, 0xFC, 0x0E, 0xFC, 0x0D, 0xFB, 0x0D, 0xFA, 0x0D,
+    0xF9, 0x0D, 0xF9, 0x0C, 0xF8, 0x0B, 0xF7, 0x09, 0xF7, 0x06, 0xF6, 0x04,
+    0xF5, 0x01,
+    0xE0, 0x29, 0x2C, 0x01, 0x2B, 0x01, 0x29, 0x01, 0x27, 0x02, 0x26, 0x02,
+    0x24, 0x03, 0x22, 0x04, 0x21, 0x04, 0x1F, 0x05, 0x1D, 0x05, 0x1C, 0x05,
+    0x1A, 0x06, 0x18, 0x07, 0x17, 0x07, 0x15, 0x08, 0x13, 0x09, 0x12, 0x08,
+    0x10, 0x09, 0x0E, 0x0A, 0x0D, 0x0A, 0x0B, 0x0B, 0x09, 0x0C, 0x08, 0x0C,
+    0x06, 0x0C, 0x04, 0x0D, 0x02, 0x0E, 0x01, 0x0E, 0xFF, 0x0F, 0xFE, 0x0F,
+    0xFD, 0x0F, 0xFC, 0x0E, 0xFB, 0x0E, 0xFB, 0x0D, 0xFA, 0x0D, 0xF9, 0x0D,
+    0xF9, 0x0C, 0xF8, 0x0B, 0xF7, 0x09, 0xF7, 0x06, 0xF6, 0x03, 0xF5, 0x01,
+    0xE0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x01, 0x28, 0x02, 0x26, 0x03,
+    0x25, 0x03, 0x23, 0x03, 0x21, 0x04, 0x20, 0x04, 0x1E, 0x05, 0x1C, 0x06,
+    0x1A, 0x07, 0x19, 0x06, 0x17, 0x07, 0x15, 0x08, 0x14, 0x08, 0x12, 0x09,
+    0x10, 0x0A, 0x0F, 0x09, 0x0D, 0x0A, 0x0B, 0x0B, 0x09, 0x0C, 0x08, 0x0C,
+    0x06, 0x0D, 0x04, 0x0D, 0x03, 0x0D, 0x01, 0x0E, 0xFF, 0x0F, 0xFE, 0x0F,
+    0xFD, 0x0F, 0xFC, 0x0E, 0xFB, 0x0E, 0xFB, 0x0D, 0xFA, 0x0D, 0xF9, 0x0D,
+    0xF9, 0x0C, 0xF8, 0x0B, 0xF7, 0x09, 0xF7, 0x06, 0xF6, 0x03, 0xF5, 0x01,
+    0xE0, 0x29, 0x00, 0x00, 0x2C, 0x01, 0x2B, 0x01, 0x29, 0x02, 0x27, 0x02,
+    0x25, 0x03, 0x24, 0x03, 0x22, 0x04, 0x20, 0x05, 0x1F, 0x05, 0x1D, 0x05,
+    0x1B, 0x06, 0x19, 0x07, 0x18, 0x07, 0x16, 0x08, 0x14, 0x08, 0x12, 0x09,
+    0x11, 0x09, 0x0F, 0x0A, 0x0D, 0x0B, 0x0B, 0x0B, 0x0A, 0x0B, 0x08, 0x0C,
+    0x06, 0x0D, 0x04, 0x0E, 0x03, 0x0E, 0x01, 0x0E, 0xFF, 0x0F, 0xFE, 0x0F,
+    0xFD, 0x0F, 0xFC, 0x0F, 0xFB, 0x0E, 0xFB, 0x0D, 0xFA, 0x0D, 0xF9, 0x0D,
+    0xF9, 0x0C, 0xF8, 0x0B, 0xF7, 0x09, 0xF6, 0x06, 0xF6, 0x03, 0x00, 0x00,
+    0xE1, 0x27, 0x2D, 0x01, 0x2C, 0x01, 0x2A, 0x01, 0x28, 0x02, 0x26, 0x03,
+    0x25, 0x03, 0x23, 0x04, 0x21, 0x04, 0x1F, 0x05, 0x1D, 0x06, 0x1C, 0x06,
+    0x1A, 0x06, 0x18, 0x07, 0x16, 0x08, 0x15, 0x08, 0x13, 0x09, 0x11, 0x09,
+    0x0F, 0x0A, 0x0D, 0x0B, 0x0C, 0x0B, 0x0A, 0x0C, 0x08, 0x0C, 0x06, 0x0D,
+    0x05, 0x0D, 0x03, 0x0E, 0x01, 0x0F, 0xFF, 0x0F, 0xFE, 0x0F, 0xFD, 0x0F,
+    0xFC, 0x0F, 0xFB, 0x0F, 0xFB, 0x0D, 0xFA, 0x0D, 0xF9, 0x0D, 0xF9, 0x0C,
+    0xF8, 0x0B, 0xF7, 0x09, 0xF6, 0x06, 0xF6, 0x02,
+    0xE1, 0x27, 0x2E, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x29, 0x02, 0x27, 0x03,
+    0x25, 0x03, 0x23, 0x04, 0x22, 0x04, 0x20, 0x05, 0x1E, 0x05, 0x1C, 0x06,
+    0x1A, 0x07, 0x19, 0x07, 0x17, 0x08, 0x15, 0x08, 0x13, 0x09, 0x11, 0x0A,
+    0x10, 0x0A, 0x0E, 0x0A, 0x0C, 0x0B, 0x0A, 0x0C, 0x08, 0x0D, 0x06, 0x0D,
+    0x05, 0x0D, 0x03, 0x0E, 0x01, 0x0F, 0xFF, 0x10, 0xFE, 0x0F, 0xFD, 0x0F,
+    0xFC, 0x0F, 0xFB, 0x0F, 0xFB, 0x0D, 0xFA, 0x0D, 0xF9, 0x0D, 0xF8, 0x0D,
+    0xF8, 0x0B, 0xF7, 0x09, 0xF6, 0x06, 0xF6, 0x02,
+    0xE2, 0x26, 0x00, 0x00, 0x2C, 0x01, 0x2A, 0x02, 0x28, 0x02, 0x26, 0x03,
+    0x24, 0x04, 0x22, 0x05, 0x21, 0x04, 0x1F, 0x05, 0x1D, 0x06, 0x1B, 0x07,
+    0x19, 0x07, 0x17, 0x08, 0x15, 0x09, 0x14, 0x09, 0x12, 0x09, 0x10, 0x0A,
+    0x0E, 0x0B, 0x0C, 0x0C, 0x0A, 0x0C, 0x09, 0x0C, 0x07, 0x0D, 0x05, 0x0E,
+    0x03, 0x0E, 0x01, 0x0F, 0xFF, 0x10, 0xFE, 0x0F, 0xFD, 0x0F, 0xFC, 0x0F,
+    0xFB, 0x0F, 0xFB, 0x0D, 0xFA, 0x0D, 0xF9, 0x0D, 0xF8, 0x0D, 0xF8, 0x0B,
+    0xF7, 0x09, 0xF6, 0x06, 0xF5, 0x03,
+    0xE2, 0x26, 0x00, 0x00, 0x2D, 0x01, 0x2B, 0x01, 0x29, 0x02, 0x27, 0x03,
+    0x25, 0x03, 0x23, 0x04, 0x21, 0x05, 0x1F, 0x06, 0x1E, 0x05, 0x1C, 0x06,
+    0x1A, 0x07, 0x18, 0x08, 0x16, 0x08, 0x14, 0x09, 0x12, 0x0A, 0x10, 0x0A,
+    0x0E, 0x0B, 0x0D, 0x0B, 0x0B, 0x0C, 0x09, 0x0C, 0x07, 0x0D, 0x05, 0x0E,
+    0x03, 0x0E, 0x01, 0x0F, 0xFF, 0x10, 0xFE, 0x10, 0xFD, 0x0F, 0xFC, 0x0F,
+    0xFB, 0x0F, 0xFB, 0x0E, 0xFA, 0x0D, 0xF9, 0x0D, 0xF8, 0x0D, 0xF8, 0x0B,
+    0xF7, 0x09, 0xF6, 0x06, 0xF5, 0x02,
+    0xE2, 0x26, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x01, 0x2A, 0x02, 0x28, 0x02,
+    0x26, 0x03, 0x24, 0x04, 0x22, 0x05, 0x20, 0x05, 0x1E, 0x06, 0x1C, 0x07,
+    0x1A, 0x07, 0x18, 0x08, 0x16, 0x09, 0x15, 0x08, 0x13, 0x09, 0x11, 0x0A,
+    0x0F, 0x0B, 0x0D, 0x0B, 0x0B, 0x0C, 0x09, 0x0D, 0x07, 0x0D, 0x05, 0x0E,
+    0x03, 0x0F, 0x01, 0x0F, 0xFF, 0x10, 0xFE, 0x10, 0xFD, 0x10, 0xFC, 0x0F,
+    0xFB, 0x0F, 0xFB, 0x0E, 0xFA, 0x0D, 0xF9, 0x0D, 0xF8, 0x0D, 0xF7, 0x0C,
+    0xF7, 0x09, 0xF6, 0x05, 0xF5, 0x02,
+    0xE3, 0x25, 0x00, 0x00, 0x2D, 0x01, 0x2B, 0x01, 0x29, 0x02, 0x27, 0x03,
+    0x25, 0x03, 0x23, 0x04, 0x21, 0x05, 0x1F, 0x06, 0x1D, 0x06, 0x1B, 0x07,
+    0x19, 0x08, 0x17, 0x08, 0x15, 0x09, 0x13, 0x0A, 0x11, 0x0A, 0x0F, 0x0B,
+    0x0D, 0x0C, 0x0B, 0x0C, 0x09, 0x0D, 0x07, 0x0E, 0x05, 0x0E, 0x03, 0x0F,
+    0x01, 0x10, 0xFF, 0x10, 0xFE, 0x10, 0xFD, 0x10, 0xFC, 0x0F, 0xFB, 0x0F,
+    0xFA, 0x0F, 0xFA, 0x0D, 0xF9, 0x0D, 0xF8, 0x0D, 0xF7, 0x0C, 0xF7, 0x09,
+    0xF6, 0x05, 0xF5, 0x02,
+    0xE3, 0x25, 0x00, 0x00, 0x2E, 0x01, 0x2C, 0x01, 0x2A, 0x02, 0x28, 0x03,
+    0x26, 0x03, 0x24, 0x04, 0x22, 0x04, 0x20, 0x05, 0x1E, 0x06, 0x1C, 0x06,
+    0x1A, 0x07, 0x18, 0x08, 0x16, 0x08, 0x14, 0x09, 0x12, 0x0A, 0x0F, 0x0B,
+    0x0D, 0x0C, 0x0B, 0x0D, 0x09, 0x0D, 0x07, 0x0E, 0x05, 0x0F, 0x03, 0x0F,
+    0x01, 0x10, 0xFF, 0x11, 0xFE, 0x10, 0xFD, 0x10, 0xFC, 0x10, 0xFB, 0x0F,
+    0xFA, 0x0F, 0xFA, 0x0E, 0xF9, 0x0D, 0xF8, 0x0D, 0xF7, 0x0C, 0xF6, 0x0A,
+    0xF6, 0x05, 0xF5, 0x01,
+    0xE4, 0x24, 0x00, 0x00, 0x2D, 0x01, 0x2B, 0x02, 0x29, 0x02, 0x27, 0x03,
+    0x24, 0x04, 0x22, 0x05, 0x20, 0x06, 0x1E, 0x06, 0x1C, 0x07, 0x1A, 0x08,
+    0x18, 0x08, 0x16, 0x09, 0x14, 0x0A, 0x12, 0x0A, 0x10, 0x0B, 0x0E, 0x0B,
+    0x0C, 0x0C, 0x0A, 0x0D, 0x08, 0x0D, 0x06, 0x0E, 0x04, 0x0F, 0x01, 0x10,
+    0xFF, 0x11, 0xFE, 0x10, 0xFD, 0x10, 0xFC, 0x10, 0xFB, 0x0F, 0xFA, 0x0F,
+    0xFA, 0x0E, 0xF9, 0x0D, 0xF8, 0x0D, 0xF7, 0x0C, 0xF6, 0x0A, 0xF5, 0x06,
+    0xF5, 0x01,
+    0xE4, 0x24, 0x00, 0x00, 0x2E, 0x01, 0x2C, 0x01, 0x2A, 0x02, 0x27, 0x04,
+    0x25, 0x04, 0x23, 0x05, 0x21, 0x05, 0x1F, 0x06, 0x1D, 0x07, 0x1B, 0x07,
+    0x19, 0x08, 0x17, 0x08, 0x14, 0x0A, 0x12, 0x0B, 0x10, 0x0B, 0x0E, 0x0C,
+    0x0C, 0x0C, 0x0A, 0x0D, 0x08, 0x0E, 0x06, 0x0E, 0x04, 0x0F, 0x02, 0x0F,
+    0xFF, 0x11, 0xFE, 0x11, 0xFD, 0x10, 0xFC, 0x10, 0xFB, 0x0F, 0xFA, 0x0F,
+    0xFA, 0x0E, 0xF9, 0x0D, 0xF8, 0x0D, 0xF7, 0x0C, 0xF6, 0x09, 0xF5, 0x05,
+    0x00, 0x00,
+    0xE4, 0x24, 0x00, 0x00, 0x2F, 0x01, 0x2D, 0x01, 0x2B, 0x02, 0x28, 0x03,
+    0x26, 0x04, 0x24, 0x04, 0x22, 0x05, 0x20, 0x06, 0x1E, 0x06, 0x1B, 0x08,
+    0x19, 0x08, 0x17, 0x09, 0x15, 0x0A, 0x13, 0x0A, 0x11, 0x0B, 0x0F, 0x0B,
+    0x0C, 0x0D, 0x0A, 0x0D, 0x08, 0x0E, 0x06, 0x0F, 0x04, 0x0F, 0x02, 0x10,
+    0xFF, 0x11, 0xFE, 0x11, 0xFD, 0x10, 0xFC, 0x10, 0xFB, 0x10, 0xFA, 0x0F,
+    0xF9, 0x0F, 0xF9, 0x0D, 0xF8, 0x0D, 0xF7, 0x0C, 0xF6, 0x09, 0xF5, 0x05,
+    0x00, 0x00,
+    0xE5, 0x22, 0x00, 0x00, 0x2E, 0x01, 0x2C, 0x02, 0x29, 0x03, 0x27, 0x04,
+    0x25, 0x04, 0x23, 0x05, 0x21, 0x05, 0x1E, 0x07, 0x1C, 0x07, 0x1A, 0x08,
+    0x18, 0x08, 0x16, 0x09, 0x13, 0x0B, 0x11, 0x0B, 0x0F, 0x0C, 0x0D, 0x0C,
+    0x0A, 0x0E, 0x08, 0x0E, 0x06, 0x0F, 0x04, 0x0F, 0x02, 0x10, 0xFF, 0x12,
+    0xFE, 0x11, 0xFD, 0x11, 0xFC, 0x10, 0xFB, 0x10, 0xFA, 0x0F, 0xF9, 0x0F,
+    0xF9, 0x0D, 0xF8, 0x0D, 0xF7, 0x0C, 0xF6, 0x09, 0xF5, 0x04,
+    0xE5, 0x22, 0x00, 0x00, 0x2F, 0x01, 0x2D, 0x01, 0x2A, 0x03, 0x28, 0x03,
+    0x26, 0x04, 0x24, 0x04, 0x21, 0x06, 0x1F, 0x06, 0x1D, 0x07, 0x1B, 0x07,
+    0x18, 0x09, 0x16, 0x0A, 0x14, 0x0A, 0x12, 0x0B, 0x0F, 0x0C, 0x0D, 0x0D,
+    0x0B, 0x0D, 0x09, 0x0E, 0x06, 0x0F, 0x04, 0x10, 0x02, 0x10, 0xFF, 0x12,
+    0xFE, 0x11, 0xFD, 0x11, 0xFC, 0x10, 0xFB, 0x10, 0xFA, 0x0F, 0xF9, 0x0F,
+    0xF8, 0x0E, 0xF8, 0x0D, 0xF7, 0x0C, 0xF6, 0x09, 0xF5, 0x04,
+    0xE6, 0x21, 0x30, 0x01, 0x2E, 0x01, 0x2B, 0x03, 0x29, 0x03, 0x27, 0x04,
+    0x24, 0x05, 0x22, 0x06, 0x20, 0x06, 0x1E, 0x07, 0x1B, 0x08, 0x19, 0x09,
+    0x17, 0x09, 0x14, 0x0B, 0x12, 0x0B, 0x10, 0x0C, 0x0D, 0x0D, 0x0B, 0x0E,
+    0x09, 0x0E, 0x06, 0x10, 0x04, 0x10, 0x02, 0x11, 0x00, 0x11, 0xFE, 0x12,
+    0xFD, 0x11, 0xFC, 0x11, 0xFB, 0x10, 0xFA, 0x0F, 0xF9, 0x0F, 0xF8, 0x0E,
+    0xF7, 0x0E, 0xF7, 0x0C, 0xF6, 0x09, 0xF5, 0x04,
+    0xE6, 0x21, 0x00, 0x00, 0x2F, 0x01, 0x2D, 0x01, 0x2A, 0x03, 0x28, 0x03,
+    0x25, 0x05, 0x23, 0x05, 0x21, 0x06, 0x1E, 0x07, 0x1C, 0x08, 0x1A, 0x08,
+    0x17, 0x0A, 0x15, 0x0A, 0x12, 0x0C, 0x10, 0x0C, 0x0E, 0x0C, 0x0B, 0x0E,
+    0x09, 0x0E, 0x07, 0x0F, 0x04, 0x10, 0x02, 0x11, 0x00, 0x11, 0xFE, 0x12,
+    0xFD, 0x11, 0xFC, 0x11, 0xFB, 0x10, 0xFA, 0x10, 0xF9, 0x0F, 0xF8, 0x0F,
+    0xF7, 0x0E, 0xF6, 0x0D, 0xF6, 0x09, 0xF5, 0x03,
+    0xE7, 0x20, 0x30, 0x01, 0x2E, 0x01, 0x2B, 0x03, 0x29, 0x03, 0x26, 0x05,
+    0x24, 0x05, 0x22, 0x05, 0x1F, 0x07, 0x1D, 0x07, 0x1A, 0x09, 0x18, 0x09,
+    0x15, 0x0B, 0x13, 0x0B, 0x11, 0x0C, 0x0E, 0x0D, 0x0C, 0x0D, 0x09, 0x0F,
+    0x07, 0x0F, 0x04, 0x11, 0x02, 0x11, 0x00, 0x12, 0xFE, 0x12, 0xFD, 0x11,
+    0xFC, 0x11, 0xFB, 0x10, 0xFA, 0x10, 0xF9, 0x0F, 0xF8, 0x0F, 0xF7, 0x0E,
+    0xF6, 0x0D, 0xF5, 0x0A, 0xF5, 0x02,
+    0xE7, 0x20, 0x31, 0x01, 0x2F, 0x01, 0x2C, 0x03, 0x2A, 0x03, 0x27, 0x04,
+    0x25, 0x05, 0x22, 0x06, 0x20, 0x07, 0x1D, 0x08, 0x1B, 0x08, 0x18, 0x0A,
+    0x16, 0x0A, 0x13, 0x0C, 0x11, 0x0C, 0x0F, 0x0C, 0x0C, 0x0E, 0x0A, 0x0E,
+    0x07, 0x10, 0x05, 0x10, 0x02, 0x11, 0x00, 0x12, 0xFE, 0x12, 0xFD, 0x12,
+    0xFC, 0x11, 0xFB, 0x10, 0xFA, 0x10, 0xF9, 0x0F, 0xF8, 0x0F, 0xF7, 0x0E,
+    0xF6, 0x0D, 0xF5, 0x0A, 0xF4, 0x03,
+    0xE8, 0x1F, 0x30, 0x01, 0x2E, 0x01, 0x2B, 0x03, 0x28, 0x04, 0x26, 0x05,
+    0x23, 0x06, 0x21, 0x06, 0x1E, 0x08, 0x1C, 0x08, 0x19, 0x09, 0x17, 0x0A,
+    0x14, 0x0B, 0x11, 0x0D, 0x0F, 0x0D, 0x0C, 0x0E, 0x0A, 0x0F, 0x07, 0x10,
+    0x05, 0x10, 0x02, 0x12, 0x00, 0x12, 0xFE, 0x13, 0xFD, 0x12, 0xFC, 0x11,
+    0xFB, 0x11, 0xFA, 0x10, 0xF9, 0x0F, 0xF8, 0x0F, 0xF7, 0x0E, 0xF6, 0x0E,
+    0xF5, 0x09, 0xF4, 0x02,
+    0xE8, 0x1F, 0x31, 0x01, 0x2F, 0x01, 0x2C, 0x03, 0x2A, 0x03, 0x27, 0x04,
+    0x24, 0x06, 0x22, 0x06, 0x1F, 0x07, 0x1C, 0x09, 0x1A, 0x09, 0x17, 0x0A,
+    0x15, 0x0B, 0x12, 0x0C, 0x0F, 0x0D, 0x0D, 0x0E, 0x0A, 0x0F, 0x07, 0x10,
+    0x05, 0x11, 0x02, 0x12, 0x00, 0x12, 0xFE, 0x13, 0xFD, 0x12, 0xFC, 0x11,
+    0xFB, 0x11, 0xFA, 0x10, 0xF9, 0x0F, 0xF8, 0x0F, 0xF7, 0x0E, 0xF6, 0x0E,
+    0xF5, 0x09, 0xF4, 0x01,
+    0xE8, 0x1F, 0x00, 0x00, 0x30, 0x01, 0x2D, 0x02, 0x2B, 0x03, 0x28, 0x04,
+    0x25, 0x05, 0x23, 0x06, 0x20, 0x07, 0x1D, 0x08, 0x1B, 0x09, 0x18, 0x0A,
+    0x15, 0x0B, 0x12, 0x0D, 0x10, 0x0D, 0x0D, 0x0E, 0x0A, 0x0F, 0x08, 0x10,
+    0x05, 0x11, 0x02, 0x12, 0x00, 0x13, 0xFE, 0x13, 0xFD, 0x12, 0xFC, 0x12,
+    0xFB, 0x11, 0xFA, 0x10, 0xF9, 0x10, 0xF8, 0x0F, 0xF7, 0x0E, 0xF6, 0x0E,
+    0xF5, 0x09, 0x00, 0x00,
+    0xE9, 0x1D, 0x31, 0x01, 0x2F, 0x01, 0x2C, 0x03, 0x29, 0x04, 0x26, 0x05,
+    0x24, 0x05, 0x21, 0x07, 0x1E, 0x08, 0x1B, 0x09, 0x19, 0x0A, 0x16, 0x0B,
+    0x13, 0x0C, 0x10, 0x0D, 0x0D, 0x0F, 0x0B, 0x0F, 0x08, 0x10, 0x05, 0x12,
+    0x02, 0x13, 0x00, 0x13, 0xFE, 0x13, 0xFD, 0x13, 0xFC, 0x12, 0xFB, 0x11,
+    0xFA, 0x10, 0xF9, 0x10, 0xF8, 0x0F, 0xF7, 0x0E, 0xF6, 0x0E, 0xF5, 0x09,
+    0xE9, 0x1D, 0x00, 0x00, 0x30, 0x01, 0x2D, 0x03, 0x2A, 0x04, 0x27, 0x05,
+    0x25, 0x05, 0x22, 0x07, 0x1F, 0x08, 0x1C, 0x09, 0x19, 0x0A, 0x16, 0x0B,
+    0x14, 0x0C, 0x11, 0x0D, 0x0E, 0x0E, 0x0B, 0x0F, 0x08, 0x11, 0x05, 0x12,
+    0x03, 0x12, 0x00, 0x13, 0xFE, 0x14, 0xFD, 0x13, 0xFC, 0x12, 0xFB, 0x11,
+    0xFA, 0x11, 0xF9, 0x10, 0xF8, 0x0F, 0xF7, 0x0E, 0xF6, 0x0E, 0xF5, 0x08,
+    0xEA, 0x1C, 0x31, 0x01, 0x2E, 0x02, 0x2C, 0x03, 0x29, 0x04, 0x26, 0x05,
+    0x23, 0x06, 0x20, 0x07, 0x1D, 0x09, 0x1A, 0x0A, 0x17, 0x0B, 0x14, 0x0C,
+    0x11, 0x0E, 0x0E, 0x0F, 0x0B, 0x10, 0x08, 0x11, 0x06, 0x11, 0x03, 0x13,
+    0x00, 0x14, 0xFE, 0x14, 0xFD, 0x13, 0xFC, 0x12, 0xFB, 0x12, 0xFA, 0x11,
+    0xF9, 0x10, 0xF8, 0x0F, 0xF7, 0x0E, 0xF5, 0x0F, 0xF4, 0x09,
+    0xEA, 0x1C, 0x00, 0x00, 0x30, 0x01, 0x2D, 0x03, 0x2A, 0x04, 0x27, 0x05,
+    0x24, 0x06, 0x21, 0x07, 0x1E, 0x08, 0x1B, 0x0A, 0x18, 0x0B, 0x15, 0x0C,
+    0x12, 0x0D, 0x0F, 0x0E, 0x0C, 0x0F, 0x09, 0x11, 0x06, 0x12, 0x03, 0x13,
+    0x00, 0x14, 0xFE, 0x14, 0xFD, 0x13, 0xFC, 0x13, 0xFB, 0x12, 0xFA, 0x11,
+    0xF9, 0x10, 0xF7, 0x10, 0xF6, 0x0F, 0xF5, 0x0F, 0xF4, 0x08,
+    0xEB, 0x1B, 0x31, 0x01, 0x2E, 0x03, 0x2B, 0x04, 0x28, 0x05, 0x25, 0x06,
+    0x22, 0x07, 0x1F, 0x08, 0x1C, 0x09, 0x19, 0x0A, 0x15, 0x0D, 0x12, 0x0E,
+    0x0F, 0x0F, 0x0C, 0x10, 0x09, 0x11, 0x06, 0x12, 0x03, 0x13, 0x00, 0x14,
+    0xFE, 0x15, 0xFD, 0x14, 0xFC, 0x13, 0xFB, 0x12, 0xFA, 0x11, 0xF8, 0x11,
+    0xF7, 0x10, 0xF6, 0x0F, 0xF5, 0x0F, 0xF4, 0x08,
+    0xEB, 0x1B, 0x00, 0x00, 0x30, 0x02, 0x2C, 0x04, 0x29, 0x05, 0x26, 0x06,
+    0x23, 0x07, 0x20, 0x08, 0x1D, 0x09, 0x19, 0x0B, 0x16, 0x0C, 0x13, 0x0D,
+    0x10, 0x0E, 0x0D, 0x0F, 0x09, 0x12, 0x06, 0x13, 0x03, 0x14, 0x00, 0x15,
+    0xFE, 0x15, 0xFD, 0x14, 0xFC, 0x13, 0xFB, 0x12, 0xF9, 0x12, 0xF8, 0x11,
+    0xF7, 0x10, 0xF6, 0x10, 0xF5, 0x0F, 0xF4, 0x07,
+    0xEC, 0x1A, 0x31, 0x02, 0x2E, 0x03, 0x2B, 0x04, 0x27, 0x06, 0x24, 0x07,
+    0x21, 0x08, 0x1D, 0x0A, 0x1A, 0x0B, 0x17, 0x0C, 0x14, 0x0D, 0x10, 0x0F,
+    0x0D, 0x10, 0x0A, 0x11, 0x06, 0x13, 0x03, 0x14, 0x00, 0x15, 0xFE, 0x15,
+    0xFD, 0x14, 0xFC, 0x13, 0xFB, 0x12, 0xF9, 0x12, 0xF8, 0x11, 0xF7, 0x11,
+    0xF6, 0x10, 0xF5, 0x0F, 0xF4, 0x05,
+    0xEC, 0x1A, 0x33, 0x01, 0x2F, 0x03, 0x2C, 0x04, 0x29, 0x05, 0x25, 0x07,
+    0x22, 0x08, 0x1E, 0x0A, 0x1B, 0x0B, 0x18, 0x0C, 0x14, 0x0E, 0x11, 0x0F,
+    0x0D, 0x11, 0x0A, 0x12, 0x07, 0x13, 0x03, 0x15, 0x00, 0x16, 0xFE, 0x16,
+    0xFD, 0x15, 0xFC, 0x14, 0xFA, 0x14, 0xF9, 0x13, 0xF8, 0x12, 0xF7, 0x11,
+    0xF6, 0x10, 0xF5, 0x0F, 0xF4, 0x04,
+    0xEC, 0x1A, 0x00, 0x00, 0x31, 0x02, 0x2E, 0x03, 0x2A, 0x05, 0x26, 0x06,
+    0x23, 0x07, 0x1F, 0x09, 0x1C, 0x0A, 0x18, 0x0C, 0x15, 0x0D, 0x11, 0x0F,
+    0x0E, 0x10, 0x0A, 0x12, 0x07, 0x13, 0x03, 0x15, 0x00, 0x16, 0xFE, 0x16,
+    0xFD, 0x15, 0xFC, 0x14, 0xFA, 0x14, 0xF9, 0x13, 0xF8, 0x12, 0xF7, 0x11,
+    0xF6, 0x10, 0xF5, 0x0F, 0xF3, 0x01,
+    0xED, 0x18, 0x33, 0x01, 0x2F, 0x03, 0x2B, 0x05, 0x28, 0x05, 0x24, 0x07,
+    0x21, 0x08, 0x1D, 0x0A, 0x19, 0x0C, 0x16, 0x0D, 0x12, 0x0F, 0x0E, 0x11,
+    0x0B, 0x12, 0x07, 0x14, 0x04, 0x15, 0x00, 0x16, 0xFE, 0x16, 0xFD, 0x15,
+    0xFC, 0x14, 0xFA, 0x14, 0xF9, 0x13, 0xF8, 0x12, 0xF7, 0x11, 0xF6, 0x10,
+    0xF4, 0x10,
+    0xED, 0x18, 0x00, 0x00, 0x31, 0x02, 0x2D, 0x04, 0x29, 0x05, 0x26, 0x06,
+    0x22, 0x08, 0x1E, 0x0A, 0x1A, 0x0C, 0x16, 0x0E, 0x13, 0x0F, 0x0F, 0x10,
+    0x0B, 0x12, 0x07, 0x14, 0x04, 0x15, 0x00, 0x17, 0xFE, 0x17, 0xFD, 0x16,
+    0xFC, 0x15, 0xFA, 0x14, 0xF9, 0x13, 0xF8, 0x12, 0xF7, 0x11, 0xF6, 0x10,
+    0xF4, 0x10,
+    0xEE, 0x17, 0x33, 0x01, 0x2F, 0x03, 0x2B, 0x04, 0x27, 0x06, 0x23, 0x08,
+    0x1F, 0x0A, 0x1B, 0x0C, 0x17, 0x0D, 0x13, 0x0F, 0x10, 0x10, 0x0C, 0x12,
+    0x08, 0x14, 0x04, 0x16, 0x00, 0x17, 0xFE, 0x17, 0xFD, 0x16, 0xFB, 0x16,
+    0xFA, 0x15, 0xF9, 0x13, 0xF8, 0x12, 0xF7, 0x11, 0xF5, 0x11, 0xF4, 0x10,
+    0xEE, 0x17, 0x00, 0x00, 0x30, 0x03, 0x2C, 0x04, 0x28, 0x06, 0x24, 0x08,
+    0x20, 0x0A, 0x1C, 0x0C, 0x18, 0x0D, 0x14, 0x0F, 0x10, 0x11, 0x0C, 0x13,
+    0x08, 0x14, 0x04, 0x16, 0x00, 0x18, 0xFE, 0x18, 0xFD, 0x16, 0xFB, 0x16,
+    0xFA, 0x15, 0xF9, 0x14, 0xF8, 0x12, 0xF6, 0x12, 0xF5, 0x11, 0xF4, 0x10,
+    0xEF, 0x16, 0x32, 0x02, 0x2E, 0x04, 0x2A, 0x05, 0x26, 0x07, 0x22, 0x09,
+    0x1D, 0x0B, 0x19, 0x0D, 0x15, 0x0F, 0x11, 0x11, 0x0D, 0x12, 0x08, 0x15,
+    0x04, 0x17, 0x00, 0x18, 0xFE, 0x18, 0xFD, 0x17, 0xFB, 0x17, 0xFA, 0x15,
+    0xF9, 0x14, 0xF8, 0x13, 0xF6, 0x12, 0xF5, 0x11, 0xF4, 0x10,
+    0xEF, 0x16, 0x34, 0x01, 0x30, 0x03, 0x2C, 0x04, 0x27, 0x07, 0x23, 0x09,
+    0x1F, 0x0A, 0x1A, 0x0D, 0x16, 0x0F, 0x11, 0x11, 0x0D, 0x13, 0x09, 0x15,
+    0x04, 0x17, 0x00, 0x19, 0xFE, 0x19, 0xFD, 0x17, 0xFB, 0x17, 0xFA, 0x16,
+    0xF9, 0x14, 0xF7, 0x14, 0xF6, 0x13, 0xF5, 0x11, 0xF4, 0x10,
+    0xF0, 0x15, 0x32, 0x02, 0x2E, 0x03, 0x29, 0x06, 0x24, 0x09, 0x20, 0x0A,
+    0x1B, 0x0D, 0x17, 0x0E, 0x12, 0x11, 0x0E, 0x13, 0x09, 0x15, 0x05, 0x17,
+    0x00, 0x19, 0xFE, 0x19, 0xFD, 0x18, 0xFB, 0x17, 0xFA, 0x16, 0xF9, 0x14,
+    0xF7, 0x14, 0xF6, 0x13, 0xF5, 0x11, 0xF3, 0x11,
+    0xF0, 0x15, 0x34, 0x01, 0x30, 0x03, 0x2B, 0x05, 0x26, 0x08, 0x21, 0x0A,
+    0x1D, 0x0C, 0x18, 0x0E, 0x13, 0x11, 0x0E, 0x13, 0x0A, 0x15, 0x05, 0x18,
+    0x00, 0x1A, 0xFE, 0x1A, 0xFD, 0x18, 0xFB, 0x18, 0xFA, 0x16, 0xF9, 0x15,
+    0xF7, 0x14, 0xF6, 0x13, 0xF5, 0x11, 0xF3, 0x11,
+    0xF1, 0x14, 0x32, 0x02, 0x2D, 0x04, 0x28, 0x07, 0x23, 0x09, 0x1E, 0x0C,
+    0x19, 0x0E, 0x14, 0x11, 0x0F, 0x13, 0x0A, 0x16, 0x05, 0x18, 0x00, 0x1B,
+    0xFE, 0x1A, 0xFD, 0x19, 0xFB, 0x18, 0xFA, 0x17, 0xF9, 0x15, 0xF7, 0x15,
+    0xF6, 0x13, 0xF4, 0x12, 0xF4, 0x10,
+    0xF1, 0x14, 0x34, 0x01, 0x2F, 0x04, 0x2A, 0x06, 0x24, 0x09, 0x1F, 0x0C,
+    0x1A, 0x0E, 0x15, 0x11, 0x10, 0x13, 0x0B, 0x15, 0x05, 0x19, 0x00, 0x1B,
+    0xFE, 0x1B, 0xFD, 0x19, 0xFB, 0x19, 0xFA, 0x17, 0xF8, 0x16, 0xF7, 0x15,
+    0xF6, 0x13, 0xF4, 0x13, 0xF5, 0x0F,
+    0xF2, 0x13, 0x31, 0x03, 0x2C, 0x05, 0x26, 0x09, 0x21, 0x0B, 0x1B, 0x0E,
+    0x16, 0x11, 0x11, 0x13, 0x0B, 0x16, 0x06, 0x19, 0x00, 0x1C, 0xFE, 0x1B,
+    0xFD, 0x1A, 0xFB, 0x19, 0xFA, 0x17, 0xF8, 0x17, 0xF7, 0x15, 0xF5, 0x14,
+    0xF4, 0x13, 0xF7, 0x0D,
+    0xF2, 0x13, 0x34, 0x01, 0x2E, 0x05, 0x28, 0x08, 0x23, 0x0A, 0x1D, 0x0D,
+    0x17, 0x11, 0x11, 0x14, 0x0C, 0x16, 0x06, 0x19, 0x00, 0x1D, 0xFE, 0x1C,
+    0xFD, 0x1A, 0xFB, 0x19, 0xFA, 0x18, 0xF8, 0x17, 0xF7, 0x15, 0xF5, 0x15,
+    0xF4, 0x13, 0xF8, 0x0C,
+    0xF2, 0x13, 0x00, 0x00, 0x31, 0x03, 0x2B, 0x06, 0x24, 0x0A, 0x1E, 0x0D,
+    0x18, 0x11, 0x12, 0x14, 0x0C, 0x17, 0x06, 0x1A, 0x00, 0x1D, 0xFE, 0x1D,
+    0xFD, 0x1B, 0xFB, 0x1A, 0xFA, 0x18, 0xF8, 0x17, 0xF7, 0x16, 0xF5, 0x15,
+    0xF4, 0x13, 0xF8, 0x0C,
+    0xF3, 0x12, 0x33, 0x02, 0x2D, 0x05, 0x27, 0x08, 0x20, 0x0D, 0x1A, 0x10,
+    0x13, 0x14, 0x0D, 0x17, 0x07, 0x1A, 0x00, 0x1E, 0xFE, 0x1D, 0xFD, 0x1B,
+    0xFB, 0x1A, 0xFA, 0x19, 0xF8, 0x18, 0xF7, 0x16, 0xF5, 0x15, 0xF3, 0x14,
+    0xF9, 0x0B,
+    0xF3, 0x12, 0x36, 0x01, 0x30, 0x04, 0x29, 0x08, 0x22, 0x0C, 0x1B, 0x10,
+    0x15, 0x13, 0x0E, 0x17, 0x07, 0x1B, 0x00, 0x1F, 0xFE, 0x1E, 0xFC, 0x1D,
+    0xFB, 0x1B, 0xF9, 0x1A, 0xF8, 0x18, 0xF6, 0x17, 0xF5, 0x15, 0xF3, 0x14,
+    0xFA, 0x0A,
+    0xF4, 0x11, 0x33, 0x02, 0x2C, 0x06, 0x24, 0x0B, 0x1D, 0x0F, 0x16, 0x13,
+    0x0F, 0x17, 0x08, 0x1B, 0x00, 0x20, 0xFE, 0x1F, 0xFC, 0x1E, 0xFB, 0x1C,
+    0xF9, 0x1B, 0xF8, 0x19, 0xF6, 0x17, 0xF5, 0x15, 0xF3, 0x14, 0xFA, 0x0A,
+    0xF4, 0x11, 0x36, 0x01, 0x2F, 0x05, 0x27, 0x09, 0x1F, 0x0E, 0x17, 0x13,
+    0x10, 0x17, 0x08, 0x1C, 0x00, 0x21, 0xFE, 0x20, 0xFC, 0x1E, 0xFB, 0x1C,
+    0xF9, 0x1B, 0xF8, 0x19, 0xF6, 0x18, 0xF4, 0x17, 0xF3, 0x15, 0xFB, 0x09,
+    0xF5, 0x10, 0x32, 0x03, 0x2A, 0x08, 0x21, 0x0E, 0x19, 0x12, 0x11, 0x17,
+    0x09, 0x1C, 0x00, 0x22, 0xFE, 0x20, 0xFC, 0x1F, 0xFB, 0x1D, 0xF9, 0x1C,
+    0xF8, 0x19, 0xF6, 0x18, 0xF4, 0x17, 0xF3, 0x15, 0xFB, 0x09,
+    0xF5, 0x10, 0x36, 0x01, 0x2D, 0x06, 0x24, 0x0C, 0x1B, 0x12, 0x12, 0x17,
+    0x09, 0x1D, 0x00, 0x23, 0xFE, 0x21, 0xFC, 0x20, 0xFB, 0x1E, 0xF9, 0x1C,
+    0xF7, 0x1B, 0xF6, 0x19, 0xF4, 0x17, 0xF4, 0x14, 0xFB, 0x0A,
+    0xF6, 0x0F, 0x31, 0x04, 0x27, 0x0B, 0x1D, 0x11, 0x14, 0x17, 0x0A, 0x1D,
+    0x00, 0x24, 0xFE, 0x22, 0xFC, 0x21, 0xFB, 0x1E, 0xF9, 0x1D, 0xF7, 0x1B,
+    0xF6, 0x19, 0xF4, 0x18, 0xF5, 0x13, 0xFB, 0x0A,
+    0xF6, 0x0F, 0x35, 0x02, 0x2B, 0x08, 0x20, 0x10, 0x16, 0x16, 0x0B, 0x1E,
+    0x00, 0x25, 0xFE, 0x23, 0xFC, 0x22, 0xFB, 0x1F, 0xF9, 0x1E, 0xF7, 0x1C,
+    0xF5, 0x1A, 0xF4, 0x18, 0xF6, 0x12, 0xFC, 0x09,
+    0xF7, 0x0E, 0x2F, 0x06, 0x24, 0x0D, 0x18, 0x16, 0x0C, 0x1E, 0x01, 0x25,
+    0xFE, 0x24, 0xFC, 0x23, 0xFA, 0x21, 0xF9, 0x1E, 0xF7, 0x1D, 0xF5, 0x1B,
+    0xF3, 0x19, 0xF6, 0x12, 0xFC, 0x09,
+    0xF7, 0x0E, 0x35, 0x02, 0x28, 0x0B, 0x1B, 0x14, 0x0E, 0x1D, 0x01, 0x26,
+    0xFE, 0x26, 0xFC, 0x24, 0xFA, 0x22, 0xF9, 0x1F, 0xF7, 0x1D, 0xF5, 0x1B,
+    0xF3, 0x1A, 0xF7, 0x12, 0xFC, 0x09,
+    0xF8, 0x0D, 0x2D, 0x08, 0x1E, 0x13, 0x0F, 0x1E, 0x01, 0x28, 0xFE, 0x27,
+    0xFC, 0x25, 0xFA, 0x23, 0xF9, 0x20, 0xF7, 0x1E, 0xF5, 0x1C, 0xF3, 0x1A,
+    0xF7, 0x12, 0xFC, 0x09,
+    0xF8, 0x0D, 0x33, 0x04, 0x22, 0x11, 0x12, 0x1C, 0x01, 0x29, 0xFE, 0x28,
+    0xFC, 0x26, 0xFA, 0x24, 0xF8, 0x22, 0xF7, 0x1F, 0xF5, 0x1D, 0xF3, 0x1A,
+    0xF7, 0x12, 0xFC, 0x09,
+    0xF9, 0x0C, 0x28, 0x0D, 0x15, 0x1B, 0x01, 0x2B, 0xFE, 0x2A, 0xFC, 0x27,
+    0xFA, 0x25, 0xF8, 0x23, 0xF6, 0x20, 0xF4, 0x1E, 0xF3, 0x1B, 0xF8, 0x12,
+    0xFD, 0x08,
+    0xF9, 0x0C, 0x31, 0x06, 0x19, 0x19, 0x01, 0x2D, 0xFE, 0x2B, 0xFC, 0x29,
+    0xFA, 0x26, 0xF8, 0x24, 0xF6, 0x21, 0xF4, 0x1F, 0xF3, 0x1B, 0xF8, 0x12,
+    0xFD, 0x08,
+    0xFA, 0x0B, 0x1F, 0x15, 0x01, 0x2F, 0xFE, 0x2D, 0xFC, 0x2A, 0xFA, 0x28,
+    0xF8, 0x25, 0xF6, 0x22, 0xF4, 0x20, 0xF4, 0x1B, 0xF8, 0x12, 0xFD, 0x09,
+    0xFA, 0x0B, 0x2A, 0x0C, 0x01, 0x31, 0xFE, 0x2F, 0xFC, 0x2C, 0xFA, 0x29,
+    0xF8, 0x26, 0xF6, 0x23, 0xF4, 0x20, 0xF4, 0x1C, 0xF9, 0x12, 0xFD, 0x09,
+    0xFB, 0x0A, 0x02, 0x32, 0xFE, 0x31, 0xFC, 0x2E, 0xFA, 0x2B, 0xF8, 0x27,
+    0xF6, 0x24, 0xF4, 0x21, 0xF5, 0x1B, 0xF9, 0x12, 0xFD, 0x09,
+    0xFB, 0x0A, 0x03, 0x33, 0xFE, 0x33, 0xFC, 0x30, 0xFA, 0x2C, 0xF8, 0x29,
+    0xF5, 0x27, 0xF3, 0x23, 0xF5, 0x1C, 0xF9, 0x13, 0xFD, 0x09,
+    0xFC, 0x09, 0xFE, 0x35, 0xFC, 0x32, 0xFA, 0x2E, 0xF7, 0x2C, 0xF5, 0x28,
+    0xF3, 0x24, 0xF6, 0x1C, 0xF9, 0x13, 0xFD, 0x09,
+    0xFC, 0x09, 0xFE, 0x38, 0xFC, 0x34, 0xF9, 0x31, 0xF7, 0x2D, 0xF5, 0x29,
+    0xF3, 0x25, 0xF6, 0x1D, 0xFA, 0x13, 0xFD, 0x0A,
+    0xFC, 0x09, 0xFE, 0x35, 0xFC, 0x37, 0xF9, 0x33, 0xF7, 0x2F, 0xF5, 0x2B,
+    0xF3, 0x27, 0xF6, 0x1D, 0xFA, 0x13, 0xFD, 0x0A,
+    0xFC, 0x09, 0xFE, 0x26, 0xFC, 0x3A, 0xF9, 0x36, 0xF7, 0x31, 0xF5, 0x2D,
+    0xF3, 0x28, 0xF6, 0x1F, 0xFA, 0x14, 0xFD, 0x0A,
+    0xFC, 0x09, 0xFE, 0x1D, 0xFB, 0x3C, 0xF9, 0x39, 0xF7, 0x34, 0xF4, 0x30,
+    0xF3, 0x2A, 0xF7, 0x1F, 0xFA, 0x15, 0xFD, 0x0B,
+    0xFC, 0x09, 0xFE, 0x18, 0xFB, 0x31, 0xF9, 0x3C, 0xF6, 0x38, 0xF4, 0x32,
+    0xF4, 0x2B, 0xF7, 0x20, 0xFA, 0x16, 0xFD, 0x0B,
+    0xFC, 0x09, 0xFE, 0x15, 0xFB, 0x2A, 0xF9, 0x3F, 0xF6, 0x3B, 0xF4, 0x35,
+    0xF4, 0x2D, 0xF7, 0x22, 0xFA, 0x17, 0xFE, 0x0B,
+    0xFC, 0x09, 0xFE, 0x12, 0xFB, 0x25, 0xF9, 0x37, 0xF6, 0x3E, 0xF3, 0x39,
+    0xF4, 0x2F, 0xF7, 0x24, 0xFB, 0x17, 0xFE, 0x0B,
+    0xFC, 0x09, 0xFE, 0x10, 0xFB, 0x21, 0xF8, 0x32, 0xF6, 0x42, 0xF3, 0x3C,
+    0xF5, 0x31, 0xF8, 0x25, 0xFB, 0x18, 0xFE, 0x0C,
+    0xFC, 0x09, 0xFE, 0x0F, 0xFB, 0x1E, 0xF8, 0x2E, 0xF6, 0x3C, 0xF3, 0x41,
+    0xF5, 0x34, 0xF8, 0x27, 0xFB, 0x1A, 0xFE, 0x0D,
+    0xFB, 0x0B, 0x00, 0x01, 0xFE, 0x0E, 0xFB, 0x1C, 0xF8, 0x2A, 0xF5, 0x38,
+    0xF2, 0x47, 0xF5, 0x38, 0xF8, 0x2A, 0xFB, 0x1C, 0xFE, 0x0E, 0x00, 0x01,
+};
+
+const uint16_t hourHandOffsets[] PROGMEM = {
+    0, 144, 284, 424, 564, 704, 844, 984, 1124, 1264, 1404, 1544,
+    1684, 1824, 1964, 2104, 2244, 2384, 2524, 2664, 2804, 2944, 3084, 3222,
+    3360, 3498, 3636, 3774, 3912, 4050, 4188, 4326, 4462, 4598, 4734, 4870,
+    5006, 5142, 5278, 5412, 5546, 5680, 5814, 5948, 6082, 6212, 6342, 6472,
+    6602, 6732, 6860, 6988, 7116, 7244, 7372, 7498, 7624, 7750, 7876, 8000,
+    8124, 8248, 8372, 8496, 8616, 8736, 8856, 8974, 9092, 9210, 9328, 9444,
+    9560, 9676, 9792, 9906, 10020, 10134, 10244, 10354, 10464, 10572, 10680, 10788,
+    10894, 11000, 11106, 11210, 11314, 11418, 11518, 11618, 11718, 11816, 11914, 12012,
+    12108, 12204, 12300, 12394, 12488, 12578, 12668, 12758, 12846, 12934, 13022, 13108,
+    13194, 13278, 13362, 13446, 13526, 13606, 13684, 13762, 13840, 13916, 13992, 14066,
+    14140, 14214, 14284, 14354, 14422, 14490, 14556, 14622, 14686, 14750, 14814, 14874,
+    14934, 14992, 15050, 15106, 15162, 15216, 15270, 15324, 15374, 15424, 15472, 15520,
+    15566, 15612, 15656, 15700, 15742, 15784, 15824, 15864, 15904, 15942, 15980, 16016,
+    16052, 16086, 16120, 16152, 16184, 16214, 16244, 16272, 16300, 16326, 16352, 16376,
+    16400, 16422, 16444, 16464, 16484, 16504, 16524, 16544, 16564, 16584, 16604, 16624,
+    16644,
+};
+
+const handSprites hourHand = {720, hourHandSpans, hourHandOffsets};
+
+// minuteHand: 60 positions a turn, 16 sprites for the first quarter in 2130 bytes.
+// Generated by extras/host/tools/handsprites from 0,16 -4,0 0,-86 4,0
+const uint8_t minuteHandSpans[] PROGMEM = {
+    0xAA, 0x67, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03,
+    0xFF, 0x03, 0xFF, 0x03, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07, 0xFC, 0x09, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x07, 0xFD, 0x07, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05, 0xFE, 0x05,
+    0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01,
+    0xAB, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01, 0x08, 0x01,
+    0x08, 0x01, 0x08, 0x01, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02, 0x07, 0x02,
+    0x07, 0x01, 0x07, 0x01, 0x07, 0x01, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02,
+    0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+    0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x04, 0x04, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x03, 0x04, 0x03, 0x04,
+    0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x05,
+    0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x04, 0x01, 0x05,
+    0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x06, 0xFF, 0x06, 0xFF, 0x06,
+    0xFF, 0x06, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07, 0xFE, 0x07,
+    0xFE, 0x07, 0xFE, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x07,
+    0xFD, 0x06, 0xFD, 0x06, 0xFD, 0x05, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x03,
+    0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x02, 0xFE, 0x02, 0xFF, 0x01, 0x00, 0x00,
+    0xAC, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01,
+    0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01,
+    0x0F, 0x02, 0x0F, 0x01, 0x0F, 0x01, 0x0F, 0x01, 0x0E, 0x02, 0x0E, 0x02,
+    0x0E, 0x02, 0x0E, 0x01, 0x0D, 0x02, 0x0D, 0x02, 0x0D, 0x02, 0x0D, 0x02,
+    0x0C, 0x03, 0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x0B, 0x03, 0x0B, 0x03,
+    0x0B, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x09, 0x04,
+    0x09, 0x04, 0x09, 0x03, 0x09, 0x03, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04,
+    0x08, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x07, 0x04, 0x06, 0x05,
+    0x06, 0x05, 0x06, 0x04, 0x06, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x04, 0x06, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x03, 0x06, 0x03, 0x06,
+    0x03, 0x06, 0x03, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06,
+    0x01, 0x07, 0x01, 0x07, 0x01, 0x06, 0x01, 0x06, 0x00, 0x07, 0x00, 0x07,
+    0x00, 0x07, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFF, 0x07, 0xFE, 0x08,
+    0xFE, 0x08, 0xFE, 0x08, 0xFE, 0x07, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08,
+    0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x07, 0xFD, 0x07, 0xFD, 0x06, 0xFD, 0x06,
+    0xFD, 0x05, 0xFD, 0x05, 0xFD, 0x04, 0xFD, 0x04, 0xFD, 0x03, 0xFD, 0x03,
+    0xFD, 0x02, 0xFD, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0x00, 0x00,
+    0xAF, 0x61, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x19, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x18, 0x01, 0x17, 0x01, 0x17, 0x01,
+    0x17, 0x01, 0x16, 0x02, 0x16, 0x01, 0x15, 0x02, 0x15, 0x02, 0x15, 0x01,
+    0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x13, 0x02, 0x13, 0x02, 0x12, 0x03,
+    0x12, 0x03, 0x12, 0x02, 0x11, 0x03, 0x11, 0x03, 0x11, 0x02, 0x10, 0x03,
+    0x10, 0x03, 0x0F, 0x04, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x04, 0x0E, 0x04,
+    0x0E, 0x03, 0x0D, 0x04, 0x0D, 0x04, 0x0C, 0x04, 0x0C, 0x04, 0x0C, 0x04,
+    0x0B, 0x05, 0x0B, 0x04, 0x0B, 0x04, 0x0A, 0x05, 0x0A, 0x05, 0x09, 0x05,
+    0x09, 0x05, 0x09, 0x05, 0x08, 0x05, 0x08, 0x05, 0x08, 0x05, 0x07, 0x06,
+    0x07, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x05, 0x06,
+    0x05, 0x06, 0x04, 0x06, 0x04, 0x06, 0x03, 0x07, 0x03, 0x07, 0x03, 0x06,
+    0x02, 0x07, 0x02, 0x07, 0x02, 0x06, 0x01, 0x07, 0x01, 0x07, 0x00, 0x08,
+    0x00, 0x07, 0x00, 0x07, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x08, 0xFE, 0x08,
+    0xFE, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x08, 0xFD, 0x07,
+    0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x06, 0xFC, 0x05, 0xFC, 0x05,
+    0xFC, 0x04, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x01,
+    0x00, 0x00, 0x00, 0x00,
+    0xB2, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01,
+    0x00, 0x00, 0x20, 0x01, 0x20, 0x01, 0x1F, 0x01, 0x1F, 0x01, 0x1E, 0x01,
+    0x1E, 0x01, 0x1D, 0x02, 0x1D, 0x01, 0x1C, 0x02, 0x1C, 0x01, 0x1B, 0x02,
+    0x1B, 0x02, 0x1A, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x19, 0x02, 0x18, 0x03,
+    0x18, 0x02, 0x17, 0x03, 0x17, 0x02, 0x16, 0x03, 0x16, 0x03, 0x15, 0x03,
+    0x15, 0x03, 0x14, 0x04, 0x14, 0x03, 0x13, 0x04, 0x13, 0x03, 0x12, 0x04,
+    0x12, 0x04, 0x11, 0x04, 0x11, 0x04, 0x10, 0x04, 0x10, 0x04, 0x0F, 0x05,
+    0x0F, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0D, 0x05, 0x0D, 0x05, 0x0C, 0x05,
+    0x0C, 0x05, 0x0B, 0x06, 0x0B, 0x05, 0x0A, 0x06, 0x0A, 0x05, 0x09, 0x06,
+    0x09, 0x06, 0x08, 0x06, 0x08, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06, 0x07,
+    0x06, 0x06, 0x05, 0x07, 0x05, 0x06, 0x04, 0x07, 0x04, 0x07, 0x03, 0x07,
+    0x03, 0x07, 0x02, 0x07, 0x02, 0x07, 0x01, 0x08, 0x01, 0x07, 0x00, 0x08,
+    0x00, 0x08, 0xFF, 0x08, 0xFF, 0x08, 0xFE, 0x08, 0xFE, 0x08, 0xFD, 0x09,
+    0xFD, 0x08, 0xFD, 0x08, 0xFC, 0x08, 0xFC, 0x08, 0xFC, 0x07, 0xFC, 0x06,
+    0xFC, 0x06, 0xFC, 0x05, 0xFB, 0x05, 0xFB, 0x04, 0xFB, 0x03, 0xFB, 0x03,
+    0xFB, 0x02, 0xFA, 0x02, 0xFA, 0x01, 0x00, 0x00,
+    0xB6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00,
+    0x28, 0x01, 0x27, 0x01, 0x27, 0x01, 0x26, 0x01, 0x25, 0x02, 0x25, 0x01,
+    0x24, 0x02, 0x24, 0x01, 0x23, 0x02, 0x22, 0x02, 0x22, 0x01, 0x21, 0x02,
+    0x20, 0x02, 0x20, 0x02, 0x1F, 0x02, 0x1E, 0x03, 0x1E, 0x02, 0x1D, 0x03,
+    0x1C, 0x03, 0x1C, 0x03, 0x1B, 0x03, 0x1B, 0x03, 0x1A, 0x03, 0x19, 0x04,
+    0x19, 0x03, 0x18, 0x04, 0x17, 0x04, 0x17, 0x04, 0x16, 0x04, 0x15, 0x05,
+    0x15, 0x04, 0x14, 0x05, 0x13, 0x05, 0x13, 0x05, 0x12, 0x05, 0x12, 0x05,
+    0x11, 0x05, 0x10, 0x06, 0x10, 0x05, 0x0F, 0x06, 0x0E, 0x06, 0x0E, 0x05,
+    0x0D, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0B, 0x06, 0x0A, 0x07, 0x0A, 0x06,
+    0x09, 0x07, 0x09, 0x06, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07,
+    0x05, 0x08, 0x05, 0x07, 0x04, 0x08, 0x03, 0x08, 0x03, 0x08, 0x02, 0x08,
+    0x02, 0x08, 0x01, 0x08, 0x00, 0x09, 0x00, 0x08, 0xFF, 0x09, 0xFE, 0x09,
+    0xFE, 0x09, 0xFD, 0x09, 0xFD, 0x09, 0xFC, 0x09, 0xFC, 0x08, 0xFC, 0x08,
+    0xFC, 0x07, 0xFB, 0x07, 0xFB, 0x06, 0xFB, 0x05, 0xFA, 0x05, 0xFA, 0x04,
+    0xFA, 0x03, 0xFA, 0x02, 0xF9, 0x02, 0xF9, 0x01, 0x00, 0x00,
+    0xBB, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x2F, 0x01,
+    0x00, 0x00, 0x2E, 0x01, 0x2D, 0x01, 0x2C, 0x01, 0x2B, 0x02, 0x2B, 0x01,
+    0x2A, 0x01, 0x29, 0x02, 0x28, 0x02, 0x27, 0x02, 0x27, 0x02, 0x26, 0x02,
+    0x25, 0x02, 0x24, 0x03, 0x23, 0x03, 0x23, 0x03, 0x22, 0x03, 0x21, 0x03,
+    0x20, 0x04, 0x1F, 0x04, 0x1F, 0x03, 0x1E, 0x04, 0x1D, 0x04, 0x1C, 0x04,
+    0x1B, 0x05, 0x1B, 0x04, 0x1A, 0x04, 0x19, 0x05, 0x18, 0x05, 0x17, 0x05,
+    0x17, 0x05, 0x16, 0x05, 0x15, 0x05, 0x14, 0x06, 0x13, 0x06, 0x13, 0x05,
+    0x12, 0x06, 0x11, 0x06, 0x10, 0x06, 0x0F, 0x07, 0x0F, 0x06, 0x0E, 0x06,
+    0x0D, 0x07, 0x0C, 0x07, 0x0B, 0x07, 0x0B, 0x07, 0x0A, 0x07, 0x09, 0x07,
+    0x08, 0x08, 0x07, 0x08, 0x07, 0x07, 0x06, 0x08, 0x05, 0x08, 0x04, 0x09,
+    0x03, 0x09, 0x03, 0x08, 0x02, 0x09, 0x01, 0x09, 0x00, 0x09, 0xFF, 0x0A,
+    0xFF, 0x09, 0xFE, 0x09, 0xFD, 0x0A, 0xFD, 0x09, 0xFC, 0x09, 0xFC, 0x09,
+    0xFC, 0x08, 0xFB, 0x08, 0xFB, 0x07, 0xFA, 0x07, 0xFA, 0x05, 0xF9, 0x05,
+    0xF9, 0x04, 0xF9, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0xF7, 0x01,
+    0xC1, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x37, 0x01, 0x36, 0x01, 0x35, 0x01,
+    0x34, 0x01, 0x33, 0x01, 0x32, 0x02, 0x31, 0x02, 0x30, 0x02, 0x2F, 0x02,
+    0x2E, 0x02, 0x2D, 0x02, 0x2C, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x29, 0x03,
+    0x28, 0x03, 0x27, 0x04, 0x26, 0x04, 0x25, 0x04, 0x24, 0x04, 0x23, 0x04,
+    0x22, 0x04, 0x21, 0x05, 0x20, 0x05, 0x1F, 0x05, 0x1E, 0x05, 0x1D, 0x05,
+    0x1C, 0x06, 0x1B, 0x06, 0x1B, 0x05, 0x1A, 0x05, 0x19, 0x05, 0x18, 0x05,
+    0x17, 0x06, 0x16, 0x06, 0x15, 0x06, 0x14, 0x06, 0x13, 0x06, 0x12, 0x07,
+    0x11, 0x07, 0x10, 0x07, 0x0F, 0x07, 0x0E, 0x07, 0x0D, 0x07, 0x0C, 0x08,
+    0x0B, 0x08, 0x0A, 0x08, 0x09, 0x08, 0x08, 0x08, 0x07, 0x09, 0x06, 0x09,
+    0x05, 0x09, 0x04, 0x09, 0x03, 0x09, 0x02, 0x09, 0x01, 0x0A, 0x00, 0x0A,
+    0xFF, 0x0A, 0xFE, 0x0A, 0xFD, 0x0A, 0xFD, 0x09, 0xFC, 0x0A, 0xFC, 0x09,
+    0xFB, 0x09, 0xFB, 0x08, 0xFA, 0x08, 0xF9, 0x07, 0xF9, 0x06, 0xF8, 0x05,
+    0xF8, 0x04, 0xF7, 0x03, 0xF7, 0x02, 0xF6, 0x01,
+    0xC7, 0x44, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x01, 0x3C, 0x01, 0x3B, 0x01,
+    0x3A, 0x01, 0x38, 0x02, 0x37, 0x02, 0x36, 0x02, 0x35, 0x02, 0x34, 0x02,
+    0x32, 0x03, 0x31, 0x03, 0x30, 0x03, 0x2F, 0x03, 0x2D, 0x04, 0x2C, 0x04,
+    0x2B, 0x04, 0x2A, 0x04, 0x29, 0x04, 0x27, 0x05, 0x26, 0x05, 0x25, 0x05,
+    0x24, 0x05, 0x22, 0x06, 0x21, 0x06, 0x20, 0x06, 0x1F, 0x06, 0x1E, 0x06,
+    0x1C, 0x07, 0x1B, 0x07, 0x1A, 0x06, 0x19, 0x06, 0x17, 0x07, 0x16, 0x07,
+    0x15, 0x07, 0x14, 0x07, 0x13, 0x07, 0x11, 0x08, 0x10, 0x08, 0x0F, 0x08,
+    0x0E, 0x08, 0x0C, 0x09, 0x0B, 0x09, 0x0A, 0x09, 0x09, 0x09, 0x08, 0x09,
+    0x06, 0x0A, 0x05, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x02, 0x0A, 0x00, 0x0B,
+    0xFF, 0x0B, 0xFE, 0x0B, 0xFD, 0x0B, 0xFC, 0x0B, 0xFC, 0x0A, 0xFB, 0x0A,
+    0xFA, 0x0A, 0xFA, 0x09, 0xF9, 0x08, 0xF8, 0x07, 0xF8, 0x05, 0xF7, 0x05,
+    0xF6, 0x04, 0xF6, 0x02, 0xF5, 0x01,
+    0xCE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x42, 0x01, 0x41, 0x01, 0x3F, 0x01,
+    0x3E, 0x01, 0x3C, 0x02, 0x3B, 0x02, 0x39, 0x02, 0x38, 0x02, 0x36, 0x03,
+    0x35, 0x03, 0x33, 0x03, 0x31, 0x04, 0x30, 0x04, 0x2E, 0x05, 0x2D, 0x04,
+    0x2B, 0x05, 0x2A, 0x05, 0x28, 0x06, 0x27, 0x05, 0x25, 0x06, 0x24, 0x06,
+    0x22, 0x07, 0x21, 0x06, 0x1F, 0x07, 0x1E, 0x07, 0x1C, 0x08, 0x1B, 0x07,
+    0x19, 0x08, 0x18, 0x08, 0x16, 0x09, 0x15, 0x08, 0x13, 0x09, 0x12, 0x09,
+    0x10, 0x0A, 0x0F, 0x09, 0x0D, 0x0A, 0x0B, 0x0B, 0x0A, 0x0B, 0x08, 0x0B,
+    0x07, 0x0B, 0x05, 0x0C, 0x04, 0x0C, 0x02, 0x0C, 0x01, 0x0C, 0xFF, 0x0D,
+    0xFE, 0x0D, 0xFD, 0x0C, 0xFC, 0x0C, 0xFB, 0x0C, 0xFB, 0x0B, 0xFA, 0x0A,
+    0xF9, 0x0A, 0xF8, 0x09, 0xF7, 0x07, 0xF6, 0x06, 0xF6, 0x04, 0xF5, 0x02,
+    0xF4, 0x01,
+    0xD5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x47, 0x01, 0x45, 0x01, 0x43, 0x02,
+    0x41, 0x02, 0x3F, 0x03, 0x3D, 0x03, 0x3C, 0x02, 0x3A, 0x03, 0x38, 0x03,
+    0x36, 0x04, 0x34, 0x04, 0x32, 0x05, 0x30, 0x05, 0x2E, 0x06, 0x2C, 0x06,
+    0x2A, 0x06, 0x28, 0x07, 0x26, 0x07, 0x24, 0x08, 0x22, 0x08, 0x20, 0x09,
+    0x1E, 0x09, 0x1D, 0x09, 0x1B, 0x09, 0x19, 0x09, 0x17, 0x0A, 0x15, 0x0A,
+    0x13, 0x0B, 0x11, 0x0B, 0x0F, 0x0C, 0x0D, 0x0C, 0x0B, 0x0D, 0x09, 0x0D,
+    0x07, 0x0D, 0x05, 0x0E, 0x03, 0x0E, 0x01, 0x0F, 0x00, 0x0E, 0xFE, 0x0F,
+    0xFD, 0x0E, 0xFC, 0x0D, 0xFB, 0x0D, 0xFA, 0x0C, 0xF9, 0x0C, 0xF8, 0x0B,
+    0xF7, 0x0A, 0xF6, 0x07, 0xF5, 0x05, 0xF4, 0x02, 0x00, 0x00,
+    0xDE, 0x29, 0x00, 0x00, 0x4A, 0x01, 0x47, 0x02, 0x45, 0x02, 0x42, 0x03,
+    0x40, 0x03, 0x3D, 0x04, 0x3B, 0x04, 0x38, 0x05, 0x36, 0x05, 0x33, 0x06,
+    0x30, 0x07, 0x2E, 0x07, 0x2B, 0x08, 0x29, 0x08, 0x26, 0x09, 0x24, 0x09,
+    0x21, 0x0A, 0x1E, 0x0B, 0x1C, 0x0B, 0x19, 0x0C, 0x17, 0x0C, 0x14, 0x0D,
+    0x12, 0x0D, 0x0F, 0x0E, 0x0D, 0x0E, 0x0A, 0x0F, 0x07, 0x10, 0x05, 0x10,
+    0x02, 0x11, 0x00, 0x11, 0xFE, 0x11, 0xFD, 0x10, 0xFB, 0x10, 0xFA, 0x0F,
+    0xF9, 0x0E, 0xF8, 0x0D, 0xF6, 0x0D, 0xF5, 0x0B, 0xF4, 0x06, 0xF3, 0x02,
+    0xE6, 0x1F, 0x50, 0x01, 0x4D, 0x01, 0x49, 0x02, 0x45, 0x04, 0x42, 0x04,
+    0x3E, 0x06, 0x3A, 0x07, 0x37, 0x07, 0x33, 0x09, 0x2F, 0x0A, 0x2C, 0x0A,
+    0x28, 0x0C, 0x24, 0x0D, 0x21, 0x0D, 0x1D, 0x0F, 0x1A, 0x0F, 0x16, 0x10,
+    0x12, 0x12, 0x0F, 0x12, 0x0B, 0x13, 0x07, 0x15, 0x04, 0x15, 0x00, 0x16,
+    0xFE, 0x16, 0xFC, 0x15, 0xFB, 0x13, 0xF9, 0x13, 0xF8, 0x11, 0xF6, 0x11,
+    0xF4, 0x10, 0xF3, 0x0C,
+    0xEF, 0x15, 0x4F, 0x02, 0x49, 0x04, 0x43, 0x07, 0x3D, 0x09, 0x37, 0x0B,
+    0x31, 0x0D, 0x2B, 0x0F, 0x25, 0x12, 0x1F, 0x14, 0x19, 0x16, 0x12, 0x19,
+    0x0C, 0x1B, 0x06, 0x1D, 0x00, 0x20, 0xFE, 0x1E, 0xFC, 0x1C, 0xFA, 0x1A,
+    0xF8, 0x18, 0xF6, 0x16, 0xF4, 0x15, 0xF2, 0x13,
+    0xF8, 0x0C, 0x45, 0x0B, 0x34, 0x15, 0x23, 0x1F, 0x12, 0x2A, 0x00, 0x35,
+    0xFD, 0x32, 0xFB, 0x2D, 0xF8, 0x2A, 0xF5, 0x26, 0xF2, 0x22, 0xF3, 0x1B,
+    0xFA, 0x0D,
+    0xFC, 0x09, 0x00, 0x01, 0xFC, 0x1A, 0xF8, 0x34, 0xF4, 0x4D, 0xF0, 0x67,
+    0xF4, 0x4D, 0xF8, 0x34, 0xFC, 0x1A, 0x00, 0x01,
+};
+
+const uint16_t minuteHandOffsets[] PROGMEM = {
+    0, 208, 412, 614, 810, 998, 1176, 1342, 1494, 1632, 1754, 1860,
+    1944, 2008, 2052, 2078,
+};
+
+const handSprites minuteHand = {60, minuteHandSpans, minuteHandOffsets};
+
+#endif
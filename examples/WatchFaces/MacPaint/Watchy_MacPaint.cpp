@@ -4,7 +4,7 @@ const unsigned char *numbers [10] = {numbers0, numbers1, numbers2, numbers3, num
 
 void WatchyMacPaint::drawWatchFace(){
     display.fillScreen(GxEPD_WHITE);
-    display.drawBitmap(0, 0, window, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK);
+    display.drawPackedBitmap(0, 0, window, GxEPD_BLACK);
 
     //Hour
     display.drawBitmap(35, 70, numbers[currentTime.Hour/10], 38, 50, GxEPD_BLACK); //first digit
@@ -195,319 +195,108 @@ const unsigned char numbers9 [] PROGMEM = {
 	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-// 'macpaint', 200x200px
+// 'macpaint', 200x200px, packed 5000 -> 1621 bytes
 const unsigned char window [] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x40, 0x00, 0x10, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x00, 
-	0x8a, 0x40, 0x11, 0xc6, 0x01, 0x08, 0x46, 0x91, 0x00, 0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x96, 0xa0, 0x12, 0xb4, 0x01, 0x15, 0x5a, 
-	0xaa, 0x00, 0xca, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x1f, 0x00, 0x9a, 0xe0, 0x12, 0x94, 0x01, 0x55, 0x55, 0xbb, 0x00, 0x8a, 0xa4, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x92, 0x80, 0x32, 0xd6, 0x01, 
-	0x55, 0x56, 0xa1, 0x80, 0xca, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x88, 0x88, 0x10, 0x00, 0x04, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xaa, 0xaa, 0xa5, 0x52, 0x55, 0x55, 0x49, 0x24, 0x95, 
-	0x54, 0xa5, 0x55, 0x55, 0x55, 0x4a, 0x55, 0x54, 0xa5, 0x55, 0x4a, 0x55, 0x54, 0xa5, 0x55, 0xb5, 
-	0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0xbf, 0xde, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x40, 0x01, 0x00, 0x0d, 0x5f, 0x77, 
-	0x77, 0x7f, 0xff, 0x77, 0x77, 0xff, 0x77, 0x77, 0x77, 0x7d, 0xf7, 0x77, 0xdf, 0x77, 0x7d, 0xf7, 
-	0x77, 0xdd, 0x55, 0xc0, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x41, 0xe2, 0x36, 0x4d, 
-	0x4d, 0xbb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xbb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 
-	0x6d, 0xb6, 0xdb, 0x6d, 0x55, 0x84, 0x09, 0x00, 0x2d, 0x6a, 0x02, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xab, 0x48, 0x08, 
-	0x00, 0x06, 0xab, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x88, 0x31, 0x20, 0x2d, 0x55, 0x05, 0x56, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xad, 0xaa, 
-	0x4b, 0x80, 0x00, 0x0d, 0x6a, 0x05, 0x6a, 0xd5, 0x55, 0xb6, 0xdb, 0x55, 0xb6, 0xd5, 0xb6, 0xd6, 
-	0xdb, 0x6d, 0x6d, 0xb6, 0xdb, 0x5b, 0x6d, 0x69, 0x55, 0xc4, 0x02, 0x00, 0x0a, 0xab, 0x7a, 0xaa, 
-	0xad, 0xb6, 0xaa, 0xaa, 0xb6, 0xaa, 0xad, 0x55, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xad, 0xab, 0x42, 0x01, 0x2a, 0xcd, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x84, 0x00, 0x00, 0x0d, 0x75, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0xaa, 0x40, 0x02, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xf7, 0x7b, 0xff, 
-	0xfd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 
-	0x82, 0x04, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x85, 0x60, 0x06, 0x0d, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x41, 0x29, 0x0a, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xc6, 0x28, 0x0b, 0x0d, 0x20, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x4a, 0x02, 0x11, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x84, 0x11, 0x1d, 0x85, 
-	0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x10, 0x20, 0x8d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x82, 0x22, 
-	0x20, 0xcd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x61, 0xa5, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0xd5, 0x53, 0x14, 0x4d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x0a, 0x82, 0x2d, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x81, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0x82, 0x20, 0x05, 0x20, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0xc2, 0x81, 0x16, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xa0, 0x05, 
-	0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x44, 0x9a, 0x0b, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 
-	0x18, 0x0a, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x32, 0x0b, 0x0d, 0x60, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0xc4, 0x59, 0x09, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x42, 0x90, 0x0b, 0x0d, 0x60, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x80, 0x01, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x7f, 0xff, 0x7b, 0xfd, 
-	0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0xfe, 0x00, 0x06, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x7f, 0x7e, 
-	0x03, 0x0d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0x3e, 0x00, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x7f, 0x7e, 0x07, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0x3e, 0x01, 0x0d, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x7d, 0x5e, 0x0a, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xfc, 0x9e, 0x12, 0x05, 0xa0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x7f, 0xfe, 0x14, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xfc, 0x9e, 0x18, 
-	0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x7a, 0x5e, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 
-	0xff, 0x52, 0x4d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x02, 0x09, 0x2d, 0x20, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x80, 0x01, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x00, 0x03, 0x85, 0x60, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x88, 0x02, 0x04, 0x4d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x46, 0x01, 0x08, 0xcd, 
-	0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0xc1, 0x82, 0x11, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x60, 
-	0x2b, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x12, 0x26, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x40, 0x01, 0x34, 0x0c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x00, 0x00, 0x06, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x40, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xff, 0xfb, 0xfb, 0xed, 0x50, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x02, 0x00, 
-	0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x4d, 0xb1, 0x3e, 0xcd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 
-	0x08, 0x22, 0xad, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x48, 0x09, 0x35, 0x45, 0x20, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0xc8, 0x08, 0x2a, 0xcd, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x48, 0x0a, 0x2a, 0xad, 0x60, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x8a, 0xa8, 0x3f, 0xc5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x01, 0x00, 0x0d, 
-	0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x52, 0xa9, 
-	0x22, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc8, 0x45, 0x49, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x40, 0x00, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 0x02, 0x00, 0x0d, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x47, 0xf1, 0x1f, 0xc5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 0x08, 0x2a, 0x4d, 0x60, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x48, 0x09, 0x35, 0xad, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc8, 0x08, 0x2a, 
-	0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x40, 0x02, 0x2a, 0xc5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x87, 
-	0x61, 0x1d, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x80, 0x02, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x7f, 0xff, 0xf7, 0xf5, 0xa0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x80, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x01, 0x00, 0x0d, 
-	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0xc2, 0xc0, 0x0d, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x44, 0x32, 
-	0x15, 0xcd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 0x08, 0x2a, 0xad, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x48, 0x09, 0x35, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x88, 0x10, 0x35, 0x4d, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x46, 0xb2, 0x1f, 0x8d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc0, 0x01, 0x00, 0x06, 0xa0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x40, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x82, 0x93, 0x00, 
-	0x4d, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x69, 0x4a, 0xb6, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x80, 
-	0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x02, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0xc7, 0x31, 0x19, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x48, 0x88, 0x2e, 0xc5, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x88, 0x09, 0x32, 0x4d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x40, 0x10, 0x2a, 0xcd, 
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x84, 0x22, 0x15, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x41, 0x81, 
-	0x0e, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xc0, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x40, 0x02, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x7f, 0xfb, 0xf7, 0xb5, 0x60, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0x80, 0x00, 0x00, 0x0d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x02, 0x00, 0x0d, 0x60, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0xc1, 0xb0, 0x06, 0xc5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0x12, 0x0a, 
-	0xcd, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x84, 0x21, 0x1a, 0x8d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x44, 
-	0x60, 0x2b, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x80, 0x22, 0x29, 0x8e, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x4d, 0x11, 0x3f, 0xca, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xc0, 0x40, 0x00, 0x0d, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x40, 0x02, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x80, 0x01, 0x00, 0x0d, 
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x7f, 0xff, 0xff, 0xfd, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xab, 0xdb, 0x6d, 0xad, 0xad, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x0d, 0x20, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xaa, 0x80, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 
-	0x04, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x80, 0x00, 0x00, 0x0e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 
-	0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0xc0, 0x2a, 0xa8, 0x4d, 0x60, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-	0x55, 0x40, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0x80, 0x00, 0x00, 0x0d, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0x55, 0x40, 0x40, 0x00, 0x0d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0x81, 0x80, 0x00, 0x0d, 
-	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x55, 0x43, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xab, 0xda, 0x3f, 
-	0xff, 0x8d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x4c, 0x00, 0x00, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 
-	0x80, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x02, 
-	0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x05, 0x64, 0x92, 0x94, 
-	0xa5, 0x29, 0x4a, 0x52, 0x94, 0xa5, 0x54, 0x28, 0x50, 0xa1, 0x42, 0x85, 0x0a, 0x14, 0x28, 0x54, 
-	0x91, 0xab, 0x80, 0x00, 0x00, 0x0d, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x40, 0x3f, 0xff, 0x8d, 0xa4, 
-	0x94, 0x92, 0x49, 0x24, 0x92, 0x49, 0x49, 0x29, 0x25, 0x4a, 0x95, 0x29, 0x29, 0x52, 0xa4, 0xa5, 
-	0x25, 0x24, 0x95, 0x55, 0xc0, 0x00, 0x00, 0x85, 0x55, 0x6a, 0xd5, 0xad, 0x5b, 0x5a, 0xb6, 0xaa, 
-	0xd5, 0x55, 0x55, 0x55, 0x56, 0xaa, 0xaa, 0xab, 0x55, 0x5a, 0xab, 0x6a, 0xab, 0x40, 0x00, 0x00, 
-	0x0d, 0x55, 0x55, 0x55, 0x55, 0x54, 0xaa, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x2a, 0xaa, 0x80, 0x00, 0x00, 0x0d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 
-	0x00, 0x00, 0x0d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x80, 0x00, 0x40, 0x05, 0x6e, 0xdb, 0x6d, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0x6d, 0xf7, 0x7d, 0xdf, 0xdd, 0xdd, 0xfb, 0xbb, 0xfb, 
-	0xd5, 0x40, 0x3f, 0xff, 0x8d, 0x40, 0x00, 0x00, 0xff, 0xfb, 0xba, 0xdb, 0x08, 0x5b, 0xb8, 0x41, 
-	0x00, 0x00, 0x00, 0x88, 0xa2, 0x48, 0x84, 0x46, 0x88, 0xd5, 0xc0, 0x3f, 0xff, 0x8d, 0x40, 0x00, 
-	0x00, 0xff, 0xfd, 0xdf, 0x77, 0x6b, 0x6e, 0xef, 0x7f, 0x00, 0x48, 0x89, 0x05, 0x77, 0x45, 0x31, 
-	0x12, 0xad, 0xd5, 0x40, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf8, 0xff, 0xee, 0xeb, 0xdd, 0x55, 0x7b, 
-	0xb9, 0x00, 0x00, 0x40, 0x4e, 0x72, 0xaa, 0xe2, 0x12, 0xaa, 0xee, 0xd5, 0x80, 0x00, 0x00, 0x0a, 
-	0xc3, 0xff, 0xf8, 0xff, 0xfd, 0xdd, 0x7f, 0x55, 0x5e, 0xed, 0xff, 0x00, 0x41, 0x08, 0x85, 0x9c, 
-	0x94, 0xaa, 0xaa, 0x99, 0xd5, 0x40, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf0, 0xff, 0xfb, 0xbf, 0xd5, 
-	0xaa, 0xb7, 0xb8, 0x00, 0x00, 0x42, 0x28, 0x8a, 0xaa, 0xc8, 0x94, 0x03, 0x88, 0xd5, 0x80, 0x00, 
-	0x00, 0x0d, 0x43, 0xff, 0xf8, 0xff, 0xfd, 0xd5, 0x7f, 0x55, 0x6d, 0xef, 0xff, 0x08, 0x48, 0x08, 
-	0x89, 0x67, 0x4a, 0x91, 0x12, 0xad, 0xd6, 0x40, 0x00, 0x00, 0x05, 0x43, 0xff, 0xf8, 0xff, 0xee, 
-	0xff, 0xeb, 0x55, 0x7e, 0xb8, 0x01, 0x00, 0x44, 0x4a, 0x22, 0x2a, 0x62, 0x32, 0xaa, 0xea, 0xd5, 
-	0xc0, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf8, 0xff, 0xff, 0xda, 0xdf, 0x55, 0x57, 0xed, 0xdd, 0x00, 
-	0x41, 0x09, 0x55, 0xdc, 0xa2, 0x2a, 0xa2, 0xaa, 0xd5, 0x40, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf0, 
-	0xaa, 0xb1, 0x36, 0xb5, 0xaa, 0xba, 0xba, 0xab, 0xff, 0xfa, 0xbd, 0xab, 0x33, 0xdd, 0xdb, 0xbe, 
-	0xdd, 0xd5, 0x80, 0x3f, 0xff, 0x8d, 0x43, 0xff, 0xf8, 0x80, 0x24, 0x04, 0x01, 0x12, 0x60, 0x0c, 
-	0x41, 0x00, 0x00, 0x00, 0x8a, 0xcc, 0x40, 0x0b, 0x9a, 0x00, 0x6b, 0x40, 0x3f, 0xff, 0x8d, 0x43, 
-	0xff, 0xf8, 0x00, 0x20, 0x12, 0x81, 0x44, 0x25, 0x48, 0xa6, 0x44, 0x48, 0x89, 0x14, 0x44, 0x51, 
-	0x1e, 0xa4, 0x84, 0x55, 0x80, 0x00, 0x00, 0x05, 0x43, 0xff, 0xf9, 0x00, 0x20, 0x44, 0x11, 0x11, 
-	0x60, 0x2b, 0x11, 0x11, 0x80, 0x0a, 0x23, 0x33, 0x7f, 0xfc, 0xee, 0xaa, 0xea, 0x40, 0x00, 0x00, 
-	0x0d, 0xc3, 0xff, 0xf0, 0x80, 0x21, 0x04, 0x01, 0x44, 0x2a, 0x88, 0x01, 0x44, 0x62, 0x28, 0x8a, 
-	0x11, 0x40, 0x0a, 0xaa, 0x8c, 0xd5, 0xc0, 0x00, 0x00, 0x0d, 0x43, 0xff, 0xf8, 0x00, 0x20, 0x04, 
-	0x45, 0x12, 0xa0, 0x0c, 0x43, 0x00, 0x40, 0x08, 0x8a, 0xcc, 0x48, 0x93, 0x9a, 0x40, 0x55, 0x40, 
-	0x00, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x80, 0x20, 0x04, 0x01, 0x24, 0x64, 0xac, 0x4d, 0x4a, 0x48, 
-	0xc9, 0x12, 0x44, 0x41, 0x1e, 0x64, 0x04, 0x6b, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x80, 
-	0x21, 0x10, 0x21, 0x01, 0x21, 0x09, 0x31, 0x11, 0x40, 0x0a, 0x23, 0x33, 0x7b, 0x7c, 0xee, 0xca, 
-	0xd5, 0x40, 0x00, 0x00, 0x0d, 0x40, 0x00, 0x01, 0x00, 0x24, 0x45, 0x05, 0x54, 0x64, 0x4a, 0x01, 
-	0x00, 0x53, 0x29, 0x11, 0x11, 0x4c, 0x93, 0xaa, 0xaa, 0xd5, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xaa, 0x92, 0x54, 0xa4, 0xaa, 0x4a, 
-	0x55, 0x55, 0x55, 0x49, 0x24, 0xaa, 0xa4, 0xa4, 0xa4, 0x49, 0x29, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 
-	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5b, 0x55, 0x56, 
-	0xab, 0x55, 0xaa, 0xaa, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	0xc8, 0x00, 0xc8, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 
+	0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x02, 0xff, 0xff, 0x00, 0xd0, 0x00, 0x01, 0x07, 0x02, 0xd0, 
+	0x18, 0x08, 0x01, 0x04, 0x00, 0x40, 0x00, 0x10, 0x10, 0x00, 0x80, 0x80, 0x0b, 0x00, 0x40, 0xa8, 
+	0x18, 0x0c, 0x1b, 0x00, 0x8a, 0x40, 0x11, 0xc6, 0x01, 0x08, 0x46, 0x91, 0x00, 0x84, 0x44, 0xa4, 
+	0x19, 0x0c, 0x1e, 0x00, 0x96, 0xa0, 0x12, 0xb4, 0x01, 0x15, 0x5a, 0xaa, 0x00, 0xca, 0xb4, 0xa4, 
+	0x31, 0x0c, 0x1f, 0x00, 0x9a, 0xe0, 0x12, 0x94, 0x01, 0x55, 0x55, 0xbb, 0x00, 0x8a, 0xa4, 0xa4, 
+	0x31, 0x0a, 0x0e, 0x00, 0x92, 0x80, 0x32, 0xd6, 0x01, 0x55, 0x56, 0xa1, 0x80, 0xac, 0x31, 0x84, 
+	0x74, 0x07, 0x09, 0x00, 0x00, 0x88, 0x88, 0x10, 0x00, 0x04, 0xd4, 0xba, 0xac, 0xae, 0xd8, 0x19, 
+	0xd9, 0x12, 0x10, 0x4a, 0xaa, 0xaa, 0xa5, 0x52, 0x55, 0x55, 0x49, 0x24, 0x95, 0x54, 0xa5, 0x55, 
+	0x55, 0x55, 0x4a, 0x55, 0x80, 0x06, 0x88, 0x04, 0x00, 0xb5, 0x80, 0x0d, 0x01, 0x55, 0xaa, 0xc0, 
+	0x00, 0x80, 0x31, 0x8c, 0x00, 0x00, 0xd5, 0x84, 0x21, 0xa0, 0x00, 0x03, 0xbf, 0xde, 0xff, 0xfa, 
+	0xc4, 0x30, 0x0b, 0xab, 0x40, 0x01, 0x00, 0x0d, 0x5f, 0x77, 0x77, 0x7f, 0xff, 0x77, 0x77, 0x80, 
+	0x02, 0x04, 0x77, 0x7d, 0xf7, 0x77, 0xdf, 0x84, 0x04, 0x06, 0xdd, 0x55, 0xc0, 0x00, 0x00, 0x05, 
+	0x60, 0xc0, 0xc6, 0x09, 0xaa, 0x41, 0xe2, 0x36, 0x4d, 0x4d, 0xbb, 0x6d, 0xb6, 0xdb, 0x84, 0x02, 
+	0x94, 0x07, 0x80, 0x02, 0x06, 0x55, 0x84, 0x09, 0x00, 0x2d, 0x6a, 0x02, 0xb8, 0x62, 0x07, 0xa9, 
+	0xab, 0x48, 0x08, 0x00, 0x06, 0xab, 0x05, 0xb0, 0x91, 0x84, 0x00, 0x06, 0x88, 0x31, 0x20, 0x2d, 
+	0x55, 0x05, 0x56, 0xb4, 0x31, 0x13, 0xad, 0xaa, 0x4b, 0x80, 0x00, 0x0d, 0x6a, 0x05, 0x6a, 0xd5, 
+	0x55, 0xb6, 0xdb, 0x55, 0xb6, 0xd5, 0xb6, 0xd6, 0xdb, 0x6d, 0x80, 0x61, 0x13, 0x5b, 0x6d, 0x69, 
+	0x55, 0xc4, 0x02, 0x00, 0x0a, 0xab, 0x7a, 0xaa, 0xad, 0xb6, 0xaa, 0xaa, 0xb6, 0xaa, 0xad, 0x55, 
+	0x5a, 0x94, 0x31, 0x04, 0xab, 0x42, 0x01, 0x2a, 0xcd, 0xaa, 0x05, 0x90, 0xae, 0x05, 0x55, 0x84, 
+	0x00, 0x00, 0x0d, 0x75, 0xc0, 0x7b, 0x05, 0xaa, 0x40, 0x02, 0x00, 0x05, 0x20, 0xc4, 0x31, 0x04, 
+	0xf7, 0x7b, 0xff, 0xfd, 0xa0, 0xc0, 0x18, 0x00, 0xab, 0x80, 0x5f, 0xc9, 0x12, 0x04, 0x55, 0x40, 
+	0x82, 0x04, 0x0d, 0xc4, 0x4a, 0x04, 0xaa, 0x85, 0x60, 0x06, 0x0d, 0xc4, 0x4a, 0x03, 0x55, 0x41, 
+	0x29, 0x0a, 0xc8, 0x4a, 0x03, 0xab, 0xc6, 0x28, 0x0b, 0xc8, 0x4a, 0x03, 0x55, 0x4a, 0x02, 0x11, 
+	0xc8, 0x4a, 0x04, 0xaa, 0x84, 0x11, 0x1d, 0x85, 0xcc, 0x95, 0x02, 0x10, 0x20, 0x8d, 0xc4, 0x4a, 
+	0x04, 0xab, 0x82, 0x22, 0x20, 0xcd, 0xc8, 0x95, 0x03, 0x40, 0x00, 0x61, 0xa5, 0xc9, 0xf3, 0x03, 
+	0xd5, 0x53, 0x14, 0x4d, 0xc8, 0x95, 0x03, 0x40, 0x0a, 0x82, 0x2d, 0xc9, 0x2b, 0x00, 0x81, 0x81, 
+	0x76, 0xc8, 0x95, 0x02, 0x42, 0x82, 0x20, 0xc9, 0x76, 0x03, 0xaa, 0xc2, 0x81, 0x16, 0xcd, 0x2b, 
+	0x02, 0x42, 0xa0, 0x05, 0xc8, 0x4a, 0x02, 0xab, 0x44, 0x9a, 0xd1, 0x2b, 0x03, 0x88, 0x18, 0x0a, 
+	0x05, 0xc9, 0x2b, 0x02, 0x40, 0x32, 0x0b, 0xcc, 0x95, 0x02, 0xc4, 0x59, 0x09, 0xc8, 0x4a, 0x02, 
+	0xab, 0x42, 0x90, 0xd0, 0x31, 0x04, 0x80, 0x01, 0x00, 0x05, 0x50, 0xc4, 0x63, 0x03, 0x7f, 0xff, 
+	0x7b, 0xfd, 0xc8, 0x31, 0x03, 0xff, 0xfe, 0x00, 0x06, 0xc9, 0x2b, 0x03, 0x7f, 0x7e, 0x03, 0x0d, 
+	0xca, 0xbb, 0x03, 0xff, 0x3e, 0x00, 0x8d, 0xc9, 0x8f, 0x02, 0x7f, 0x7e, 0x07, 0xc8, 0x7c, 0x80, 
+	0x31, 0x00, 0x01, 0xcd, 0x2b, 0x02, 0x7d, 0x5e, 0x0a, 0xcd, 0x2b, 0x02, 0xfc, 0x9e, 0x12, 0xcd, 
+	0x2b, 0x02, 0x7f, 0xfe, 0x14, 0xcc, 0xf9, 0x02, 0xfc, 0x9e, 0x18, 0xcd, 0x2b, 0x02, 0x7a, 0x5e, 
+	0x00, 0xc8, 0x4a, 0x04, 0x55, 0xff, 0xff, 0x52, 0x4d, 0xc8, 0xc7, 0x03, 0x40, 0x02, 0x09, 0x2d, 
+	0xc8, 0x95, 0x81, 0x5d, 0xca, 0x0c, 0x83, 0x83, 0x00, 0x03, 0xce, 0xed, 0x02, 0x88, 0x02, 0x04, 
+	0xca, 0xa2, 0x03, 0xaa, 0x46, 0x01, 0x08, 0xce, 0xed, 0x02, 0xc1, 0x82, 0x11, 0xc9, 0x5d, 0x03, 
+	0xab, 0x40, 0x60, 0x2b, 0xca, 0xa2, 0x03, 0x55, 0x80, 0x12, 0x26, 0xcf, 0x83, 0x03, 0x40, 0x01, 
+	0x34, 0x0c, 0xc8, 0x63, 0x01, 0x80, 0x00, 0xd1, 0xf3, 0x01, 0x40, 0x02, 0xd3, 0x1f, 0x03, 0xff, 
+	0xfb, 0xfb, 0xed, 0xca, 0x57, 0x82, 0x21, 0xd2, 0x89, 0x01, 0x02, 0x00, 0xc8, 0xae, 0x03, 0xab, 
+	0x4d, 0xb1, 0x3e, 0xcc, 0xf9, 0x03, 0x80, 0x08, 0x22, 0xad, 0xc9, 0x8f, 0x03, 0x48, 0x09, 0x35, 
+	0x45, 0xc8, 0xf9, 0x02, 0xc8, 0x08, 0x2a, 0xc8, 0x4a, 0x03, 0xab, 0x48, 0x0a, 0x2a, 0xc8, 0x4a, 
+	0x04, 0x55, 0x8a, 0xa8, 0x3f, 0xc5, 0xc9, 0x8f, 0x00, 0x40, 0xd1, 0xda, 0x84, 0xc7, 0xce, 0xbb, 
+	0x02, 0x52, 0xa9, 0x22, 0xce, 0xbb, 0x03, 0xc8, 0x45, 0x49, 0x55, 0xce, 0x57, 0x81, 0x2b, 0xcb, 
+	0x1f, 0xd8, 0x63, 0x03, 0x47, 0xf1, 0x1f, 0xc5, 0xcb, 0x83, 0x02, 0x88, 0x08, 0x2a, 0xce, 0xbb, 
+	0x81, 0x2b, 0x00, 0xad, 0xc8, 0x63, 0x81, 0x2b, 0xd2, 0x57, 0x01, 0x02, 0x2a, 0xc9, 0x12, 0x03, 
+	0x55, 0x87, 0x61, 0x1d, 0xd2, 0x57, 0xe1, 0xf3, 0xcf, 0x83, 0x03, 0x7f, 0xff, 0xf7, 0xf5, 0xd6, 
+	0x89, 0xc8, 0x4a, 0x89, 0x8f, 0xc8, 0x95, 0x03, 0xc2, 0xc0, 0x0d, 0x05, 0xc8, 0xc7, 0x03, 0x44, 
+	0x32, 0x15, 0xcd, 0xc8, 0xf9, 0x81, 0x2b, 0xde, 0x57, 0xcd, 0x5d, 0x01, 0x10, 0x35, 0xc9, 0x5d, 
+	0x04, 0xab, 0x46, 0xb2, 0x1f, 0x8d, 0xc8, 0x63, 0x01, 0xc0, 0x01, 0xcf, 0x51, 0xdd, 0x2b, 0x03, 
+	0x82, 0x93, 0x00, 0x4d, 0xc9, 0x2b, 0x03, 0x69, 0x4a, 0xb6, 0x95, 0xfd, 0x2b, 0xa8, 0x63, 0xd1, 
+	0x76, 0x03, 0x55, 0xc7, 0x31, 0x19, 0xcd, 0xf3, 0x03, 0x48, 0x88, 0x2e, 0xc5, 0xcd, 0x2b, 0x01, 
+	0x09, 0x32, 0xce, 0x57, 0x03, 0x40, 0x10, 0x2a, 0xcd, 0xc9, 0x2b, 0x02, 0x84, 0x22, 0x15, 0xcc, 
+	0x63, 0x03, 0x41, 0x81, 0x0e, 0x05, 0xcd, 0x2b, 0xe4, 0xc7, 0xc8, 0x63, 0x03, 0x7f, 0xfb, 0xf7, 
+	0xb5, 0xc8, 0x63, 0x85, 0x12, 0xc8, 0x63, 0x84, 0x4a, 0xc8, 0x63, 0x02, 0xc1, 0xb0, 0x06, 0xcf, 
+	0x51, 0x03, 0x42, 0x12, 0x0a, 0xcd, 0xc8, 0x63, 0x02, 0x84, 0x21, 0x1a, 0xcd, 0xf3, 0x02, 0x44, 
+	0x60, 0x2b, 0xca, 0x89, 0x04, 0xaa, 0x80, 0x22, 0x29, 0x8e, 0xc9, 0xc1, 0x03, 0x4d, 0x11, 0x3f, 
+	0xca, 0xc4, 0x18, 0x02, 0xab, 0xc0, 0x40, 0xdc, 0xc7, 0xd0, 0x63, 0x83, 0x1f, 0xcd, 0x2b, 0x02, 
+	0xff, 0xff, 0xfd, 0xc8, 0xc7, 0x00, 0xaa, 0x80, 0x00, 0xc8, 0x95, 0x84, 0x00, 0xc8, 0x63, 0xe8, 
+	0x31, 0xc4, 0xae, 0x03, 0xab, 0xdb, 0x6d, 0xad, 0xcb, 0x6a, 0x00, 0x55, 0x87, 0x06, 0xc6, 0xa2, 
+	0x00, 0xaa, 0x85, 0xc1, 0xc8, 0x63, 0x80, 0x31, 0x00, 0x04, 0xc9, 0x2b, 0x80, 0x31, 0x00, 0x0e, 
+	0xd4, 0x31, 0x00, 0x0a, 0xcb, 0x83, 0x02, 0xc0, 0x2a, 0xa8, 0xca, 0xd4, 0x84, 0x31, 0xc9, 0x5d, 
+	0xe2, 0x57, 0x81, 0xa8, 0xc9, 0x2b, 0x01, 0x81, 0x80, 0xd3, 0x83, 0x00, 0x43, 0x80, 0x63, 0xc8, 
+	0xc7, 0x02, 0xda, 0x3f, 0xff, 0xcb, 0x38, 0x01, 0x55, 0x4c, 0xfd, 0x2b, 0x84, 0x00, 0x07, 0x81, 
+	0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x90, 0xc7, 0x13, 0x64, 0x92, 0x94, 0xa5, 0x29, 0x4a, 
+	0x52, 0x94, 0xa5, 0x54, 0x28, 0x50, 0xa1, 0x42, 0x85, 0x0a, 0x14, 0x28, 0x54, 0x91, 0x88, 0xc7, 
+	0x01, 0x3f, 0xff, 0xbc, 0x00, 0x01, 0x55, 0x40, 0x80, 0x7c, 0x13, 0xa4, 0x94, 0x92, 0x49, 0x24, 
+	0x92, 0x49, 0x49, 0x29, 0x25, 0x4a, 0x95, 0x29, 0x29, 0x52, 0xa4, 0xa5, 0x25, 0x24, 0x95, 0x87, 
+	0x9c, 0x09, 0x85, 0x55, 0x6a, 0xd5, 0xad, 0x5b, 0x5a, 0xb6, 0xaa, 0xd5, 0x81, 0xe6, 0x08, 0x56, 
+	0xaa, 0xaa, 0xab, 0x55, 0x5a, 0xab, 0x6a, 0xab, 0x85, 0xc1, 0x85, 0xf7, 0x02, 0x54, 0xaa, 0xa9, 
+	0x89, 0xff, 0x90, 0x00, 0x00, 0x2a, 0x88, 0x95, 0xa4, 0x11, 0x98, 0x00, 0x94, 0x31, 0x84, 0x00, 
+	0x00, 0x4a, 0x8a, 0x4c, 0x8c, 0x00, 0x80, 0x95, 0x04, 0x40, 0x05, 0x6e, 0xdb, 0x6d, 0x8c, 0x8a, 
+	0x0b, 0xfe, 0xef, 0x6d, 0xf7, 0x7d, 0xdf, 0xdd, 0xdd, 0xfb, 0xbb, 0xfb, 0xd5, 0x84, 0x95, 0x80, 
+	0x35, 0x07, 0xff, 0xfb, 0xba, 0xdb, 0x08, 0x5b, 0xb8, 0x41, 0x80, 0xe4, 0x07, 0x88, 0xa2, 0x48, 
+	0x84, 0x46, 0x88, 0xd5, 0xc0, 0x90, 0x18, 0x10, 0xfd, 0xdf, 0x77, 0x6b, 0x6e, 0xef, 0x7f, 0x00, 
+	0x48, 0x89, 0x05, 0x77, 0x45, 0x31, 0x12, 0xad, 0xd5, 0x84, 0x63, 0x14, 0x43, 0xff, 0xf8, 0xff, 
+	0xee, 0xeb, 0xdd, 0x55, 0x7b, 0xb9, 0x00, 0x00, 0x40, 0x4e, 0x72, 0xaa, 0xe2, 0x12, 0xaa, 0xee, 
+	0xd5, 0x80, 0x95, 0x01, 0x0a, 0xc3, 0x80, 0x18, 0x0f, 0xfd, 0xdd, 0x7f, 0x55, 0x5e, 0xed, 0xff, 
+	0x00, 0x41, 0x08, 0x85, 0x9c, 0x94, 0xaa, 0xaa, 0x99, 0x90, 0x31, 0x11, 0xf0, 0xff, 0xfb, 0xbf, 
+	0xd5, 0xaa, 0xb7, 0xb8, 0x00, 0x00, 0x42, 0x28, 0x8a, 0xaa, 0xc8, 0x94, 0x03, 0x88, 0x84, 0x31, 
+	0x88, 0x4a, 0x10, 0xfd, 0xd5, 0x7f, 0x55, 0x6d, 0xef, 0xff, 0x08, 0x48, 0x08, 0x89, 0x67, 0x4a, 
+	0x91, 0x12, 0xad, 0xd6, 0x85, 0x5d, 0x88, 0x63, 0x0e, 0xff, 0xeb, 0x55, 0x7e, 0xb8, 0x01, 0x00, 
+	0x44, 0x4a, 0x22, 0x2a, 0x62, 0x32, 0xaa, 0xea, 0x88, 0x95, 0x84, 0x18, 0x0f, 0xff, 0xda, 0xdf, 
+	0x55, 0x57, 0xed, 0xdd, 0x00, 0x41, 0x09, 0x55, 0xdc, 0xa2, 0x2a, 0xa2, 0xaa, 0x88, 0xc7, 0x80, 
+	0x63, 0x12, 0xaa, 0xb1, 0x36, 0xb5, 0xaa, 0xba, 0xba, 0xab, 0xff, 0xfa, 0xbd, 0xab, 0x33, 0xdd, 
+	0xdb, 0xbe, 0xdd, 0xd5, 0x80, 0x8c, 0x31, 0x06, 0x80, 0x24, 0x04, 0x01, 0x12, 0x60, 0x0c, 0x84, 
+	0xe0, 0x06, 0x8a, 0xcc, 0x40, 0x0b, 0x9a, 0x00, 0x6b, 0x8c, 0x31, 0x12, 0xf8, 0x00, 0x20, 0x12, 
+	0x81, 0x44, 0x25, 0x48, 0xa6, 0x44, 0x48, 0x89, 0x14, 0x44, 0x51, 0x1e, 0xa4, 0x84, 0x55, 0x80, 
+	0x95, 0x80, 0x7c, 0x12, 0xf9, 0x00, 0x20, 0x44, 0x11, 0x11, 0x60, 0x2b, 0x11, 0x11, 0x80, 0x0a, 
+	0x23, 0x33, 0x7f, 0xfc, 0xee, 0xaa, 0xea, 0x84, 0xc7, 0x14, 0xc3, 0xff, 0xf0, 0x80, 0x21, 0x04, 
+	0x01, 0x44, 0x2a, 0x88, 0x01, 0x44, 0x62, 0x28, 0x8a, 0x11, 0x40, 0x0a, 0xaa, 0x8c, 0xd5, 0x81, 
+	0xc1, 0x84, 0xc7, 0x10, 0x00, 0x20, 0x04, 0x45, 0x12, 0xa0, 0x0c, 0x43, 0x00, 0x40, 0x08, 0x8a, 
+	0xcc, 0x48, 0x93, 0x9a, 0x40, 0x89, 0x8f, 0x80, 0x03, 0x11, 0x80, 0x20, 0x04, 0x01, 0x24, 0x64, 
+	0xac, 0x4d, 0x4a, 0x48, 0xc9, 0x12, 0x44, 0x41, 0x1e, 0x64, 0x04, 0x6b, 0x84, 0x63, 0x84, 0x18, 
+	0x06, 0x21, 0x10, 0x21, 0x01, 0x21, 0x09, 0x31, 0x80, 0x46, 0x05, 0x23, 0x33, 0x7b, 0x7c, 0xee, 
+	0xca, 0x89, 0x2b, 0x14, 0x40, 0x00, 0x01, 0x00, 0x24, 0x45, 0x05, 0x54, 0x64, 0x4a, 0x01, 0x00, 
+	0x53, 0x29, 0x11, 0x11, 0x4c, 0x93, 0xaa, 0xaa, 0xd5, 0x81, 0xb7, 0x01, 0xfd, 0x7f, 0xc2, 0x57, 
+	0x86, 0x31, 0x8a, 0x23, 0x04, 0x92, 0x54, 0xa4, 0xaa, 0x4a, 0x80, 0x09, 0x08, 0x49, 0x24, 0xaa, 
+	0xa4, 0xa4, 0xa4, 0x49, 0x29, 0x55, 0xa1, 0xfe, 0x8c, 0x23, 0x03, 0x5b, 0x55, 0x56, 0xab, 0x80, 
+	0x15, 0x00, 0xab, 0xc0, 0x45, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 
+	0x00, 0xfc, 0x00, 0xbc, 0x00
 };
@@ -2,7 +2,7 @@
 
 void WatchyPokemon::drawWatchFace(){
     display.fillScreen(GxEPD_WHITE);
-    display.drawBitmap(0, 0, pokemon, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK);
+    display.drawPackedBitmap(0, 0, pokemon, GxEPD_BLACK);
     display.setTextColor(GxEPD_BLACK);
     display.setFont(&FreeMonoBold9pt7b);
     display.setCursor(10, 170);
@@ -0,0 +1,148 @@
+#ifndef MADE_Sunflower_PERSONAL_USE39pt7b_RUNS_H
+#define MADE_Sunflower_PERSONAL_USE39pt7b_RUNS_H
+
+// MADE_Sunflower_PERSONAL_USE39pt7b subset to "0-9:", glyphs run-length encoded
+// for WatchyDisplay::setFont(const runFont *), generated by
+// extras/host/tools/fontrle. Include it instead of MADE_Sunflower_PERSONAL_USE39pt7b.h.
+
+const uint8_t MADE_Sunflower_PERSONAL_USE39pt7bRuns[] PROGMEM = {
+    0x00, 0x10, 0xFD, 0x20, 0xCF, 0x03, 0x20, 0xB7, 0x2C, 0x20, 0x97, 0x6C,
+    0x20, 0x87, 0x8C, 0x20, 0x78, 0x9C, 0x20, 0x68, 0xAD, 0x20, 0x59, 0xBC,
+    0x20, 0x59, 0xBD, 0x21, 0x49, 0xDD, 0x21, 0x3A, 0xED, 0x20, 0x2B, 0xEE,
+    0x20, 0x2B, 0xFD, 0x30, 0x1B, 0xF0, 0x1D, 0x31, 0x1B, 0xF0, 0x1E, 0x31,
+    0x1B, 0xF0, 0x2D, 0x33, 0x0C, 0xF0, 0x2E, 0x37, 0x0D, 0xF0, 0x2D, 0x30,
+    0x0E, 0xF0, 0x1D, 0x33, 0x1D, 0xF0, 0x1C, 0x20, 0x1E, 0xFC, 0x21, 0x2D,
+    0xFB, 0x21, 0x3D, 0xEA, 0x20, 0x4C, 0xE9, 0x20, 0x4D, 0xCA, 0x20, 0x5C,
+    0xC9, 0x20, 0x5D, 0xB8, 0x20, 0x6C, 0xA9, 0x20, 0x7C, 0x98, 0x20, 0x8C,
+    0x78, 0x20, 0x9C, 0x58, 0x20, 0xBF, 0x06, 0x20, 0xCF, 0x03, 0x10, 0xFD,
+    0x00,
+    // '0'
+    0x20, 0xF0, 0x13, 0x10, 0xE5, 0x10, 0xB8, 0x10, 0x9A, 0x10, 0x7C, 0x10,
+    0x4F, 0x20, 0x2F, 0x02, 0x22, 0x0F, 0x04, 0x10, 0x4F, 0x11, 0x5E, 0x1F,
+    0x6D, 0x1F, 0x6D, 0x11, 0x6D, 0x11, 0x5F, 0x20, 0x4F, 0x02, 0x20, 0x3F,
+    0x05, 0x21, 0x0F, 0x0B,
+    // '1'
+    0x10, 0xDB, 0x20, 0xAF, 0x02, 0x20, 0x8F, 0x07, 0x20, 0x69, 0x5C, 0x20,
+    0x58, 0x9B, 0x20, 0x48, 0xBB, 0x20, 0x38, 0xCC, 0x20, 0x38, 0xDC, 0x20,
+    0x28, 0xEC, 0x20, 0x28, 0xED, 0x21, 0x19, 0xED, 0x21, 0x1A, 0xDD, 0x20,
+    0x1B, 0xCD, 0x21, 0x1F, 0x7E, 0x20, 0x1E, 0x8E, 0x20, 0x2D, 0x7F, 0x20,
+    0x3B, 0x8E, 0x20, 0x49, 0x8F, 0x20, 0x56, 0xAE, 0x20, 0xF0, 0x5F, 0x20,
+    0xF0, 0x5E, 0x20, 0xF0, 0x4E, 0x20, 0xF0, 0x3E, 0x20, 0xF0, 0x2D, 0x20,
+    0xF0, 0x1D, 0x10, 0xFC, 0x10, 0xEC, 0x10, 0xDB, 0x10, 0xBB, 0x10, 0xAA,
+    0x10, 0x99, 0x10, 0x88, 0x10, 0x77, 0x30, 0x66, 0xF0, 0x82, 0x30, 0x56,
+    0xF0, 0x92, 0x30, 0x45, 0xF0, 0xA3, 0x30, 0x35, 0xF0, 0xB3, 0x30, 0x34,
+    0xF0, 0xB4, 0x30, 0x25, 0xF0, 0xA5, 0x30, 0x24, 0xF0, 0x97, 0x30, 0x23,
+    0xF0, 0x7A, 0x33, 0x1F, 0x0F, 0x06, 0x35, 0x0F, 0x0F, 0x07,
+    // '2'
+    0x34, 0x5F, 0x0F, 0x04, 0x30, 0x5F, 0x0F, 0x03, 0x30, 0x5F, 0x0F, 0x02,
+    0x30, 0x5F, 0x0F, 0x01, 0x30, 0x4F, 0x0F, 0x01, 0x20, 0x4F, 0x0E, 0x30,
+    0x45, 0xF0, 0x35, 0x30, 0x43, 0xF0, 0x45, 0x30, 0x42, 0xF0, 0x45, 0x20,
+    0xF0, 0x95, 0x20, 0xF0, 0x85, 0x20, 0xF0, 0x75, 0x20, 0xF0, 0x65, 0x20,
+    0xF0, 0x55, 0x20, 0xF0, 0x45, 0x20, 0xF0, 0x35, 0x20, 0xF0, 0x25, 0x20,
+    0xF0, 0x1E, 0x20, 0xFF, 0x02, 0x20, 0xFF, 0x04, 0x30, 0xF0, 0x4F, 0x01,
+    0x20, 0xF0, 0x7E, 0x20, 0xF0, 0x9D, 0x20, 0xF0, 0xAD, 0x21, 0xF0, 0xBD,
+    0x21, 0xF0, 0xCD, 0x30, 0x65, 0xF0, 0x1D, 0x20, 0x49, 0xFD, 0x20, 0x3B,
+    0xED, 0x20, 0x2D, 0xDD, 0x20, 0x1E, 0xDD, 0x21, 0x1F, 0xCD, 0x30, 0x1B,
+    0xF0, 0x1D, 0x30, 0x1A, 0xF0, 0x2D, 0x30, 0x1A, 0xF0, 0x2C, 0x31, 0x19,
+    0xF0, 0x2D, 0x30, 0x28, 0xF0, 0x2C, 0x30, 0x29, 0xF0, 0x1C, 0x20, 0x38,
+    0xFC, 0x20, 0x47, 0xEC, 0x20, 0x57, 0xDB, 0x20, 0x68, 0x9B, 0x20, 0x8F,
+    0x0A, 0x20, 0xAF, 0x06, 0x10, 0xDF, 0x00,
+    // '3'
+    0x20, 0xF0, 0xBA, 0x20, 0xF0, 0xAB, 0x20, 0xF0, 0x9C, 0x21, 0xF0, 0x8D,
+    0x20, 0xF0, 0x7E, 0x21, 0xF0, 0x6F, 0x30, 0xF0, 0x5F, 0x01, 0x31, 0xF0,
+    0x4F, 0x02, 0x30, 0xF0, 0x34, 0x1D, 0x30, 0xF0, 0x25, 0x1D, 0x30, 0xF0,
+    0x24, 0x2D, 0x30, 0xF0, 0x14, 0x3D, 0x20, 0xF5, 0x3D, 0x20, 0xF4, 0x4D,
+    0x20, 0xE4, 0x5D, 0x20, 0xD5, 0x5D, 0x20, 0xC5, 0x6D, 0x20, 0xC4, 0x7D,
+    0x20, 0xB5, 0x7D, 0x20, 0xA5, 0x8D, 0x20, 0xA4, 0x9D, 0x20, 0x94, 0xAD,
+    0x20, 0x85, 0xAD, 0x20, 0x84, 0xBD, 0x20, 0x74, 0xCD, 0x20, 0x65, 0xCD,
+    0x20, 0x64, 0xDD, 0x20, 0x54, 0xED, 0x20, 0x45, 0xED, 0x20, 0x35, 0xFD,
+    0x30, 0x34, 0xF0, 0x1D, 0x30, 0x25, 0xF0, 0x1D, 0x30, 0x15, 0xF0, 0x2D,
+    0x30, 0x1F, 0x0F, 0x0D, 0x31, 0x0F, 0x0F, 0x0E, 0x26, 0xF0, 0x8D, 0x20,
+    0xF0, 0x7E, 0x21, 0xF0, 0x7F, 0x30, 0xF0, 0x6F, 0x02, 0x30, 0xF0, 0x4F,
+    0x06, 0x31, 0xF0, 0x1F, 0x0B,
+    // '4'
+    0x31, 0xF0, 0xF0, 0x62, 0x30, 0xF0, 0xF0, 0x53, 0x30, 0xF0, 0xF0, 0x35,
+    0x34, 0x7F, 0x0F, 0x01, 0x24, 0x7F, 0x0F, 0x11, 0x73, 0x15, 0x63, 0x20,
+    0x63, 0x5F, 0x30, 0x63, 0x1F, 0x07, 0x20, 0x6F, 0x0D, 0x20, 0x6F, 0x0E,
+    0x20, 0x6F, 0x0F, 0x30, 0x62, 0xCF, 0x02, 0x30, 0xF0, 0x7F, 0x01, 0x20,
+    0xF0, 0x9F, 0x20, 0xF0, 0xAE, 0x20, 0xF0, 0xAF, 0x20, 0xF0, 0xBE, 0x20,
+    0xF0, 0xBF, 0x21, 0xF0, 0xCE, 0x30, 0x74, 0xF0, 0x1E, 0x20, 0x49, 0xFD,
+    0x20, 0x3B, 0xED, 0x20, 0x2D, 0xDD, 0x20, 0x2E, 0xCD, 0x21, 0x1F, 0xCD,
+    0x20, 0x1C, 0xFD, 0x31, 0x1A, 0xF0, 0x2C, 0x30, 0x1A, 0xF0, 0x1C, 0x30,
+    0x29, 0xF0, 0x1C, 0x30, 0x29, 0xF0, 0x1B, 0x30, 0x38, 0xF0, 0x1B, 0x20,
+    0x38, 0xFB, 0x20, 0x48, 0xDB, 0x20, 0x58, 0xBB, 0x20, 0x68, 0x9B, 0x20,
+    0x8F, 0x09, 0x20, 0xAF, 0x05, 0x10, 0xDE, 0x00,
+    // '5'
+    0x20, 0xF0, 0xC6, 0x20, 0xF0, 0x8A, 0x20, 0xF0, 0x5B, 0x20, 0xF0, 0x3A,
+    0x20, 0xF0, 0x1A, 0x10, 0xEA, 0x10, 0xDA, 0x10, 0xBB, 0x10, 0xAB, 0x10,
+    0x9B, 0x10, 0x8B, 0x10, 0x7B, 0x10, 0x6C, 0x10, 0x6B, 0x10, 0x5C, 0x11,
+    0x4C, 0x10, 0x3D, 0x10, 0x3C, 0x20, 0x3C, 0x57, 0x20, 0x2D, 0x2E, 0x30,
+    0x2F, 0x0F, 0x01, 0x30, 0x2F, 0x0F, 0x03, 0x40, 0x1F, 0x02, 0x2F, 0x01,
+    0x20, 0x1F, 0x6F, 0x20, 0x1E, 0x8F, 0x20, 0x1D, 0xAE, 0x21, 0x1D, 0xBE,
+    0x22, 0x0D, 0xDE, 0x22, 0x0D, 0xED, 0x20, 0x1C, 0xED, 0x20, 0x1C, 0xFC,
+    0x22, 0x1D, 0xEC, 0x21, 0x2C, 0xEC, 0x20, 0x2D, 0xDB, 0x20, 0x3C, 0xDB,
+    0x20, 0x4B, 0xDA, 0x20, 0x4C, 0xCA, 0x20, 0x5B, 0xC9, 0x20, 0x6B, 0xA9,
+    0x20, 0x7B, 0x98, 0x20, 0x8B, 0x78, 0x20, 0xAA, 0x57, 0x20, 0xCF, 0x03,
+    0x10, 0xEE, 0x00,
+    // '6'
+    0x31, 0x2F, 0x0F, 0x06, 0x31, 0x1F, 0x0F, 0x07, 0x31, 0x1F, 0x0F, 0x06,
+    0x30, 0x1F, 0x0F, 0x05, 0x31, 0x1F, 0x0F, 0x04, 0x30, 0x1F, 0x0F, 0x03,
+    0x30, 0x15, 0xF0, 0xA3, 0x30, 0x13, 0xF0, 0xB3, 0x30, 0x12, 0xF0, 0xB4,
+    0x20, 0xF0, 0xD4, 0x20, 0xF0, 0xC5, 0x20, 0xF0, 0xB5, 0x20, 0xF0, 0xA6,
+    0x20, 0xF0, 0x96, 0x20, 0xF0, 0x87, 0x20, 0xF0, 0x78, 0x21, 0xF0, 0x68,
+    0x20, 0xF0, 0x59, 0x20, 0xF0, 0x49, 0x21, 0xF0, 0x3A, 0x20, 0xF0, 0x2A,
+    0x21, 0xF0, 0x1B, 0x10, 0xFC, 0x10, 0xFB, 0x12, 0xEC, 0x11, 0xDD, 0x10,
+    0xCE, 0x12, 0xCD, 0x18, 0xBE, 0x11, 0xCC, 0x10, 0xDA, 0x10, 0xE8, 0x00,
+    // '7'
+    0x20, 0xF0, 0x1B, 0x20, 0xCF, 0x04, 0x20, 0xAF, 0x08, 0x20, 0x99, 0x5C,
+    0x20, 0x7A, 0x8B, 0x20, 0x6A, 0xAB, 0x20, 0x5B, 0xBA, 0x20, 0x5A, 0xDA,
+    0x20, 0x4B, 0xDA, 0x20, 0x4B, 0xDB, 0x22, 0x3C, 0xEA, 0x22, 0x3D, 0xDA,
+    0x20, 0x3E, 0xCA, 0x20, 0x3F, 0xBA, 0x20, 0x4F, 0xA9, 0x30, 0x4F, 0x01,
+    0x8A, 0x30, 0x4F, 0x02, 0x79, 0x30, 0x5F, 0x03, 0x58, 0x30, 0x6F, 0x04,
+    0x28, 0x20, 0x6F, 0x0D, 0x20, 0x7F, 0x0A, 0x20, 0x9F, 0x07, 0x20, 0xAF,
+    0x08, 0x20, 0xBF, 0x09, 0x20, 0xCF, 0x09, 0x20, 0xAF, 0x0C, 0x30, 0x78,
+    0x1F, 0x07, 0x30, 0x68, 0x4F, 0x06, 0x30, 0x58, 0x6F, 0x06, 0x30, 0x3A,
+    0x8F, 0x05, 0x30, 0x39, 0xAF, 0x04, 0x30, 0x2A, 0xCF, 0x02, 0x30, 0x1B,
+    0xDF, 0x02, 0x30, 0x1A, 0xFF, 0x01, 0x31, 0x0B, 0xF0, 0x1F, 0x31, 0x0B,
+    0xF0, 0x2E, 0x31, 0x0B, 0xF0, 0x3D, 0x30, 0x0C, 0xF0, 0x2C, 0x30, 0x1B,
+    0xF0, 0x2C, 0x30, 0x1C, 0xF0, 0x1B, 0x20, 0x2B, 0xFC, 0x20, 0x3B, 0xEB,
+    0x20, 0x4B, 0xCB, 0x20, 0x5B, 0xAB, 0x20, 0x7A, 0x8A, 0x20, 0x9F, 0x09,
+    0x20, 0xCF, 0x03, 0x20, 0xF0, 0x61,
+    // '8'
+    0x10, 0xFA, 0x20, 0xCF, 0x01, 0x20, 0x97, 0x4A, 0x20, 0x86, 0x7B, 0x20,
+    0x68, 0x8B, 0x20, 0x58, 0xAB, 0x20, 0x49, 0xBB, 0x20, 0x3A, 0xCB, 0x20,
+    0x39, 0xDC, 0x20, 0x2A, 0xDD, 0x20, 0x1B, 0xEC, 0x21, 0x1B, 0xED, 0x20,
+    0x0C, 0xFD, 0x24, 0x0D, 0xED, 0x20, 0x0D, 0xEE, 0x21, 0x0E, 0xDE, 0x20,
+    0x1D, 0xDE, 0x20, 0x1E, 0xCE, 0x20, 0x1E, 0xCD, 0x20, 0x2E, 0xBD, 0x20,
+    0x2E, 0xAE, 0x20, 0x3E, 0x9E, 0x20, 0x3F, 0x7F, 0x40, 0x4F, 0x01, 0x3F,
+    0x02, 0x30, 0x5F, 0x0F, 0x04, 0x30, 0x7F, 0x0F, 0x02, 0x20, 0x9F, 0x2D,
+    0x20, 0xCA, 0x4D, 0x20, 0xF0, 0xBC, 0x20, 0xF0, 0xAD, 0x21, 0xF0, 0xAC,
+    0x20, 0xF0, 0x9C, 0x20, 0xF0, 0x9B, 0x20, 0xF0, 0x8C, 0x20, 0xF0, 0x8B,
+    0x20, 0xF0, 0x7B, 0x20, 0xF0, 0x6B, 0x20, 0xF0, 0x5B, 0x20, 0xF0, 0x4B,
+    0x20, 0xF0, 0x3A, 0x20, 0xF0, 0x2A, 0x10, 0xFA, 0x10, 0xDA, 0x10, 0xAB,
+    0x10, 0x8A, 0x10, 0x86,
+    // '9'
+    0x10, 0x56, 0x10, 0x3A, 0x10, 0x2C, 0x10, 0x1E, 0x24, 0x0F, 0x01, 0x11,
+    0x1E, 0x10, 0x2C, 0x10, 0x39, 0x10, 0x81, 0x07, 0x10, 0x48, 0x10, 0x2C,
+    0x11, 0x1E, 0x24, 0x0F, 0x01, 0x11, 0x1E, 0x10, 0x2C, 0x10, 0x48, 0x00,
+    // ':'
+};
+
+const GFXglyph MADE_Sunflower_PERSONAL_USE39pt7bRunGlyphs[] PROGMEM = {
+    {0, 43, 55, 43, 0, -53}, // '0'
+    {109, 26, 53, 30, 2, -52}, // '1'
+    {149, 38, 54, 41, 2, -53}, // '2'
+    {279, 41, 54, 41, -1, -52}, // '3'
+    {430, 44, 53, 44, -1, -52}, // '4'
+    {567, 42, 58, 40, -1, -56}, // '5'
+    {695, 41, 54, 41, 0, -52}, // '6'
+    {818, 38, 54, 40, 1, -52}, // '7'
+    {914, 42, 55, 42, 0, -53}, // '8'
+    {1076, 41, 53, 41, 0, -52}, // '9'
+    {1212, 16, 36, 20, 2, -34}, // ':'
+};
+
+const runFont MADE_Sunflower_PERSONAL_USE39pt7b PROGMEM = {{(uint8_t *)MADE_Sunflower_PERSONAL_USE39pt7bRuns,
+    (GFXglyph *)MADE_Sunflower_PERSONAL_USE39pt7bRunGlyphs, 0x30, 0x3A, 93}};
+
+#endif
@@ -4,7 +4,7 @@
 
 #include <Watchy.h> //include the Watchy library
 #include <Fonts/FreeSansBold9pt7b.h> //include any fonts you want to use
-#include "MadeSunflower39pt7b.h"
+#include "MadeSunflower39pt7b_runs.h"
 #include "stars.h"
 #include "settings.h"
 
@@ -12,6 +12,8 @@
 
 const int horizonY = 150;
 const int planetR = 650;
+// grid lines below the horizon, each sin(i / 10) * 10 pixels further down
+const uint8_t gridY[] = {150, 151, 153, 156, 160, 165, 171, 178, 185, 193};
 
 struct xyPoint {
   int x;
@@ -38,14 +40,14 @@ void initStars() {
   printf("};\n");
 }
 
-struct xyPoint rotatePointAround(int x, int y, int ox, int oy, double angle) {
-  // rotate X,Y point around given origin point by a given angle
+struct xyPoint rotatePointAround(int x, int y, int ox, int oy, int32_t cosA, int32_t sinA) {
+  // rotate X,Y point around given origin point by an angle given as its Q16 cos and sin (see WatchyMath.h)
   // based on https://gist.github.com/LyleScott/e36e08bfb23b1f87af68c9051f985302#file-rotate_2d_point-py-L38
-  double qx = (double)ox + (cos(angle) * (double)(x - ox)) + (sin(angle) * (double)(y - oy));
-  double qy = (double)oy + (-sin(angle) * (double)(x - ox)) + (cos(angle) * (double)(y - oy));
+  int32_t qx = ((int32_t)ox << 16) + cosA * (x - ox) + sinA * (y - oy);
+  int32_t qy = ((int32_t)oy << 16) - sinA * (x - ox) + cosA * (y - oy);
   struct xyPoint newPoint;
-  newPoint.x = (int)qx;
-  newPoint.y = (int)qy;
+  newPoint.x = fixedToInt(qx);
+  newPoint.y = fixedToInt(qy);
   return newPoint;
 }
 
@@ -55,22 +57,20 @@ class StarryHorizon : public Watchy {
           // uncomment to re-generate stars
           // initStars();
         }
-        void drawWatchFace(){
+        bool drawStaticLayer(){
           display.fillScreen(GxEPD_BLACK);
           display.fillCircle(100, horizonY + planetR, planetR, GxEPD_WHITE);
           drawGrid();
+          return true;
+        }
+        void drawWatchFace(){
           drawStars(STARS);
           drawTime();
           drawDate();
         }
         void drawGrid() {
-          int prevY = horizonY;
-          for(int i = 0; i < 40; i+= 1) {
-            int y = prevY + int(abs(sin(double(i) / 10) * 10));
-            if(y <= 200) {
-              display.drawFastHLine(0, y, 200, GxEPD_BLACK);
-            }
-            prevY = y;
+          for(uint8_t y : gridY) {
+            display.drawFastHLine(0, y, 200, GxEPD_BLACK);
           }
           int vanishY = horizonY - 25;
           for (int x = -230; x < 430; x += 20) {
@@ -80,16 +80,34 @@ class StarryHorizon : public Watchy {
         void drawStars(const Star stars[]) {
           // draw field of stars
           // rotate stars so that they make an entire revolution once per hour
-          int minute = (int)currentTime.Minute;
-          double minuteAngle = ((2.0 * M_PI) / 60.0) * (double)minute;
-//          printf("Minute %d, angle %f\n", (int)currentTime.Minute, minuteAngle);
+          int16_t minuteAngle = currentTime.Minute * (ANGLE_STEPS / 60);
+          int32_t c = fixedCos(minuteAngle);
+          int32_t s = fixedSin(minuteAngle);
+
+          // the screen above the horizon rotated back into the star field:
+          // stars outside its bounding box are skipped without rotating them
+          int32_t minX = INT32_MAX, maxX = INT32_MIN, minY = INT32_MAX, maxY = INT32_MIN;
+          for(int corner = 0; corner < 4; corner++) {
+            // a pixel wider each side, as points within a pixel of the edges truncate onto it
+            int32_t ux = (corner & 1 ? 201 : -1) - 100;
+            int32_t uy = (corner & 2 ? horizonY + 1 : -1) - 100;
+            int32_t x = c * ux - s * uy;
+            int32_t y = s * ux + c * uy;
+            minX = min(minX, x); maxX = max(maxX, x);
+            minY = min(minY, y); maxY = max(maxY, y);
+          }
+          minX = (minX >> 16) + 100 - 1; maxX = (maxX >> 16) + 100 + 1;
+          minY = (minY >> 16) + 100 - 1; maxY = (maxY >> 16) + 100 + 1;
 
           for(int starI = 0; starI < STAR_COUNT; starI++) {
             int starX = stars[starI].x;
             int starY = stars[starI].y;
             int starR = stars[starI].r;
+            if(starX < minX || starX > maxX || starY < minY || starY > maxY) {
+              continue;
+            }
 
-            struct xyPoint rotated = rotatePointAround(starX, starY, 100, 100, minuteAngle);
+            struct xyPoint rotated = rotatePointAround(starX, starY, 100, 100, c, s);
             if(rotated.x < 0 || rotated.y < 0 || rotated.x > 200 || rotated.y > horizonY) {
               continue;
             }
@@ -104,39 +122,32 @@ class StarryHorizon : public Watchy {
           display.setFont(&MADE_Sunflower_PERSONAL_USE39pt7b);
           display.setTextColor(GxEPD_WHITE);
           display.setTextWrap(false);
-          char* timeStr;
-          asprintf(&timeStr, "%d:%02d", currentTime.Hour, currentTime.Minute);
+          char timeStr[8];
+          snprintf(timeStr, sizeof(timeStr), "%d:%02d", currentTime.Hour, currentTime.Minute);
           drawCenteredString(timeStr, 100, 115, false);
-          free(timeStr);
         }
 
         void drawDate() {
-          String monthStr = monthShortStr(currentTime.Month);
-          String dayOfWeek = dayShortStr(currentTime.Wday);
           display.setFont(&FreeSansBold9pt7b);
           display.setTextColor(GxEPD_WHITE);
           display.setTextWrap(false);
-          char* dateStr;
-          asprintf(&dateStr, "%s %s %d", dayOfWeek.c_str(), monthStr.c_str(), currentTime.Day);
+          // the day and month names share one buffer
+          char dateStr[16];
+          int n = snprintf(dateStr, sizeof(dateStr), "%s ", dayShortStr(currentTime.Wday));
+          snprintf(dateStr + n, sizeof(dateStr) - n, "%s %d", monthShortStr(currentTime.Month), currentTime.Day);
           drawCenteredString(dateStr, 100, 140, true);
-          free(dateStr);
         }
 
-        void drawCenteredString(const String &str, int x, int y, bool drawBg) {
-          int16_t x1, y1;
-          uint16_t w, h;
-
-          display.getTextBounds(str, x, y, &x1, &y1, &w, &h);
-//          printf("bounds: %d x %d y, %d x1 %d y1, %d w, %d h\n", 0, 100, x1, y1, w, h);
-          display.setCursor(x - w / 2, y);
+        void drawCenteredString(const char *str, int x, int y, bool drawBg) {
+          textBounds bounds = display.measureText(str);
           if(drawBg) {
             int padY = 3;
             int padX = 10;
-            display.fillRect(x - (w / 2 + padX), y - (h + padY), w + padX*2, h + padY*2, GxEPD_BLACK);
+            display.fillRect(x - (bounds.w / 2 + padX), y - (bounds.h + padY), bounds.w + padX*2, bounds.h + padY*2, GxEPD_BLACK);
           }
           // uncomment to draw bounding box
-//          display.drawRect(x - w / 2, y - h, w, h, GxEPD_WHITE);
-          display.print(str);
+//          display.drawRect(x - bounds.w / 2, y - bounds.h, bounds.w, bounds.h, GxEPD_WHITE);
+          display.drawText(x - bounds.w / 2, y, str);
         }
 };
 
@@ -4,7 +4,7 @@ const unsigned char *tetris_nums [10] = {tetris0, tetris1, tetris2, tetris3, tet
 
 void WatchyTetris::drawWatchFace(){
     display.fillScreen(GxEPD_WHITE);
-    display.drawBitmap(0, 0, tetrisbg, DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_BLACK);
+    display.drawPackedBitmap(0, 0, tetrisbg, GxEPD_BLACK);
 
     //Hour
     display.drawBitmap(25, 20, tetris_nums[currentTime.Hour/10], 40, 60, GxEPD_BLACK); //first digit
@@ -218,319 +218,79 @@ const unsigned char tetris9 [] PROGMEM = {
 	0x00, 0x03, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xcd, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 
 	0x03, 0x55, 0x00, 0x00, 0x00, 0x02, 0xab, 0x00, 0x00, 0x00, 0x03, 0xff
 };
-// 'tetris_bg_dither', 200x200px
+// 'tetris_bg_dither', 200x200px, packed 5000 -> 1154 bytes
 const unsigned char tetrisbg [] PROGMEM = {
-	0xff, 0x8a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 
-	0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xc6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xdf, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xca, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xdf, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xdf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 
-	0xdc, 0x3f, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xca, 0x1f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0x70, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x86, 0x10, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x5f, 0x63, 0xe0, 
-	0xf8, 0x3e, 0x1f, 0x87, 0xf9, 0x3f, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0x47, 0x01, 0xce, 0x73, 0x9c, 0xe7, 0x01, 0x3f, 0xff, 
-	0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5f, 
-	0x67, 0x01, 0xce, 0x73, 0x9c, 0xe7, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x23, 0xe1, 0xc0, 0x73, 0x9c, 0xe7, 0xe1, 
-	0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x42, 0x1f, 0x60, 0x79, 0xc0, 0x73, 0x9f, 0x87, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x80, 0x44, 0x79, 0xce, 0x73, 0x9d, 
-	0x07, 0x01, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xdd, 0x63, 0xe0, 0xf8, 0x3e, 0x1c, 0xe7, 0xf9, 0x37, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0x23, 0xe0, 0xf8, 
-	0x3e, 0x1c, 0xe7, 0xf9, 0x1a, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x08, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x37, 0xff, 0x96, 
-	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdb, 0x50, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2d, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcd, 0x1b, 0xbd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x36, 
-	0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-	0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xad, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x46, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd6, 0xa9, 0x4a, 0x55, 0x55, 
-	0x55, 0x55, 0x55, 0xad, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x92, 0xb0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xbf, 0xff, 
-	0xef, 0x77, 0x77, 0x77, 0x7f, 0x7f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x54, 0xd5, 0x29, 0x5a, 0xda, 0xda, 0xda, 0xd2, 0xd5, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xd6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x83, 0xe0, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1d, 
-	0x84, 0x78, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x84, 0x78, 0x00, 0xff, 0x82, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 
-	0x00, 0x11, 0x83, 0xe0, 0x00, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xaa, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x11, 0xe4, 0x78, 0x00, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 
-	0x00, 0x00, 0x00, 0x1f, 0xe4, 0x78, 0x00, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xe0, 0x00, 
-	0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xe0, 0x00, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x86, 0x10, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xff, 0xff, 0xff, 
-	0xfe, 0xf7, 0x7b, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x8a, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x96, 0x50, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x08, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 
-	0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x28, 0x5f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0x1b, 0x76, 0xed, 0xdb, 
-	0xb7, 0x6e, 0xdc, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x59, 0x5f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x70, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 
-	0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 
-	0x67, 0x01, 0xfe, 0x43, 0x9f, 0xe7, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 
-	0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0x67, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0x27, 0x01, 0xf8, 0x43, 0x9f, 
-	0x87, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xaa, 0xdf, 0x67, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x01, 0xc0, 
-	0x36, 0x1c, 0x07, 0x01, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x67, 0xf9, 0xfe, 0x0c, 0x1f, 0xe7, 0xf9, 0x3f, 0xff, 0x92, 
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0x27, 
-	0xf9, 0xfe, 0x0c, 0x1f, 0xe7, 0xf9, 0x3f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 
-	0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xdf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x0f, 0x80, 
-	0x01, 0x3f, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x8a, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x11, 0xe0, 0x01, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0x60, 0x00, 0x00, 0x00, 
-	0x11, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x11, 0xe0, 0x01, 0x3f, 0xff, 0x90, 0x80, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x60, 0x00, 
-	0x00, 0x00, 0x0f, 0xe0, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x01, 0x3f, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 
-	0x60, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 
-	0x3f, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x08, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x02, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xdf, 0x17, 0xff, 0xff, 0xff, 0xfb, 0xbd, 0xec, 0x3f, 0xff, 0x90, 0x80, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb1, 
-	0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
-	0x5f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 
-	0xdc, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x59, 0x5f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x70, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x42, 0x1f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x95, 0xa0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0x67, 0x00, 
-	0xf8, 0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x00, 0x30, 0x73, 0x9c, 0x07, 0x01, 0x3f, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 
-	0x67, 0x00, 0x30, 0x73, 0x9c, 0x07, 0x01, 0x3f, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0x27, 0x00, 0x30, 0x7b, 0x9f, 0x83, 0xe1, 
-	0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xaa, 0xdf, 0x67, 0x00, 0x30, 0x4f, 0x9c, 0x00, 0x79, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x47, 0x00, 0x30, 0x47, 0x9c, 
-	0x04, 0x79, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x42, 0x1f, 0x67, 0xf8, 0xf8, 0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0x92, 0x80, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0x27, 0xf8, 0xf8, 
-	0x43, 0x9f, 0xe3, 0xe1, 0x3f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 
-	0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 
-	0xdf, 0x20, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0x60, 0x00, 0x00, 0x00, 0x1c, 0xe0, 
-	0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x60, 0x00, 0x00, 0x00, 
-	0x1c, 0xe0, 0x01, 0x3f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xd6, 0x9f, 0x20, 0x00, 0x00, 0x00, 0x1c, 0xe0, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x60, 0x00, 
-	0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x40, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0x3f, 0xff, 
-	0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 
-	0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-	0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0x17, 0xff, 0xff, 0xff, 0xfb, 0xbd, 0xec, 0x3f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xca, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb1, 0xa0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 
-	0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xa0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0xc9, 0x24, 0x92, 0x49, 0x24, 0x92, 0x7f, 0xff, 
-	0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 
-	0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xfe, 
-	0x0f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x42, 0x1f, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0x2f, 0xff, 0xff, 0xff, 
-	0xff, 0xfe, 0x1f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x46, 0x9f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0x92, 
-	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 
-	0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 
-	0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xdf, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xcf, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xd6, 0x9f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0x82, 0x10, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0x38, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0x3b, 0xff, 0xff, 0xc0, 0x00, 0x01, 0x4f, 0xff, 
-	0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 
-	0xff, 0xba, 0x49, 0x92, 0x40, 0x00, 0x01, 0x9f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x3b, 0x25, 0xc9, 0x40, 0x00, 0x01, 
-	0xcf, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xca, 0x1f, 0xff, 0x3a, 0x93, 0xa4, 0xc0, 0x00, 0x01, 0x4f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0x3a, 0x75, 0x9d, 0x40, 
-	0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xff, 0xdf, 0xff, 0x9b, 0x31, 0xac, 0x40, 0x00, 0x01, 0x9f, 0xff, 0x86, 0x10, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0x3a, 0x4b, 
-	0x85, 0x40, 0x00, 0x01, 0xcf, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 0x3a, 0xa5, 0xd2, 0xc0, 0x00, 0x01, 0x4f, 0xff, 0x96, 
-	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 
-	0xba, 0x13, 0x94, 0x40, 0x00, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x3b, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xcf, 
-	0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-	0x1f, 0xff, 0x38, 0x00, 0xff, 0xff, 0xf0, 0x01, 0x4f, 0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x9f, 0xff, 0x38, 0x00, 0x82, 0x64, 0x90, 
-	0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xdf, 0xff, 0x98, 0x00, 0xd9, 0x72, 0x50, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x84, 
-	0xe9, 0x30, 0x01, 0xcf, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0x38, 0x00, 0xad, 0x67, 0x50, 0x01, 0x4f, 0xff, 0x96, 0xb0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0xb8, 
-	0x00, 0xac, 0x6b, 0x10, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x92, 0xe1, 0x50, 0x01, 0xcf, 0xff, 
-	0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 
-	0xff, 0x38, 0x00, 0xca, 0x74, 0xb0, 0x01, 0x4f, 0xff, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0x38, 0x00, 0xa1, 0x65, 0x10, 0x01, 
-	0xcf, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x46, 0x9f, 0xff, 0x98, 0x00, 0xff, 0xff, 0xf0, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xcf, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x28, 0x5f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x92, 0xb0, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 0xb8, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0x96, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 
-	0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 
-	0xff, 0x95, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 
-	0x9f, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xcf, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0xff, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xff, 0x82, 0x10, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0xb8, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0x9f, 0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0xaa, 0xdf, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0x17, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x1f, 0xff, 0x0d, 0xbb, 0x76, 0xed, 0xdb, 0xb6, 0x1f, 0xff, 
-	0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 
-	0xff, 0x86, 0xd6, 0xdb, 0x5b, 0x6d, 0x6c, 0x0f, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x3f, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xdf, 0xff, 0xd5, 0x2a, 0x49, 0x54, 0x95, 0x2a, 0xbf, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x8a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x50, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5f, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x96, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 
-	0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0x90, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x42, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x46, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf0, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-	0x92, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdf, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	0xc8, 0x00, 0xc8, 0x00, 0x03, 0xff, 0x8a, 0x50, 0x00, 0xa0, 0x00, 0x02, 0x29, 0x5f, 0xff, 0x94, 
+	0x00, 0x01, 0xbf, 0xf0, 0xa4, 0x18, 0x01, 0xff, 0xdf, 0x98, 0x18, 0x01, 0x90, 0x80, 0xa4, 0x18, 
+	0x01, 0x42, 0x1f, 0x98, 0x18, 0x00, 0x92, 0xa8, 0x18, 0x00, 0x4a, 0x9c, 0x18, 0x01, 0xb1, 0xa0, 
+	0xa4, 0x18, 0x01, 0xc6, 0x9f, 0xfc, 0x63, 0x01, 0x86, 0x10, 0xa4, 0x18, 0x00, 0x18, 0x9c, 0x95, 
+	0x01, 0x92, 0xb0, 0xa8, 0x63, 0x9c, 0x31, 0x00, 0x96, 0xa8, 0xc7, 0x00, 0x59, 0xfc, 0xc7, 0xdc, 
+	0xc7, 0x00, 0x95, 0xa8, 0xae, 0x00, 0xca, 0xfc, 0xae, 0xdc, 0x18, 0x00, 0x82, 0xac, 0xc7, 0xa0, 
+	0xae, 0xac, 0xc7, 0xdc, 0xae, 0x90, 0xa4, 0xbc, 0xae, 0x07, 0x1b, 0x76, 0xed, 0xdb, 0xb7, 0x6e, 
+	0xdc, 0x3f, 0xb1, 0x76, 0x09, 0xca, 0x1f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 0xdb, 0x6a, 0x3f, 0xb1, 
+	0x76, 0x02, 0x46, 0x9f, 0x70, 0x88, 0x07, 0x01, 0x03, 0x3f, 0xb8, 0x63, 0x00, 0x20, 0x88, 0x07, 
+	0x01, 0x01, 0x3f, 0xb9, 0x76, 0x06, 0x63, 0xe0, 0xf8, 0x3e, 0x1f, 0x87, 0xf9, 0x80, 0x63, 0xa8, 
+	0xae, 0x07, 0xaa, 0xdf, 0x47, 0x01, 0xce, 0x73, 0x9c, 0xe7, 0x80, 0x31, 0xad, 0x76, 0x02, 0x09, 
+	0x5f, 0x67, 0x94, 0x18, 0xb4, 0x63, 0x02, 0x23, 0xe1, 0xc0, 0x80, 0x18, 0x01, 0xe1, 0x3f, 0xb8, 
+	0xc7, 0x05, 0x60, 0x79, 0xc0, 0x73, 0x9f, 0x87, 0x80, 0x31, 0xad, 0x76, 0x09, 0xd6, 0x80, 0x44, 
+	0x79, 0xce, 0x73, 0x9d, 0x07, 0x01, 0x00, 0xb4, 0x4a, 0x00, 0xdd, 0x84, 0x95, 0x03, 0x1c, 0xe7, 
+	0xf9, 0x37, 0xb4, 0x18, 0x01, 0xd7, 0x23, 0x8c, 0x18, 0x00, 0x1a, 0xb1, 0x76, 0x02, 0x08, 0x55, 
+	0x60, 0x8c, 0xe0, 0x00, 0x37, 0xb1, 0x76, 0x01, 0xaa, 0xdb, 0x8c, 0xbd, 0x01, 0x02, 0x2d, 0xb4, 
+	0x4a, 0x03, 0xcd, 0x1b, 0xbd, 0xdd, 0x80, 0x00, 0x01, 0xda, 0x36, 0xb4, 0xae, 0x00, 0x1b, 0x90, 
+	0x08, 0x00, 0xdb, 0xb5, 0x76, 0x00, 0x16, 0x90, 0x0e, 0x00, 0xad, 0xb5, 0x76, 0x00, 0x9b, 0x8d, 
+	0xd7, 0x01, 0xfe, 0xf6, 0xb4, 0x63, 0x03, 0xd6, 0xa9, 0x4a, 0x55, 0x84, 0x00, 0x00, 0xad, 0xb1, 
+	0x76, 0x01, 0x28, 0x40, 0x98, 0x22, 0xad, 0x76, 0x09, 0x8a, 0xdf, 0xbf, 0xff, 0xef, 0x77, 0x77, 
+	0x77, 0x7f, 0x7f, 0xb6, 0xed, 0x08, 0x54, 0xd5, 0x29, 0x5a, 0xda, 0xda, 0xda, 0xd2, 0xd5, 0xb4, 
+	0x63, 0x00, 0xc0, 0x98, 0x09, 0xb0, 0xc7, 0x9c, 0x22, 0xb5, 0x76, 0x84, 0x05, 0x02, 0x0f, 0x83, 
+	0xe0, 0xb9, 0x76, 0x88, 0x4a, 0x02, 0x1d, 0x84, 0x78, 0xe0, 0x18, 0xb1, 0x76, 0x88, 0xc7, 0x00, 
+	0x11, 0x84, 0x4a, 0xb1, 0x76, 0x88, 0x31, 0x01, 0x11, 0xe4, 0xd0, 0x4a, 0x00, 0x1f, 0x84, 0x18, 
+	0xc4, 0xae, 0x00, 0x01, 0x84, 0x4a, 0xb1, 0x76, 0x9c, 0x18, 0xb1, 0x76, 0x98, 0x26, 0xdd, 0x12, 
+	0xb1, 0x76, 0x8b, 0x83, 0x03, 0xfe, 0xf7, 0x7b, 0xff, 0xb5, 0x76, 0x9c, 0x31, 0xb1, 0x76, 0x9d, 
+	0xa8, 0xb6, 0xed, 0x9b, 0xce, 0xb6, 0xed, 0x98, 0x18, 0xb1, 0x76, 0x00, 0x9f, 0x98, 0x18, 0xd8, 
+	0x4a, 0xd8, 0x18, 0xb1, 0x76, 0x88, 0xc7, 0x88, 0x00, 0xb1, 0x76, 0xfc, 0x4a, 0xdc, 0xae, 0xb1, 
+	0x76, 0x9c, 0x18, 0xb1, 0x76, 0xfc, 0xc7, 0xb9, 0x76, 0x90, 0x59, 0xb9, 0x76, 0x08, 0xdf, 0x1b, 
+	0x76, 0xed, 0xdb, 0xb7, 0x6e, 0xdc, 0x3f, 0xb5, 0x76, 0x08, 0x5f, 0x0d, 0xad, 0xb6, 0xb6, 0xda, 
+	0xdb, 0x6a, 0x3f, 0xb8, 0x63, 0x00, 0x70, 0x88, 0x07, 0x01, 0x03, 0x3f, 0xb8, 0xc7, 0x00, 0x20, 
+	0x8e, 0x27, 0x00, 0x3f, 0xb9, 0x76, 0x05, 0x67, 0x01, 0xfe, 0x43, 0x9f, 0xe7, 0x80, 0x18, 0xb4, 
+	0x4a, 0x05, 0x47, 0x01, 0xc0, 0x43, 0x9c, 0x07, 0xc0, 0x18, 0x00, 0x67, 0x94, 0x18, 0xb5, 0x76, 
+	0x05, 0x27, 0x01, 0xf8, 0x43, 0x9f, 0x87, 0x80, 0x18, 0xb5, 0x76, 0x98, 0x31, 0xc0, 0x63, 0x01, 
+	0x36, 0x1c, 0x84, 0x18, 0xb4, 0xae, 0x07, 0x67, 0xf9, 0xfe, 0x0c, 0x1f, 0xe7, 0xf9, 0x3f, 0xb9, 
+	0x76, 0x00, 0x27, 0x94, 0x18, 0xb5, 0x76, 0x00, 0x60, 0x94, 0xe0, 0xb4, 0x63, 0x8e, 0xa3, 0x80, 
+	0x18, 0xb5, 0x76, 0x84, 0x31, 0x01, 0x0f, 0x80, 0x80, 0x18, 0xb5, 0x76, 0x85, 0x2b, 0x01, 0x11, 
+	0xe0, 0x84, 0xc7, 0xb1, 0x76, 0x84, 0x31, 0x88, 0x18, 0xc4, 0x63, 0x88, 0x18, 0xb4, 0xc7, 0x88, 
+	0x63, 0x84, 0x18, 0xb5, 0x76, 0x84, 0x63, 0x00, 0x01, 0xc4, 0x4a, 0x98, 0x95, 0xc4, 0x63, 0x88, 
+	0x18, 0xb5, 0x76, 0x98, 0xf9, 0xb5, 0x76, 0x00, 0x30, 0x88, 0x07, 0x00, 0x02, 0xbc, 0x4a, 0x00, 
+	0x17, 0x82, 0x84, 0x02, 0xfb, 0xbd, 0xec, 0xbc, 0xae, 0x9e, 0x89, 0xb1, 0x76, 0x98, 0x18, 0xfe, 
+	0xed, 0xfe, 0xed, 0xfe, 0xed, 0xfe, 0xed, 0xfe, 0xed, 0xce, 0xed, 0x00, 0x00, 0x82, 0xa2, 0x01, 
+	0xe3, 0xe1, 0xc2, 0x89, 0x02, 0x00, 0x30, 0x73, 0xce, 0xed, 0x94, 0x18, 0xba, 0xed, 0x04, 0x00, 
+	0x30, 0x7b, 0x9f, 0x83, 0x80, 0x4a, 0xba, 0xed, 0x05, 0x00, 0x30, 0x4f, 0x9c, 0x00, 0x79, 0xc8, 
+	0x63, 0x02, 0x47, 0x9c, 0x04, 0x80, 0x18, 0xba, 0xed, 0x00, 0xf8, 0x90, 0x95, 0xba, 0xed, 0x94, 
+	0x18, 0xfe, 0xed, 0xfe, 0xed, 0xe2, 0xed, 0x00, 0x1c, 0xd6, 0xed, 0x88, 0x18, 0xc4, 0x63, 0x88, 
+	0x18, 0xc6, 0xed, 0x88, 0x18, 0xc6, 0xed, 0xc8, 0x4a, 0xfe, 0xed, 0xfe, 0xed, 0xfe, 0xed, 0xfe, 
+	0xed, 0xfe, 0xed, 0xfe, 0xed, 0xca, 0xed, 0x98, 0x18, 0xb5, 0x76, 0x98, 0x18, 0xb5, 0x76, 0xfc, 
+	0x63, 0xb4, 0xc7, 0x98, 0x18, 0xb5, 0x76, 0xfc, 0x4a, 0xd8, 0x18, 0xb5, 0x76, 0x07, 0xff, 0xc9, 
+	0x24, 0x92, 0x49, 0x24, 0x92, 0x7f, 0xb9, 0x76, 0x00, 0xff, 0x8c, 0x8c, 0x00, 0x1f, 0xbc, 0x4a, 
+	0x85, 0x77, 0x02, 0xff, 0xfe, 0x0f, 0xbc, 0xae, 0x8c, 0x97, 0x00, 0x4f, 0xb9, 0x76, 0x01, 0xff, 
+	0x2f, 0x88, 0x31, 0x00, 0x1f, 0xbd, 0x76, 0x00, 0x38, 0x89, 0xf3, 0x00, 0xcf, 0xbc, 0x63, 0x8c, 
+	0x18, 0x00, 0x9f, 0xbd, 0x76, 0x00, 0xb8, 0x90, 0x31, 0xb9, 0x76, 0x00, 0x18, 0x88, 0x18, 0x00, 
+	0x4f, 0xbd, 0x76, 0xd8, 0x63, 0x8c, 0x4a, 0x00, 0x4f, 0xbc, 0xc7, 0x94, 0x31, 0xb9, 0x76, 0x8c, 
+	0x18, 0x00, 0x4f, 0xd4, 0xae, 0xc0, 0x63, 0x00, 0x98, 0x90, 0xc7, 0xb9, 0x76, 0x94, 0x31, 0xb9, 
+	0x76, 0x03, 0x3b, 0xff, 0xff, 0xc0, 0xc8, 0x63, 0x03, 0xba, 0x49, 0x92, 0x40, 0x84, 0x4a, 0xb8, 
+	0xae, 0x02, 0x3b, 0x25, 0xc9, 0x80, 0x18, 0x81, 0x12, 0xb5, 0x76, 0x02, 0x3a, 0x93, 0xa4, 0x88, 
+	0x4a, 0xb9, 0x76, 0x02, 0x3a, 0x75, 0x9d, 0x88, 0x31, 0xb8, 0x63, 0x02, 0x9b, 0x31, 0xac, 0x88, 
+	0x63, 0xb9, 0x76, 0x02, 0x3a, 0x4b, 0x85, 0x8c, 0x63, 0xb5, 0x76, 0x02, 0x3a, 0xa5, 0xd2, 0x88, 
+	0x63, 0xb9, 0x76, 0x02, 0xba, 0x13, 0x94, 0x88, 0x4a, 0xb8, 0x63, 0x8c, 0xe0, 0x00, 0xcf, 0xc5, 
+	0x76, 0x02, 0xff, 0xff, 0xf0, 0x80, 0x4a, 0xc1, 0x76, 0x02, 0x82, 0x64, 0x90, 0xcd, 0x5d, 0x02, 
+	0xd9, 0x72, 0x50, 0xc4, 0x63, 0x04, 0x38, 0x00, 0x84, 0xe9, 0x30, 0x80, 0x31, 0xc1, 0x76, 0x02, 
+	0xad, 0x67, 0x50, 0x84, 0xae, 0xb5, 0x76, 0x04, 0xb8, 0x00, 0xac, 0x6b, 0x10, 0xcc, 0x4a, 0x02, 
+	0x92, 0xe1, 0x50, 0xcc, 0xae, 0x02, 0xca, 0x74, 0xb0, 0x80, 0x4a, 0xb9, 0x76, 0x04, 0x38, 0x00, 
+	0xa1, 0x65, 0x10, 0x80, 0x31, 0xb9, 0x76, 0x00, 0x98, 0x88, 0xe0, 0xc8, 0x63, 0x8e, 0x0c, 0xb9, 
+	0x76, 0x96, 0x70, 0xb9, 0x76, 0x8e, 0xbb, 0x00, 0x9f, 0xfe, 0xed, 0xb0, 0x63, 0xfe, 0xed, 0x9d, 
+	0x76, 0x96, 0xbb, 0xfe, 0xed, 0xb4, 0x63, 0xb9, 0x76, 0x98, 0xae, 0xb5, 0x76, 0xd8, 0x4a, 0x01, 
+	0x17, 0xff, 0x84, 0x00, 0x00, 0x0f, 0xbc, 0xae, 0x06, 0x0d, 0xbb, 0x76, 0xed, 0xdb, 0xb6, 0x1f, 
+	0xbd, 0x76, 0x06, 0x86, 0xd6, 0xdb, 0x5b, 0x6d, 0x6c, 0x0f, 0xbd, 0x76, 0x8c, 0x28, 0x00, 0x3f, 
+	0xbc, 0x63, 0x06, 0xd5, 0x2a, 0x49, 0x54, 0x95, 0x2a, 0xbf, 0xbd, 0x76, 0x94, 0x00, 0xb9, 0x76, 
+	0x94, 0x00, 0xb9, 0x76, 0x94, 0x00, 0xb8, 0x63, 0xf8, 0x18, 0xb9, 0x2b, 0x98, 0x63, 0xb5, 0x2b, 
+	0xf8, 0x4a, 0xb9, 0x2b, 0x98, 0xc7, 0xb5, 0x2b, 0x94, 0x00, 0xb9, 0x2b, 0xf8, 0x63, 0xfd, 0x2b, 
+	0xb1, 0x2b
 };
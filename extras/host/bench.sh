@@ -0,0 +1,25 @@
+#!/bin/sh
+# Energy benchmark: runs every example face through 24 simulated hours of
+# minute ticks and ranks them by projected battery life. Extra arguments go
+# to make (e.g. GFX_DIR=...).
+#
+#   FACES="Basic 7_SEG" MINUTES=60 CPU_SCALE=10 ./bench.sh GFX_DIR=...
+
+set -e
+cd "$(dirname "$0")"
+
+FACES=${FACES:-"Basic 7_SEG DOS Pokemon Tetris MacPaint StarryHorizon Analog"}
+MINUTES=${MINUTES:-1440}
+# ESP32 time per unit of host CPU time, calibrate against a real watch
+CPU_SCALE=${CPU_SCALE:-10}
+
+make -s FACES="$FACES" "$@" >&2
+
+printf "%-14s %10s %10s %10s %8s\n" face "ms/wake" "uAh/wake" "mAh/day" days
+for face in $FACES; do
+  ./build/"$face" --quiet --minutes "$MINUTES" --cpu-scale "$CPU_SCALE" \
+    2>/dev/null | awk -v face="$face" '
+      /^per wake:/ { ms = $3; uah = $6 }
+      /^energy:/ { mahday = $4; days = $6 }
+      END { printf "%-14s %10.1f %10.2f %10.3f %8.1f\n", face, ms, uah, mahday, days }'
+done | sort -k5 -rn
@@ -0,0 +1,43 @@
+#!/bin/sh
+# Host checks of library behaviour the faces rely on, on top of the build.
+# Extra arguments go to make (e.g. GFX_DIR=...).
+#
+#   ./check.sh GFX_DIR=...
+
+set -e
+cd "$(dirname "$0")"
+
+make -s "$@" >&2
+
+fail=0
+check() {
+  if [ "$2" = "$3" ]; then
+    echo "ok   $1"
+  else
+    echo "FAIL $1: $2, expected $3"
+    fail=1
+  fi
+}
+
+# getWeatherData() with the face's own arguments: fetched on the first draw
+# and every 5 minutes after, never with the settings'
+url="http://face.invalid/weather?id=2643743&units=imperial&lang=de&appid=face-key"
+gets=$(./build/WeatherArgs --wifi --quiet --minutes 11 2>/dev/null | grep ' GET ')
+check "weather requests" "$(echo "$gets" | wc -l)" 3
+check "weather minutes" "$(echo "$gets" | cut -c1-5 | tr '\n' ' ')" \
+  "12:00 12:05 12:10 "
+check "weather urls" "$(echo "$gets" | cut -d' ' -f3 | sort -u)" "$url"
+
+# the weather job does not wake the watch, a 10 minute tick fetches on ticks
+out=$(./build/WeatherArgs --wifi --quiet --tick 10 --minutes 21 2>/dev/null)
+check "weather on ticks" \
+  "$(echo "$out" | grep ' GET ' | cut -c1-5 | tr '\n' ' ')" "12:00 12:10 12:20 "
+check "weather boots" "$(echo "$out" | grep '^boots' | cut -d' ' -f2)" 3
+
+# with prewake the jobs due on a tick run before it is drawn ahead: the
+# fetch is for the minutes 5 and 10, seconds before they start
+out=$(./build/WeatherArgs --wifi --quiet --prewake 3000 --minutes 11 2>/dev/null)
+check "weather ahead" \
+  "$(echo "$out" | grep ' GET ' | cut -c1-5 | tr '\n' ' ')" "12:00 12:04 12:09 "
+
+exit $fail
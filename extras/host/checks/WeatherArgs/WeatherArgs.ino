@@ -0,0 +1,38 @@
+// Host check: a face that passes its own arguments to getWeatherData(),
+// none of them the settings'. Every request of the run, the first and the
+// ones of JOB_WEATHER, is to be for its city, units, language, URL and key,
+// at its interval. See check.sh.
+
+#include <Watchy.h>
+
+watchySettings settings{"5128581",
+                        "settings-key",
+                        "http://settings.invalid/weather?id=",
+                        "metric",
+                        "en",
+                        30,
+                        "pool.ntp.org",
+                        3600 * -5,
+                        3600};
+
+class WatchyWeatherArgs : public Watchy {
+  using Watchy::Watchy;
+
+public:
+  void drawWatchFace() {
+    display.fillScreen(GxEPD_WHITE);
+    display.setTextColor(GxEPD_BLACK);
+    display.setCursor(5, 100);
+    display.printf("%02d:%02d", currentTime.Hour, currentTime.Minute);
+    weatherData weather =
+        getWeatherData("2643743", "imperial", "de",
+                       "http://face.invalid/weather?id=", "face-key", 5);
+    display.printf(" %d", weather.temperature);
+  }
+};
+
+WatchyWeatherArgs watchy(settings);
+
+void setup() { watchy.init(); }
+
+void loop() {}
@@ -0,0 +1 @@
+// Adafruit BusIO is not needed by the GFX core on the host
@@ -0,0 +1,132 @@
+#ifndef WATCHY_HOST_ARDUINO_H
+#define WATCHY_HOST_ARDUINO_H
+
+// Arduino-ESP32 core surface used by the Watchy library, backed by the
+// virtual clock, GPIO script and sleep model in extras/host/src.
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "Print.h"
+#include "WString.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define RTC_SLOW_ATTR
+#define IRAM_ATTR
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr)   (*(void *const *)(addr))
+#define memcpy_P             memcpy
+
+#define LOW          0x0
+#define HIGH         0x1
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define MSBFIRST     1
+#define LSBFIRST     0
+
+using std::max;
+using std::min;
+
+static const uint8_t SDA = 21;
+static const uint8_t SCL = 22;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+uint32_t analogReadMilliVolts(uint8_t pin);
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+  void flush();
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
+  operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+// ESP-IDF GPIO and sleep API
+typedef int gpio_num_t;
+typedef int esp_err_t;
+#define ESP_OK 0
+
+#define GPIO_SEL(n) ((uint64_t)1 << (n))
+#define GPIO_SEL_4  GPIO_SEL(4)
+#define GPIO_SEL_12 GPIO_SEL(12)
+#define GPIO_SEL_14 GPIO_SEL(14)
+#define GPIO_SEL_19 GPIO_SEL(19)
+#define GPIO_SEL_25 GPIO_SEL(25)
+#define GPIO_SEL_26 GPIO_SEL(26)
+#define GPIO_SEL_27 GPIO_SEL(27)
+#define GPIO_SEL_32 GPIO_SEL(32)
+#define GPIO_SEL_33 GPIO_SEL(33)
+#define GPIO_SEL_34 GPIO_SEL(34)
+#define GPIO_SEL_35 GPIO_SEL(35)
+
+typedef enum {
+  GPIO_INTR_DISABLE    = 0,
+  GPIO_INTR_POSEDGE    = 1,
+  GPIO_INTR_NEGEDGE    = 2,
+  GPIO_INTR_ANYEDGE    = 3,
+  GPIO_INTR_LOW_LEVEL  = 4,
+  GPIO_INTR_HIGH_LEVEL = 5,
+} gpio_int_type_t;
+
+typedef enum {
+  ESP_SLEEP_WAKEUP_UNDEFINED,
+  ESP_SLEEP_WAKEUP_ALL,
+  ESP_SLEEP_WAKEUP_EXT0,
+  ESP_SLEEP_WAKEUP_EXT1,
+  ESP_SLEEP_WAKEUP_TIMER,
+  ESP_SLEEP_WAKEUP_TOUCHPAD,
+  ESP_SLEEP_WAKEUP_ULP,
+  ESP_SLEEP_WAKEUP_GPIO,
+} esp_sleep_wakeup_cause_t;
+
+typedef enum {
+  ESP_EXT1_WAKEUP_ALL_LOW  = 0,
+  ESP_EXT1_WAKEUP_ANY_HIGH = 1,
+} esp_sleep_ext1_wakeup_mode_t;
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+uint64_t esp_sleep_get_ext1_wakeup_status();
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level);
+esp_err_t esp_sleep_enable_ext1_wakeup(uint64_t mask,
+                                       esp_sleep_ext1_wakeup_mode_t mode);
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_wakeup_cause_t source);
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t intr_type);
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio_num);
+esp_err_t gpio_hold_en(gpio_num_t gpio_num);
+esp_err_t gpio_hold_dis(gpio_num_t gpio_num);
+void gpio_deep_sleep_hold_en();
+esp_err_t esp_light_sleep_start();
+void esp_deep_sleep_start() __attribute__((noreturn));
+void esp_restart() __attribute__((noreturn));
+bool btStop();
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef WATCHY_HOST_ARDUINO_JSON_H
+#define WATCHY_HOST_ARDUINO_JSON_H
+
+#include <Arduino.h>
+
+// Only reached on a successful HTTP response, which the host never has.
+class JSONVar {
+public:
+  JSONVar operator[](const char *key) const {
+    (void)key;
+    return JSONVar();
+  }
+  JSONVar operator[](int index) const {
+    (void)index;
+    return JSONVar();
+  }
+  explicit operator int() const { return 0; }
+  explicit operator double() const { return 0; }
+  operator const char *() const { return ""; }
+};
+
+class JSONClass {
+public:
+  JSONVar parse(const String &s) {
+    (void)s;
+    return JSONVar();
+  }
+};
+extern JSONClass JSON;
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef WATCHY_HOST_BLEDEVICE_H
+#define WATCHY_HOST_BLEDEVICE_H
+
+// Types referenced by BLE.h. The host BLE class (extras/host/src/stubs.cpp)
+// never advertises, so nothing here is implemented.
+class BLEServer;
+class BLEService;
+class BLECharacteristic;
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef WATCHY_HOST_DS3232RTC_H
+#define WATCHY_HOST_DS3232RTC_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "HostRTC.h"
+
+// DS3232RTC facade over the scripted RTC chip.
+class DS3232RTC {
+public:
+  enum ALARM_TYPES_t {
+    ALM1_EVERY_SECOND  = 0x0F,
+    ALM1_MATCH_SECONDS = 0x0E,
+    ALM1_MATCH_MINUTES = 0x0C,
+    ALM1_MATCH_HOURS   = 0x08,
+    ALM1_MATCH_DATE    = 0x00,
+    ALM1_MATCH_DAY     = 0x10,
+    ALM2_EVERY_MINUTE  = 0x8E,
+    ALM2_MATCH_MINUTES = 0x8C,
+    ALM2_MATCH_HOURS   = 0x88,
+    ALM2_MATCH_DATE    = 0x80,
+    ALM2_MATCH_DAY     = 0x90,
+  };
+  enum SQWAVE_FREQS_t {
+    SQWAVE_1_HZ,
+    SQWAVE_1024_HZ,
+    SQWAVE_4096_HZ,
+    SQWAVE_8192_HZ,
+    SQWAVE_NONE
+  };
+  enum ALARM_NBR_t { ALARM_1 = 1, ALARM_2 = 2 };
+
+  DS3232RTC(bool initI2C = true) { (void)initI2C; }
+  time_t get() { return HostRTC.now(); }
+  uint8_t set(time_t t);
+  uint8_t read(tmElements_t &tm);
+  uint8_t write(tmElements_t &tm) { return set(makeTime(tm)); }
+  void setAlarm(ALARM_TYPES_t alarmType, uint8_t seconds, uint8_t minutes,
+                uint8_t hours, uint8_t daydate);
+  void setAlarm(ALARM_TYPES_t alarmType, uint8_t minutes, uint8_t hours,
+                uint8_t daydate) {
+    setAlarm(alarmType, 0, minutes, hours, daydate);
+  }
+  void alarmInterrupt(uint8_t alarmNumber, bool alarmEnabled);
+  bool alarm(uint8_t alarmNumber);
+  bool checkAlarm(uint8_t alarmNumber);
+  bool clearAlarm(uint8_t alarmNumber) { return alarm(alarmNumber); }
+  void squareWave(SQWAVE_FREQS_t freq) { (void)freq; }
+  int16_t temperature() { return 25 * 4; } // quarter degrees C
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef WATCHY_HOST_GXEPD2_154_D67_H
+#define WATCHY_HOST_GXEPD2_154_D67_H
+
+#include "GxEPD2_EPD.h"
+
+// Host port of the GxEPD2 GDEH0154D67 driver: same API and the same SSD1681
+// command sequences, sent to the emulated controller.
+class GxEPD2_154_D67 : public GxEPD2_EPD {
+public:
+  static const uint16_t WIDTH                = 200;
+  static const uint16_t WIDTH_VISIBLE        = WIDTH;
+  static const uint16_t HEIGHT               = 200;
+  static const bool hasColor                 = false;
+  static const bool hasPartialUpdate         = true;
+  static const bool hasFastPartialUpdate     = true;
+  static const uint16_t power_on_time        = 100;
+  static const uint16_t power_off_time       = 150;
+  static const uint16_t full_refresh_time    = 2600;
+  static const uint16_t partial_refresh_time = 500;
+
+  GxEPD2_154_D67(int16_t cs, int16_t dc, int16_t rst, int16_t busy);
+  void clearScreen(uint8_t value = 0xFF);
+  void writeScreenBuffer(uint8_t value = 0xFF);
+  void writeScreenBufferAgain(uint8_t value = 0xFF);
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w,
+                  int16_t h, bool invert = false, bool mirror_y = false,
+                  bool pgm = false);
+  void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y,
+                                int16_t w, int16_t h, bool invert = false,
+                                bool mirror_y = false, bool pgm = false);
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                      int16_t w_bitmap, int16_t h_bitmap, int16_t x, int16_t y,
+                      int16_t w, int16_t h, bool invert = false,
+                      bool mirror_y = false, bool pgm = false);
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w,
+                       int16_t h, bool invert = false, bool mirror_y = false,
+                       bool pgm = false);
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part,
+                           int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                           int16_t x, int16_t y, int16_t w, int16_t h,
+                           bool invert = false, bool mirror_y = false,
+                           bool pgm = false);
+  void drawImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w,
+                 int16_t h, bool invert = false, bool mirror_y = false,
+                 bool pgm = false);
+  void refresh(bool partial_update_mode = false);
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h);
+  void powerOff();
+  void hibernate();
+
+private:
+  void _writeScreenBuffer(uint8_t command, uint8_t value);
+  void _writeImage(uint8_t command, const uint8_t bitmap[], int16_t x,
+                   int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y,
+                   bool pgm);
+  void _writeImagePart(uint8_t command, const uint8_t bitmap[], int16_t x_part,
+                       int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                       int16_t x, int16_t y, int16_t w, int16_t h, bool invert,
+                       bool mirror_y, bool pgm);
+  void _setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void _PowerOn();
+  void _PowerOff();
+  void _InitDisplay();
+  void _Init_Full();
+  void _Init_Part();
+  void _Update_Full();
+  void _Update_Part();
+};
+
+#endif
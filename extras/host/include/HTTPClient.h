@@ -0,0 +1,17 @@
+#ifndef WATCHY_HOST_HTTPCLIENT_H
+#define WATCHY_HOST_HTTPCLIENT_H
+
+#include <WiFi.h>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient {
+public:
+  void setConnectTimeout(int32_t connectTimeout) { (void)connectTimeout; }
+  bool begin(const char *url); // printed with --wifi
+  int GET() { return HTTPC_ERROR_CONNECTION_REFUSED; }
+  String getString() { return String(""); }
+  void end() {}
+};
+
+#endif
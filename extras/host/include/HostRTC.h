@@ -0,0 +1,41 @@
+#ifndef WATCHY_HOST_RTC_H
+#define WATCHY_HOST_RTC_H
+
+#include "TimeLib.h"
+
+// Scripted RTC chip. Time runs off the virtual clock from the epoch set by
+// the runner (or by the firmware through set()). One minute-resolution
+// alarm is modelled: it fires at second :00 of the first minute after it
+// was armed whose enabled fields match, sets the flag, and pulls the INT pin
+// low while the flag and the interrupt enable are set.
+class HostRTCChip {
+public:
+  static const uint8_t ANY = 0xFF; // alarm field disabled
+
+  HostRTCChip();
+  time_t now() const;
+  void set(time_t t);
+  void setAlarm(uint8_t minute, uint8_t hour, uint8_t day, uint8_t weekday);
+  void disableAlarm();
+  void setInterrupt(bool enabled) { _interrupt = enabled; }
+  bool interruptEnabled() const { return _interrupt; }
+  bool alarmFlag() const;
+  void clearFlag();
+  bool intAsserted() const { return _interrupt && alarmFlag(); }
+  // next time (virtual µs) the INT pin goes low, UINT64_MAX if never
+  uint64_t nextInterrupt() const;
+
+  uint8_t type; // DS3231 or PCF8563 as defined in WatchyRTC.h
+
+private:
+  time_t _nextMatch(time_t after) const;
+
+  int64_t _offset; // epoch seconds at virtual time 0
+  bool _enabled;
+  bool _interrupt;
+  uint8_t _minute, _hour, _day, _weekday;
+  time_t _armedAt; // flag is set by the first match after this second
+};
+extern HostRTCChip HostRTC;
+
+#endif
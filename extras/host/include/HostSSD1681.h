@@ -0,0 +1,75 @@
+#ifndef WATCHY_HOST_SSD1681_H
+#define WATCHY_HOST_SSD1681_H
+
+#include "Arduino.h"
+
+// Command level model of the SSD1681 controller on the GDEH0154D67 panel.
+// It lives outside the driver object, like the real chip it keeps its RAM
+// and the image on the glass across ESP32 resets.
+class HostSSD1681 {
+public:
+  static const uint16_t WIDTH       = 200;
+  static const uint16_t HEIGHT      = 200;
+  static const uint16_t WIDTH_BYTES = WIDTH / 8;
+  static const uint16_t RAM_SIZE    = WIDTH_BYTES * HEIGHT;
+
+  // nominal timings of the stock waveforms, as measured by GxEPD2
+  static const uint32_t POWER_ON_US       = 95583;
+  static const uint32_t POWER_OFF_US      = 140621;
+  static const uint32_t FULL_REFRESH_US   = 2509602;
+  static const uint32_t PARTIAL_REFRESH_US = 457282;
+
+  uint8_t ram[2][RAM_SIZE]; // 0x24 black/white RAM, 0x26 "red"/previous RAM
+  uint8_t screen[RAM_SIZE]; // what the glass currently shows
+  uint8_t lut[153];
+  bool lutLoaded;   // custom waveform written with 0x32
+  uint8_t busyPin;
+
+  // statistics
+  uint32_t fullRefreshes;
+  uint32_t partialRefreshes;
+  uint32_t resets;
+  uint64_t bytesWritten; // command and data bytes seen on SPI
+  uint32_t ghostPixels;  // flipped by differential refreshes since a full one
+  uint32_t maxGhostPixels;
+  uint64_t spiNs;             // SPI time charged, bits and driver overhead
+  uint64_t refreshStartUs;    // first refresh since this was cleared
+  uint64_t refreshStartSpiNs; // spiNs at that refresh
+
+public:
+  HostSSD1681();
+  void powerOnReset();
+  void hardwareReset();
+  void command(uint8_t c);
+  void data(uint8_t d);
+  bool busy() const;
+  uint64_t busyUntil() const { return _busyUntil; }
+  bool sleeping() const { return _deepSleep; }
+  bool analogOn() const { return _analogOn; }
+  // controller option bytes of 0x21, the BW RAM option is in the low
+  // nibble, the previous RAM's in the high one
+  uint8_t updateOption() const { return _updateCtl1[0]; }
+
+private:
+  void _activate();
+  void _writeRam(uint8_t value);
+  void _display(bool differential);
+  uint32_t _lutUs() const;
+
+  uint8_t _command;
+  uint8_t _args[160];
+  uint16_t _argc;
+  bool _deepSleep;
+  bool _analogOn;
+  uint64_t _busyUntil;
+  uint8_t _entryMode;
+  uint8_t _xStart, _xEnd;
+  uint16_t _yStart, _yEnd;
+  uint8_t _xCount;
+  uint16_t _yCount;
+  uint8_t _updateCtl1[2];
+  uint8_t _updateCtl2;
+};
+extern HostSSD1681 HostPanel;
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef WATCHY_HOST_NTPCLIENT_H
+#define WATCHY_HOST_NTPCLIENT_H
+
+#include <WiFiUdp.h>
+
+class NTPClient {
+public:
+  NTPClient(WiFiUDP &udp, const char *poolServerName, long timeOffset = 0)
+      : _timeOffset(timeOffset) {
+    (void)udp;
+    (void)poolServerName;
+  }
+  void begin() {}
+  bool forceUpdate() { return false; }
+  unsigned long getEpochTime() const { return _timeOffset; }
+
+private:
+  long _timeOffset;
+};
+
+#endif
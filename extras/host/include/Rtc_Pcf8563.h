@@ -0,0 +1,43 @@
+#ifndef WATCHY_HOST_RTC_PCF8563_H
+#define WATCHY_HOST_RTC_PCF8563_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "HostRTC.h"
+
+#define RTCC_NO_ALARM 99
+
+// Rtc_Pcf8563 facade over the scripted RTC chip.
+class Rtc_Pcf8563 {
+public:
+  Rtc_Pcf8563() {}
+  void initClock() {}
+  void getDateTime();
+  void setDateTime(uint8_t day, uint8_t weekday, uint8_t month, bool century,
+                   uint8_t year, uint8_t hour, uint8_t minute, uint8_t sec);
+  void setDate(uint8_t day, uint8_t weekday, uint8_t month, bool century,
+               uint8_t year);
+  void setTime(uint8_t hour, uint8_t minute, uint8_t sec);
+  void getDate() { getDateTime(); }
+  void getTime() { getDateTime(); }
+  void setAlarm(uint8_t min, uint8_t hour, uint8_t day, uint8_t weekday);
+  void enableAlarm();
+  void clearAlarm();
+  void resetAlarm();
+  bool alarmEnabled() { return HostRTC.interruptEnabled(); }
+  bool alarmActive() { return HostRTC.alarmFlag(); }
+
+  uint8_t getSecond() { return _tm.Second; }
+  uint8_t getMinute() { return _tm.Minute; }
+  uint8_t getHour() { return _tm.Hour; }
+  uint8_t getDay() { return _tm.Day; }
+  uint8_t getMonth() { return _tm.Month; }
+  uint8_t getYear() { return tmYearToY2k(_tm.Year); }
+  uint8_t getWeekday() { return _tm.Wday - 1; }
+
+private:
+  tmElements_t _tm = {};
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef WATCHY_HOST_SPI_H
+#define WATCHY_HOST_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPISettings {
+public:
+  SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST,
+              uint8_t dataMode = SPI_MODE0)
+      : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+  uint32_t _clock;
+  uint8_t _bitOrder;
+  uint8_t _dataMode;
+};
+
+class SPIClass {
+public:
+  void begin() {}
+  void end() {}
+  void beginTransaction(SPISettings settings) { _settings = settings; }
+  void endTransaction() {}
+  uint8_t transfer(uint8_t data);
+  // On the host the panel is the only SPI device, bytes go to HostPanel
+  void writeBytes(const uint8_t *data, uint32_t size);
+  uint32_t clock() const { return _settings._clock; }
+
+private:
+  SPISettings _settings;
+};
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef WATCHY_HOST_TIMELIB_H
+#define WATCHY_HOST_TIMELIB_H
+
+#include <stdint.h>
+#include <time.h>
+
+// the subset of Paul Stoffregen's TimeLib used by the library and faces
+
+typedef struct {
+  uint8_t Second;
+  uint8_t Minute;
+  uint8_t Hour;
+  uint8_t Wday; // day of week, sunday is day 1
+  uint8_t Day;
+  uint8_t Month;
+  uint8_t Year; // offset from 1970
+} tmElements_t;
+
+#define tmYearToCalendar(Y) ((Y) + 1970)
+#define CalendarYrToTm(Y)   ((Y)-1970)
+#define tmYearToY2k(Y)      ((Y)-30)
+#define y2kYearToTm(Y)      ((Y) + 30)
+
+#define SECS_PER_MIN  ((time_t)(60UL))
+#define SECS_PER_HOUR ((time_t)(3600UL))
+#define SECS_PER_DAY  ((time_t)(SECS_PER_HOUR * 24UL))
+
+time_t makeTime(const tmElements_t &tm);
+void breakTime(time_t time, tmElements_t &tm);
+char *monthStr(uint8_t month);
+char *dayStr(uint8_t day);
+char *monthShortStr(uint8_t month);
+char *dayShortStr(uint8_t day);
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef WATCHY_HOST_WSTRING_H
+#define WATCHY_HOST_WSTRING_H
+
+#include <stdint.h>
+#include <string>
+
+class __FlashStringHelper;
+#define F(string_literal)                                                      \
+  (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+// Arduino String on top of std::string, enough of the API for the library
+// and the example faces.
+class String {
+public:
+  String(const char *cstr = "") : _s(cstr ? cstr : "") {}
+  String(const std::string &s) : _s(s) {}
+  String(const __FlashStringHelper *str)
+      : _s(reinterpret_cast<const char *>(str)) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(unsigned char value, unsigned char base = 10);
+  String(int value, unsigned char base = 10);
+  String(unsigned int value, unsigned char base = 10);
+  String(long value, unsigned char base = 10);
+  String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned char decimalPlaces = 2);
+  explicit String(double value, unsigned char decimalPlaces = 2);
+
+  String &operator=(const char *cstr) {
+    _s = cstr ? cstr : "";
+    return *this;
+  }
+
+  unsigned int length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  const char *c_str() const { return _s.c_str(); }
+  char charAt(unsigned int index) const {
+    return index < _s.length() ? _s[index] : 0;
+  }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index) { return _s[index]; }
+
+  String &operator+=(const String &rhs) {
+    _s += rhs._s;
+    return *this;
+  }
+  String &operator+=(const char *rhs) {
+    _s += rhs;
+    return *this;
+  }
+  String &operator+=(char c) {
+    _s += c;
+    return *this;
+  }
+  bool concat(const String &rhs) {
+    _s += rhs._s;
+    return true;
+  }
+
+  bool operator==(const String &rhs) const { return _s == rhs._s; }
+  bool operator==(const char *rhs) const { return _s == rhs; }
+  bool operator!=(const String &rhs) const { return _s != rhs._s; }
+  bool operator!=(const char *rhs) const { return _s != rhs; }
+  bool operator<(const String &rhs) const { return _s < rhs._s; }
+  bool equals(const String &rhs) const { return _s == rhs._s; }
+
+  int indexOf(char ch, unsigned int fromIndex = 0) const;
+  int indexOf(const String &str, unsigned int fromIndex = 0) const;
+  bool startsWith(const String &prefix) const;
+  bool endsWith(const String &suffix) const;
+  String substring(unsigned int beginIndex) const;
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+  void toUpperCase();
+  void toLowerCase();
+  void trim();
+  long toInt() const;
+  float toFloat() const;
+
+private:
+  std::string _s;
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, char rhs);
+
+#endif
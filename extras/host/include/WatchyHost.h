@@ -0,0 +1,79 @@
+#ifndef WATCHY_HOST_H
+#define WATCHY_HOST_H
+
+#include "Arduino.h"
+
+// Control surface of the Linux backend: a virtual clock, the GPIO/button
+// script and the ESP32 sleep model. The firmware only sees it through the
+// Arduino and ESP-IDF calls declared in Arduino.h.
+
+enum HostPowerState {
+  HOST_ACTIVE,
+  HOST_LIGHT_SLEEP,
+  HOST_DEEP_SLEEP,
+  HOST_POWER_STATES
+};
+
+// thrown by esp_deep_sleep_start() and esp_restart() to unwind to the runner
+struct HostDeepSleep {};
+struct HostRestart {};
+// thrown when virtual time passes WatchyHost::endUs, so firmware that polls
+// buttons forever (setTime, showBuzz, ...) still ends the run
+struct HostTimeout {};
+
+struct HostButtonPress {
+  uint64_t atUs;
+  uint8_t pin;
+  uint32_t durationUs;
+  bool consumed; // delivered as a deep sleep wake, no longer readable
+};
+
+class WatchyHost {
+public:
+  // Virtual time in µs since power on. Modelled waits (delay, I2C/SPI
+  // transfers, panel BUSY, sleep) advance it directly, CPU work is charged
+  // as host wall time multiplied by cpuScale.
+  static uint64_t now();
+  static void spend(uint64_t us, HostPowerState state = HOST_ACTIVE);
+  static void advanceTo(uint64_t us, HostPowerState state);
+  static void holdCpuClock();   // stop charging host wall time
+  static void resumeCpuClock(); // and start again from here
+  static double cpuScale;
+  static uint64_t timeIn[HOST_POWER_STATES];
+  static uint64_t endUs;
+  static uint64_t bootUs; // millis()/micros() count from here, as on the chip
+
+  // GPIO inputs
+  static void pressButton(uint64_t atUs, uint8_t pin,
+                          uint32_t durationMs = 100);
+  static int pinLevel(uint8_t pin);
+  static uint32_t batteryMv;
+  // an access point takes the stored credentials, no server answers
+  static bool wifi;
+
+  // wake state reported to the firmware on the current boot
+  static esp_sleep_wakeup_cause_t wakeCause;
+  static uint64_t ext1Status;
+
+  // wake sources armed by the firmware
+  static bool ext0Enabled;
+  static int ext0Pin;
+  static int ext0Level;
+  static uint64_t ext1Mask;
+  static uint64_t timerWakeUs;
+  static bool gpioWakeEnabled;
+  static gpio_int_type_t gpioWake[40];
+
+  // Earliest time an armed source fires at or after `from`, or UINT64_MAX.
+  // For EXT1 the matching button mask is returned in ext1.
+  static uint64_t nextWake(uint64_t from, bool lightSleep,
+                           esp_sleep_wakeup_cause_t &cause, uint64_t &ext1);
+  static void clearWakeSources();
+  static void consumeButtons(uint64_t upTo);
+
+private:
+  static HostButtonPress _buttons[64];
+  static int _buttonCount;
+};
+
+#endif
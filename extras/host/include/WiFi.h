@@ -0,0 +1,38 @@
+#ifndef WATCHY_HOST_WIFI_H
+#define WATCHY_HOST_WIFI_H
+
+#include <Arduino.h>
+
+// No radio on the host: connection attempts fail after the modelled
+// timeout, so the library takes its offline paths. With WatchyHost::wifi
+// they connect, and requests fail for want of a server.
+
+typedef enum {
+  WL_IDLE_STATUS     = 0,
+  WL_NO_SSID_AVAIL   = 1,
+  WL_SCAN_COMPLETED  = 2,
+  WL_CONNECTED       = 3,
+  WL_CONNECT_FAILED  = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED    = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+  wl_status_t begin();
+  wl_status_t begin(const char *ssid, const char *passphrase = NULL);
+  uint8_t waitForConnectResult(unsigned long timeoutLength = 60000);
+  bool mode(wifi_mode_t m);
+  wifi_mode_t getMode() { return _mode; }
+  wl_status_t status() { return WL_DISCONNECTED; }
+  String SSID() { return String(""); }
+  String softAPIP() { return String("192.168.4.1"); }
+
+private:
+  wifi_mode_t _mode = WIFI_OFF;
+};
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef WATCHY_HOST_WIFIMANAGER_H
+#define WATCHY_HOST_WIFIMANAGER_H
+
+#include <WiFi.h>
+
+class WiFiManager {
+public:
+  void resetSettings() {}
+  void setTimeout(unsigned long seconds) { _timeout = seconds; }
+  void setAPCallback(void (*func)(WiFiManager *)) { _apCallback = func; }
+  bool autoConnect(const char *apName, const char *apPassword = NULL);
+
+private:
+  unsigned long _timeout          = 0;
+  void (*_apCallback)(WiFiManager *) = NULL;
+};
+
+#endif
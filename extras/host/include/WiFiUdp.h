@@ -0,0 +1,8 @@
+#ifndef WATCHY_HOST_WIFIUDP_H
+#define WATCHY_HOST_WIFIUDP_H
+
+#include <WiFi.h>
+
+class WiFiUDP {};
+
+#endif
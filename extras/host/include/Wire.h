@@ -0,0 +1,64 @@
+#ifndef WATCHY_HOST_WIRE_H
+#define WATCHY_HOST_WIRE_H
+
+#include "Arduino.h"
+
+// Device on the fake I2C bus. The first byte of a write sets the register
+// pointer, following bytes are written with auto-increment, reads continue
+// from the pointer.
+class HostI2CDevice {
+public:
+  virtual ~HostI2CDevice() {}
+  virtual uint8_t readRegister(uint8_t reg) = 0;
+  virtual void writeRegister(uint8_t reg, uint8_t value) = 0;
+};
+
+// Plain 256 byte register file, used for the BMA423 and as the presence
+// stub for the RTC chip (the RTC itself is modelled in DS3232RTC.h /
+// Rtc_Pcf8563.h).
+class HostRegisterFile : public HostI2CDevice {
+public:
+  HostRegisterFile() { memset(regs, 0, sizeof(regs)); }
+  uint8_t readRegister(uint8_t reg) { return regs[reg]; }
+  void writeRegister(uint8_t reg, uint8_t value) { regs[reg] = value; }
+  uint8_t regs[256];
+};
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+  void setClock(uint32_t frequency) { _frequency = frequency; }
+  void beginTransmission(uint8_t address);
+  void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+  uint8_t endTransmission(bool sendStop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true);
+  uint8_t requestFrom(int address, int quantity) {
+    return requestFrom((uint8_t)address, (uint8_t)quantity);
+  }
+  size_t write(uint8_t data);
+  size_t write(const uint8_t *data, size_t quantity);
+  int available() { return _rxLength - _rxIndex; }
+  int read() { return _rxIndex < _rxLength ? _rx[_rxIndex++] : -1; }
+
+  // host side: attach or remove a device at a 7 bit address
+  void attach(uint8_t address, HostI2CDevice *device);
+  HostI2CDevice *device(uint8_t address) { return _devices[address & 0x7F]; }
+  uint32_t transactions() const { return _transactions; }
+
+private:
+  void _busTime(size_t bytes);
+
+  HostI2CDevice *_devices[128] = {};
+  uint8_t _pointer[128]        = {};
+  uint8_t _txAddress           = 0;
+  uint8_t _tx[256];
+  size_t _txLength   = 0;
+  uint8_t _rx[256];
+  size_t _rxLength   = 0;
+  size_t _rxIndex    = 0;
+  uint32_t _frequency = 100000;
+  uint32_t _transactions = 0;
+};
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef WATCHY_HOST_ESP_OTA_OPS_H
+#define WATCHY_HOST_ESP_OTA_OPS_H
+
+#include <Arduino.h>
+
+typedef uint32_t esp_ota_handle_t;
+
+#endif
@@ -0,0 +1,172 @@
+#include "GxEPD2_EPD.h"
+
+#include "HostSSD1681.h"
+#include "WatchyHost.h"
+
+// ESP32 SPI master cost per byte on top of the bit time: the Arduino
+// transfer() call, and the CS/DC toggling of single command/data writes.
+// writeBytes() pays per 64 byte FIFO load instead.
+#define HOST_SPI_BYTE_OVERHEAD_NS 600
+#define HOST_SPI_SINGLE_WRITE_NS  2000
+#define HOST_SPI_FIFO_BYTES       64
+#define HOST_SPI_FIFO_OVERHEAD_NS 1500
+
+SPIClass SPI;
+
+static void _spend(uint64_t ns) {
+  static uint64_t pendingNs = 0;
+  HostPanel.spiNs += ns;
+  pendingNs += ns;
+  if (pendingNs >= 1000) {
+    WatchyHost::spend(pendingNs / 1000);
+    pendingNs %= 1000;
+  }
+}
+
+uint8_t SPIClass::transfer(uint8_t data) { return data; }
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++) {
+    HostPanel.data(data[i]);
+  }
+  uint32_t loads = (size + HOST_SPI_FIFO_BYTES - 1) / HOST_SPI_FIFO_BYTES;
+  _spend(size * (8000000000ULL / _settings._clock) +
+         loads * HOST_SPI_FIFO_OVERHEAD_NS);
+}
+
+GxEPD2_EPD::GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy,
+                       int16_t busy_level, uint32_t busy_timeout, uint16_t w,
+                       uint16_t h, bool c, bool pu, bool fpu)
+    : WIDTH(w), HEIGHT(h), hasColor(c), hasPartialUpdate(pu),
+      hasFastPartialUpdate(fpu), _cs(cs), _dc(dc), _rst(rst), _busy(busy),
+      _busy_level(busy_level), _busy_timeout(busy_timeout),
+      _diag_enabled(false), _pulldown_rst_mode(false), _pSPIx(&SPI),
+      _spi_settings(4000000, MSBFIRST, SPI_MODE0) {
+  _initial_write           = true;
+  _initial_refresh         = true;
+  _power_is_on             = false;
+  _using_partial_mode      = false;
+  _hibernating             = false;
+  _reset_duration          = 10;
+  _busy_callback           = 0;
+  _busy_callback_parameter = 0;
+}
+
+void GxEPD2_EPD::init(uint32_t serial_diag_bitrate) {
+  init(serial_diag_bitrate, true, 10, false);
+}
+
+void GxEPD2_EPD::init(uint32_t serial_diag_bitrate, bool initial,
+                      uint16_t reset_duration, bool pulldown_rst_mode) {
+  _diag_enabled       = serial_diag_bitrate > 0;
+  _initial_write      = initial;
+  _initial_refresh    = initial;
+  _pulldown_rst_mode  = pulldown_rst_mode;
+  _power_is_on        = false;
+  _using_partial_mode = false;
+  _hibernating        = false;
+  _reset_duration     = reset_duration;
+  HostPanel.busyPin   = _busy;
+  _reset();
+}
+
+void GxEPD2_EPD::setBusyCallback(void (*busyCallback)(const void *),
+                                 const void *busy_callback_parameter) {
+  _busy_callback           = busyCallback;
+  _busy_callback_parameter = busy_callback_parameter;
+}
+
+void GxEPD2_EPD::selectSPI(SPIClass &spi, SPISettings spi_settings) {
+  _pSPIx        = &spi;
+  _spi_settings = spi_settings;
+}
+
+void GxEPD2_EPD::_reset() {
+  if (_rst >= 0) {
+    if (_pulldown_rst_mode) {
+      delay(_reset_duration);
+      HostPanel.hardwareReset();
+      delay(_reset_duration > 10 ? _reset_duration : 10);
+    } else {
+      delay(10);
+      delay(_reset_duration);
+      HostPanel.hardwareReset();
+      delay(_reset_duration > 10 ? _reset_duration : 10);
+    }
+    _hibernating = false;
+  }
+}
+
+void GxEPD2_EPD::_waitWhileBusy(const char *comment, uint16_t busy_time) {
+  (void)comment;
+  if (_busy >= 0) {
+    delay(1); // add some margin to become active
+    unsigned long start = micros();
+    while (1) {
+      if (digitalRead(_busy) != _busy_level) {
+        break;
+      }
+      if (_busy_callback) {
+        _busy_callback(_busy_callback_parameter);
+      } else {
+        delay(1);
+      }
+      if (digitalRead(_busy) != _busy_level) {
+        break;
+      }
+      if (micros() - start > _busy_timeout) {
+        break;
+      }
+    }
+  } else {
+    delay(busy_time);
+  }
+}
+
+void GxEPD2_EPD::_writeCommand(uint8_t c) {
+  HostPanel.command(c);
+  _spend(HOST_SPI_SINGLE_WRITE_NS);
+  _spiTime(1);
+}
+
+void GxEPD2_EPD::_writeData(uint8_t d) {
+  HostPanel.data(d);
+  _spend(HOST_SPI_SINGLE_WRITE_NS);
+  _spiTime(1);
+}
+
+void GxEPD2_EPD::_writeData(const uint8_t *data, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    HostPanel.data(*data++);
+  }
+  _spiTime(n);
+}
+
+void GxEPD2_EPD::_writeDataPGM(const uint8_t *data, uint16_t n,
+                               int16_t fill_with_zeroes) {
+  _writeData(data, n);
+  for (int16_t i = 0; i < fill_with_zeroes; i++) {
+    HostPanel.data(0x00);
+  }
+  _spiTime(fill_with_zeroes > 0 ? fill_with_zeroes : 0);
+}
+
+void GxEPD2_EPD::_writeCommandData(const uint8_t *pCommandData,
+                                   uint8_t datalen) {
+  _writeCommand(*pCommandData++);
+  _writeData(pCommandData, datalen - 1);
+}
+
+void GxEPD2_EPD::_startTransfer() { _pSPIx->beginTransaction(_spi_settings); }
+
+void GxEPD2_EPD::_transfer(uint8_t value) {
+  HostPanel.data(value);
+  _spiTime(1);
+}
+
+void GxEPD2_EPD::_endTransfer() { _pSPIx->endTransaction(); }
+
+void GxEPD2_EPD::_spiTime(uint32_t bytes) {
+  _spend((uint64_t)bytes * (8000000000ULL / _spi_settings._clock +
+                            HOST_SPI_BYTE_OVERHEAD_NS));
+}
@@ -0,0 +1,332 @@
+#include "HostRTC.h"
+
+#include <Wire.h>
+
+#include "DS3232RTC.h"
+#include "Rtc_Pcf8563.h"
+#include "WatchyHost.h"
+
+#define HOST_DS_ADDR  0x68
+#define HOST_PCF_ADDR 0x51
+
+HostRTCChip HostRTC;
+
+// TimeLib
+
+#define LEAP_YEAR(Y)                                                           \
+  (((1970 + (Y)) > 0) && !((1970 + (Y)) % 4) &&                                \
+   (((1970 + (Y)) % 100) || !((1970 + (Y)) % 400)))
+
+static const uint8_t monthDays[] = {31, 28, 31, 30, 31, 30,
+                                    31, 31, 30, 31, 30, 31};
+
+void breakTime(time_t timeInput, tmElements_t &tm) {
+  uint8_t year;
+  uint8_t month, monthLength;
+  uint32_t time;
+  unsigned long days;
+
+  time      = (uint32_t)timeInput;
+  tm.Second = time % 60;
+  time /= 60; // now it is minutes
+  tm.Minute = time % 60;
+  time /= 60; // now it is hours
+  tm.Hour = time % 24;
+  time /= 24;                     // now it is days
+  tm.Wday = ((time + 4) % 7) + 1; // Sunday is day 1
+
+  year = 0;
+  days = 0;
+  while ((unsigned)(days += (LEAP_YEAR(year) ? 366 : 365)) <= time) {
+    year++;
+  }
+  tm.Year = year; // year is offset from 1970
+
+  days -= LEAP_YEAR(year) ? 366 : 365;
+  time -= days; // now it is days in this year, starting at 0
+
+  for (month = 0; month < 12; month++) {
+    if (month == 1) { // february
+      monthLength = LEAP_YEAR(year) ? 29 : 28;
+    } else {
+      monthLength = monthDays[month];
+    }
+    if (time >= monthLength) {
+      time -= monthLength;
+    } else {
+      break;
+    }
+  }
+  tm.Month = month + 1; // jan is month 1
+  tm.Day   = time + 1;  // day of month
+}
+
+time_t makeTime(const tmElements_t &tm) {
+  int i;
+  uint32_t seconds;
+
+  // seconds from 1970 till 1 jan 00:00:00 of the given year
+  seconds = tm.Year * (SECS_PER_DAY * 365);
+  for (i = 0; i < tm.Year; i++) {
+    if (LEAP_YEAR(i)) {
+      seconds += SECS_PER_DAY; // add extra days for leap years
+    }
+  }
+  // add days for this year, months start from 1
+  for (i = 1; i < tm.Month; i++) {
+    if ((i == 2) && LEAP_YEAR(tm.Year)) {
+      seconds += SECS_PER_DAY * 29;
+    } else {
+      seconds += SECS_PER_DAY * monthDays[i - 1];
+    }
+  }
+  seconds += (tm.Day - 1) * SECS_PER_DAY;
+  seconds += tm.Hour * SECS_PER_HOUR;
+  seconds += tm.Minute * SECS_PER_MIN;
+  seconds += tm.Second;
+  return (time_t)seconds;
+}
+
+static const char *const monthNames[] = {
+    "",     "January", "February",  "March",   "April",    "May",     "June",
+    "July", "August",  "September", "October", "November", "December"};
+static const char *const dayNames[] = {"",          "Sunday",   "Monday",
+                                       "Tuesday",   "Wednesday", "Thursday",
+                                       "Friday",    "Saturday"};
+static char nameBuffer[10];
+
+static char *_name(const char *name, size_t length) {
+  strncpy(nameBuffer, name, length);
+  nameBuffer[length < sizeof(nameBuffer) ? length : sizeof(nameBuffer) - 1] =
+      0;
+  return nameBuffer;
+}
+
+char *monthStr(uint8_t month) {
+  return _name(monthNames[month < 13 ? month : 0], sizeof(nameBuffer) - 1);
+}
+
+char *dayStr(uint8_t day) {
+  return _name(dayNames[day < 8 ? day : 0], sizeof(nameBuffer) - 1);
+}
+
+char *monthShortStr(uint8_t month) {
+  return _name(monthNames[month < 13 ? month : 0], 3);
+}
+
+char *dayShortStr(uint8_t day) {
+  return _name(dayNames[day < 8 ? day : 0], 3);
+}
+
+// RTC chip
+
+HostRTCChip::HostRTCChip()
+    : type(0), _offset(0), _enabled(false), _interrupt(false), _minute(ANY),
+      _hour(ANY), _day(ANY), _weekday(ANY), _armedAt(0) {}
+
+time_t HostRTCChip::now() const {
+  return (time_t)(_offset + (int64_t)(WatchyHost::now() / 1000000));
+}
+
+void HostRTCChip::set(time_t t) {
+  bool flag = alarmFlag();
+  _offset   = (int64_t)t - (int64_t)(WatchyHost::now() / 1000000);
+  // a pending flag stays set, otherwise matching restarts from the new time
+  if (!flag) {
+    _armedAt = t;
+  }
+}
+
+void HostRTCChip::setAlarm(uint8_t minute, uint8_t hour, uint8_t day,
+                           uint8_t weekday) {
+  bool flag = alarmFlag();
+  _minute   = minute;
+  _hour     = hour;
+  _day      = day;
+  _weekday  = weekday;
+  _enabled  = true;
+  if (!flag) {
+    _armedAt = now();
+  }
+}
+
+void HostRTCChip::disableAlarm() { _enabled = false; }
+
+bool HostRTCChip::alarmFlag() const {
+  return _enabled && _nextMatch(_armedAt) <= now();
+}
+
+void HostRTCChip::clearFlag() { _armedAt = now(); }
+
+uint64_t HostRTCChip::nextInterrupt() const {
+  if (!_enabled || !_interrupt) {
+    return UINT64_MAX;
+  }
+  int64_t t = (int64_t)_nextMatch(_armedAt) - _offset;
+  return t < 0 ? 0 : (uint64_t)t * 1000000;
+}
+
+time_t HostRTCChip::_nextMatch(time_t after) const {
+  // second :00 of the first matching minute after `after`, skipping whole
+  // days and hours that cannot match
+  time_t t = (after / SECS_PER_MIN + 1) * SECS_PER_MIN;
+  for (int guard = 0; guard < 100000; guard++) {
+    tmElements_t tm;
+    breakTime(t, tm);
+    if ((_day != ANY && tm.Day != _day) ||
+        (_weekday != ANY && tm.Wday != _weekday)) {
+      t += SECS_PER_DAY - tm.Hour * SECS_PER_HOUR - tm.Minute * SECS_PER_MIN;
+    } else if (_hour != ANY && tm.Hour != _hour) {
+      t += SECS_PER_HOUR - tm.Minute * SECS_PER_MIN;
+    } else if (_minute != ANY && tm.Minute != _minute) {
+      t += SECS_PER_MIN;
+    } else {
+      return t;
+    }
+  }
+  return (time_t)INT32_MAX;
+}
+
+// Register traffic of the real libraries, so I2C time and transaction
+// counts match the hardware: a pointer write followed by a burst read, or a
+// pointer write with the burst data.
+
+static void _busRead(uint8_t address, uint8_t reg, uint8_t n) {
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  Wire.endTransmission();
+  Wire.requestFrom(address, n);
+  while (Wire.available()) {
+    Wire.read();
+  }
+}
+
+static void _busWrite(uint8_t address, uint8_t reg, uint8_t n) {
+  uint8_t data[16] = {};
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  Wire.write(data, n);
+  Wire.endTransmission();
+}
+
+// DS3232RTC
+
+uint8_t DS3232RTC::set(time_t t) {
+  _busWrite(HOST_DS_ADDR, 0x00, 7);
+  HostRTC.set(t);
+  return 0;
+}
+
+uint8_t DS3232RTC::read(tmElements_t &tm) {
+  _busRead(HOST_DS_ADDR, 0x00, 7);
+  breakTime(HostRTC.now(), tm);
+  return 0;
+}
+
+void DS3232RTC::setAlarm(ALARM_TYPES_t alarmType, uint8_t seconds,
+                         uint8_t minutes, uint8_t hours, uint8_t daydate) {
+  (void)seconds; // the chip model has minute resolution
+  _busWrite(HOST_DS_ADDR, (alarmType & 0x80) ? 0x0B : 0x07,
+            (alarmType & 0x80) ? 3 : 4);
+  uint8_t match    = alarmType & 0x7F;
+  uint8_t anyMin   = match == (ALM2_EVERY_MINUTE & 0x7F) ||
+                   match == ALM1_EVERY_SECOND || match == ALM1_MATCH_SECONDS;
+  uint8_t anyHour  = anyMin || match == (ALM2_MATCH_MINUTES & 0x7F);
+  uint8_t anyDate  = anyHour || match == (ALM2_MATCH_HOURS & 0x7F);
+  bool byWeekday   = match == (ALM2_MATCH_DAY & 0x7F);
+  HostRTC.setAlarm(anyMin ? HostRTCChip::ANY : minutes,
+                   anyHour ? HostRTCChip::ANY : hours,
+                   anyDate || byWeekday ? HostRTCChip::ANY : daydate,
+                   !anyDate && byWeekday ? daydate : HostRTCChip::ANY);
+}
+
+void DS3232RTC::alarmInterrupt(uint8_t alarmNumber, bool alarmEnabled) {
+  (void)alarmNumber;
+  _busRead(HOST_DS_ADDR, 0x0E, 1);
+  _busWrite(HOST_DS_ADDR, 0x0E, 1);
+  HostRTC.setInterrupt(alarmEnabled);
+}
+
+bool DS3232RTC::alarm(uint8_t alarmNumber) {
+  bool flag = checkAlarm(alarmNumber);
+  if (flag) {
+    _busWrite(HOST_DS_ADDR, 0x0F, 1);
+    HostRTC.clearFlag();
+  }
+  return flag;
+}
+
+bool DS3232RTC::checkAlarm(uint8_t alarmNumber) {
+  (void)alarmNumber;
+  _busRead(HOST_DS_ADDR, 0x0F, 1);
+  return HostRTC.alarmFlag();
+}
+
+// Rtc_Pcf8563
+
+void Rtc_Pcf8563::getDateTime() {
+  _busRead(HOST_PCF_ADDR, 0x00, 16);
+  breakTime(HostRTC.now(), _tm);
+}
+
+void Rtc_Pcf8563::setDateTime(uint8_t day, uint8_t weekday, uint8_t month,
+                              bool century, uint8_t year, uint8_t hour,
+                              uint8_t minute, uint8_t sec) {
+  setDate(day, weekday, month, century, year);
+  setTime(hour, minute, sec);
+}
+
+void Rtc_Pcf8563::setDate(uint8_t day, uint8_t weekday, uint8_t month,
+                          bool century, uint8_t year) {
+  (void)weekday; // derived from the date
+  (void)century;
+  _busWrite(HOST_PCF_ADDR, 0x05, 4);
+  tmElements_t tm;
+  breakTime(HostRTC.now(), tm);
+  tm.Day   = day;
+  tm.Month = month;
+  tm.Year  = y2kYearToTm(year);
+  HostRTC.set(makeTime(tm));
+}
+
+void Rtc_Pcf8563::setTime(uint8_t hour, uint8_t minute, uint8_t sec) {
+  _busWrite(HOST_PCF_ADDR, 0x02, 3);
+  tmElements_t tm;
+  breakTime(HostRTC.now(), tm);
+  tm.Hour   = hour;
+  tm.Minute = minute;
+  tm.Second = sec;
+  HostRTC.set(makeTime(tm));
+}
+
+void Rtc_Pcf8563::setAlarm(uint8_t min, uint8_t hour, uint8_t day,
+                           uint8_t weekday) {
+  _busWrite(HOST_PCF_ADDR, 0x09, 4);
+  HostRTC.setAlarm(min < RTCC_NO_ALARM ? min : HostRTCChip::ANY,
+                   hour < RTCC_NO_ALARM ? hour : HostRTCChip::ANY,
+                   day < RTCC_NO_ALARM ? day : HostRTCChip::ANY,
+                   weekday < RTCC_NO_ALARM ? weekday + 1 : HostRTCChip::ANY);
+  enableAlarm(); // the library enables AIE and clears AF here
+}
+
+void Rtc_Pcf8563::resetAlarm() {
+  _busRead(HOST_PCF_ADDR, 0x01, 1);
+  _busWrite(HOST_PCF_ADDR, 0x01, 1);
+  _busWrite(HOST_PCF_ADDR, 0x09, 4);
+  HostRTC.disableAlarm();
+  HostRTC.setInterrupt(false);
+  HostRTC.clearFlag();
+}
+
+void Rtc_Pcf8563::enableAlarm() {
+  _busRead(HOST_PCF_ADDR, 0x01, 1);
+  _busWrite(HOST_PCF_ADDR, 0x01, 1);
+  HostRTC.setInterrupt(true);
+  HostRTC.clearFlag();
+}
+
+void Rtc_Pcf8563::clearAlarm() {
+  _busRead(HOST_PCF_ADDR, 0x01, 1);
+  _busWrite(HOST_PCF_ADDR, 0x01, 1);
+  HostRTC.clearFlag();
+}
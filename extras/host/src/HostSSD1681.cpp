@@ -0,0 +1,239 @@
+#include "HostSSD1681.h"
+
+#include "WatchyHost.h"
+#include "config.h"
+
+HostSSD1681 HostPanel;
+
+HostSSD1681::HostSSD1681() {
+  busyPin           = DISPLAY_BUSY;
+  fullRefreshes     = 0;
+  partialRefreshes  = 0;
+  resets            = 0;
+  bytesWritten      = 0;
+  ghostPixels       = 0;
+  maxGhostPixels    = 0;
+  spiNs             = 0;
+  refreshStartUs    = 0;
+  refreshStartSpiNs = 0;
+  // the glass keeps whatever it showed last, start from a white panel
+  memset(ram, 0xFF, sizeof(ram));
+  memset(screen, 0xFF, sizeof(screen));
+  powerOnReset();
+}
+
+void HostSSD1681::powerOnReset() {
+  hardwareReset();
+  resets = 0;
+}
+
+void HostSSD1681::hardwareReset() {
+  resets++;
+  _deepSleep     = false;
+  _analogOn      = false;
+  _busyUntil     = 0;
+  _command       = 0;
+  _argc          = 0;
+  _entryMode     = 0x03;
+  _xStart        = 0;
+  _xEnd          = WIDTH_BYTES - 1;
+  _yStart        = 0;
+  _yEnd          = HEIGHT - 1;
+  _xCount        = 0;
+  _yCount        = 0;
+  _updateCtl1[0] = 0x00;
+  _updateCtl1[1] = 0x00;
+  _updateCtl2    = 0xFF;
+  lutLoaded      = false;
+}
+
+bool HostSSD1681::busy() const { return WatchyHost::now() < _busyUntil; }
+
+void HostSSD1681::command(uint8_t c) {
+  bytesWritten++;
+  if (_deepSleep) {
+    return; // only a hardware reset leaves deep sleep
+  }
+  _command = c;
+  _argc    = 0;
+  switch (c) {
+  case 0x12: // SWRESET, RAM is kept
+    lutLoaded      = false;
+    _entryMode     = 0x03;
+    _updateCtl1[0] = 0x00;
+    _updateCtl1[1] = 0x00;
+    _busyUntil     = WatchyHost::now() + 1000;
+    break;
+  case 0x20: // master activation
+    _activate();
+    break;
+  }
+}
+
+void HostSSD1681::data(uint8_t d) {
+  bytesWritten++;
+  if (_deepSleep) {
+    return;
+  }
+  if (_command == 0x24 || _command == 0x26) {
+    _writeRam(d);
+    return;
+  }
+  if (_argc < sizeof(_args)) {
+    _args[_argc] = d;
+  }
+  _argc++;
+  switch (_command) {
+  case 0x10: // deep sleep mode
+    if (d & 0x03) {
+      _deepSleep = true;
+      _analogOn  = false;
+    }
+    break;
+  case 0x11: // data entry mode
+    _entryMode = d & 0x07;
+    break;
+  case 0x21: // display update control 1
+    if (_argc <= 2) {
+      _updateCtl1[_argc - 1] = d;
+    }
+    break;
+  case 0x22: // display update control 2
+    _updateCtl2 = d;
+    break;
+  case 0x32: // write LUT register
+    if (_argc <= sizeof(lut)) {
+      lut[_argc - 1] = d;
+      lutLoaded      = true;
+    }
+    break;
+  case 0x44: // RAM x window, in bytes
+    if (_argc == 1) {
+      _xStart = d;
+    } else if (_argc == 2) {
+      _xEnd = d;
+    }
+    break;
+  case 0x45: // RAM y window
+    if (_argc == 2) {
+      _yStart = _args[0] | ((d & 0x01) << 8);
+    } else if (_argc == 4) {
+      _yEnd = _args[2] | ((d & 0x01) << 8);
+    }
+    break;
+  case 0x4E: // RAM x address counter
+    _xCount = d;
+    break;
+  case 0x4F: // RAM y address counter
+    if (_argc == 2) {
+      _yCount = _args[0] | ((d & 0x01) << 8);
+    }
+    break;
+  }
+}
+
+void HostSSD1681::_writeRam(uint8_t value) {
+  uint8_t plane = (_command == 0x24) ? 0 : 1;
+  if (_xCount < WIDTH_BYTES && _yCount < HEIGHT) {
+    ram[plane][_yCount * WIDTH_BYTES + _xCount] = value;
+  }
+  int8_t xStep = (_entryMode & 0x01) ? 1 : -1;
+  int8_t yStep = (_entryMode & 0x02) ? 1 : -1;
+  if (_entryMode & 0x04) { // address counter runs in y first
+    if (_yCount == _yEnd) {
+      _yCount = _yStart;
+      _xCount += xStep;
+    } else {
+      _yCount += yStep;
+    }
+  } else {
+    if (_xCount == _xEnd) {
+      _xCount = _xStart;
+      _yCount += yStep;
+    } else {
+      _xCount += xStep;
+    }
+  }
+}
+
+// 0x22 option bits: 0x80 clock on, 0x40 analog on, 0x20 load temperature,
+// 0x10 load LUT from OTP, 0x08 display mode 2, 0x04 display, 0x02 analog
+// off, 0x01 clock off
+void HostSSD1681::_activate() {
+  uint64_t t    = WatchyHost::now();
+  uint64_t busy = 0;
+  if ((_updateCtl2 & 0x40) && !_analogOn) {
+    _analogOn = true;
+    busy += POWER_ON_US;
+  }
+  if (_updateCtl2 & 0x10) {
+    lutLoaded = false; // OTP waveform replaces a custom one
+  }
+  if (_updateCtl2 & 0x04) {
+    if (refreshStartUs == 0) {
+      refreshStartUs    = t;
+      refreshStartSpiNs = spiNs;
+    }
+    bool differential = _updateCtl2 & 0x08;
+    _display(differential);
+    if (lutLoaded) {
+      busy += _lutUs();
+    } else {
+      busy += differential ? PARTIAL_REFRESH_US : FULL_REFRESH_US;
+    }
+  }
+  if ((_updateCtl2 & 0x02) && _analogOn) {
+    _analogOn = false;
+    busy += POWER_OFF_US;
+  }
+  _busyUntil = t + busy;
+}
+
+// A custom waveform runs 12 groups of phases A to D, each of its TP frames.
+// The A-B and C-D pairs repeat SR + 1 times, the group RP + 1 times. Frames
+// are taken at 50 Hz, the frame rate bytes are not decoded.
+uint32_t HostSSD1681::_lutUs() const {
+  uint32_t frames = 0;
+  for (uint8_t g = 0; g < 12; g++) {
+    const uint8_t *tp = lut + 60 + g * 7; // A, B, SR AB, C, D, SR CD, RP
+    frames += (tp[6] + 1) *
+              ((tp[2] + 1) * (tp[0] + tp[1]) + (tp[5] + 1) * (tp[3] + tp[4]));
+  }
+  return frames * 20000;
+}
+
+// A RAM byte as an update reads it through its 0x21 option nibble
+static uint8_t ramOption(uint8_t value, uint8_t option) {
+  if (option == 0x08) {
+    return ~value;
+  } else if (option == 0x04) {
+    return 0x00;
+  }
+  return value;
+}
+
+// Mode 1 drives every pixel to the BW RAM. Mode 2 only drives pixels whose
+// BW and previous RAM bits differ, so a stale previous RAM leaves ghosts.
+// Both go through their RAM options.
+void HostSSD1681::_display(bool differential) {
+  uint8_t bwOption  = _updateCtl1[0] & 0x0F;
+  uint8_t redOption = _updateCtl1[0] >> 4;
+  for (uint16_t i = 0; i < RAM_SIZE; i++) {
+    uint8_t next = ramOption(ram[0][i], bwOption);
+    if (differential) {
+      uint8_t changed = next ^ ramOption(ram[1][i], redOption);
+      uint8_t shown   = (screen[i] & ~changed) | (next & changed);
+      ghostPixels += __builtin_popcount(shown ^ screen[i]);
+      screen[i] = shown;
+    } else {
+      screen[i] = next;
+    }
+  }
+  if (differential) {
+    partialRefreshes++;
+    maxGhostPixels = max(maxGhostPixels, ghostPixels);
+  } else {
+    fullRefreshes++;
+    ghostPixels = 0;
+  }
+}
@@ -0,0 +1,139 @@
+#include "WString.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static std::string _toBase(unsigned long long value, unsigned char base) {
+  if (base < 2 || base > 36) {
+    base = 10;
+  }
+  char buf[72];
+  char *p = &buf[sizeof(buf) - 1];
+  *p      = '\0';
+  do {
+    unsigned digit = value % base;
+    *--p           = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value);
+  return std::string(p);
+}
+
+static std::string _signedToBase(long long value, unsigned char base) {
+  if (value < 0 && base == 10) {
+    return "-" + _toBase(-(unsigned long long)value, base);
+  }
+  return _toBase((unsigned long long)value, base);
+}
+
+String::String(unsigned char value, unsigned char base)
+    : _s(_toBase(value, base)) {}
+String::String(int value, unsigned char base)
+    : _s(_signedToBase(value, base)) {}
+String::String(unsigned int value, unsigned char base)
+    : _s(_toBase(value, base)) {}
+String::String(long value, unsigned char base)
+    : _s(_signedToBase(value, base)) {}
+String::String(unsigned long value, unsigned char base)
+    : _s(_toBase(value, base)) {}
+
+String::String(float value, unsigned char decimalPlaces) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, (double)value);
+  _s = buf;
+}
+
+String::String(double value, unsigned char decimalPlaces) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  _s = buf;
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const {
+  size_t pos = _s.find(ch, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const {
+  size_t pos = _s.find(str._s, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+bool String::startsWith(const String &prefix) const {
+  return _s.compare(0, prefix._s.length(), prefix._s) == 0;
+}
+
+bool String::endsWith(const String &suffix) const {
+  return _s.length() >= suffix._s.length() &&
+         _s.compare(_s.length() - suffix._s.length(), suffix._s.length(),
+                    suffix._s) == 0;
+}
+
+String String::substring(unsigned int beginIndex) const {
+  return substring(beginIndex, _s.length());
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) {
+    unsigned int t = beginIndex;
+    beginIndex     = endIndex;
+    endIndex       = t;
+  }
+  if (beginIndex >= _s.length()) {
+    return String();
+  }
+  if (endIndex > _s.length()) {
+    endIndex = _s.length();
+  }
+  return String(_s.substr(beginIndex, endIndex - beginIndex));
+}
+
+void String::toUpperCase() {
+  for (char &c : _s) {
+    c = toupper((unsigned char)c);
+  }
+}
+
+void String::toLowerCase() {
+  for (char &c : _s) {
+    c = tolower((unsigned char)c);
+  }
+}
+
+void String::trim() {
+  size_t begin = _s.find_first_not_of(" \t\r\n");
+  if (begin == std::string::npos) {
+    _s.clear();
+    return;
+  }
+  size_t end = _s.find_last_not_of(" \t\r\n");
+  _s         = _s.substr(begin, end - begin + 1);
+}
+
+long String::toInt() const { return atol(_s.c_str()); }
+
+float String::toFloat() const { return atof(_s.c_str()); }
+
+String operator+(const String &lhs, const String &rhs) {
+  String s(lhs);
+  s += rhs;
+  return s;
+}
+
+String operator+(const String &lhs, const char *rhs) {
+  String s(lhs);
+  s += rhs;
+  return s;
+}
+
+String operator+(const char *lhs, const String &rhs) {
+  String s(lhs);
+  s += rhs;
+  return s;
+}
+
+String operator+(const String &lhs, char rhs) {
+  String s(lhs);
+  s += rhs;
+  return s;
+}
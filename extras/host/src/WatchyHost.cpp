@@ -0,0 +1,346 @@
+#include "WatchyHost.h"
+
+#include <chrono>
+
+#include "HostRTC.h"
+#include "HostSSD1681.h"
+#include "config.h"
+
+// cost charged for one GPIO poll so busy loops on digitalRead() advance time
+#define HOST_POLL_COST_US 20
+
+double WatchyHost::cpuScale = 1.0;
+uint64_t WatchyHost::timeIn[HOST_POWER_STATES];
+uint64_t WatchyHost::endUs = UINT64_MAX;
+uint64_t WatchyHost::bootUs = 0;
+uint32_t WatchyHost::batteryMv = 4000;
+bool WatchyHost::wifi = false;
+esp_sleep_wakeup_cause_t WatchyHost::wakeCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+uint64_t WatchyHost::ext1Status                = 0;
+bool WatchyHost::ext0Enabled                   = false;
+int WatchyHost::ext0Pin                        = -1;
+int WatchyHost::ext0Level                      = 0;
+uint64_t WatchyHost::ext1Mask                  = 0;
+uint64_t WatchyHost::timerWakeUs               = 0;
+bool WatchyHost::gpioWakeEnabled               = false;
+gpio_int_type_t WatchyHost::gpioWake[40];
+HostButtonPress WatchyHost::_buttons[64];
+int WatchyHost::_buttonCount = 0;
+
+static uint64_t _clockUs = 0;
+static bool _cpuClockRunning = false;
+static std::chrono::steady_clock::time_point _cpuMark;
+
+static void _chargeCpu() {
+  if (!_cpuClockRunning) {
+    return;
+  }
+  std::chrono::steady_clock::time_point t = std::chrono::steady_clock::now();
+  double us = std::chrono::duration<double, std::micro>(t - _cpuMark).count();
+  uint64_t charged = (uint64_t)(us * WatchyHost::cpuScale);
+  // keep the fractional part so frequent reads do not lose time
+  _cpuMark += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double, std::micro>(charged /
+                                                WatchyHost::cpuScale));
+  _clockUs += charged;
+  WatchyHost::timeIn[HOST_ACTIVE] += charged;
+}
+
+uint64_t WatchyHost::now() {
+  _chargeCpu();
+  return _clockUs;
+}
+
+void WatchyHost::spend(uint64_t us, HostPowerState state) {
+  _chargeCpu();
+  _clockUs += us;
+  timeIn[state] += us;
+  if (_clockUs > endUs && state == HOST_ACTIVE) {
+    throw HostTimeout();
+  }
+}
+
+void WatchyHost::advanceTo(uint64_t us, HostPowerState state) {
+  _chargeCpu();
+  if (us > _clockUs) {
+    timeIn[state] += us - _clockUs;
+    _clockUs = us;
+  }
+}
+
+void WatchyHost::holdCpuClock() {
+  _chargeCpu();
+  _cpuClockRunning = false;
+}
+
+void WatchyHost::resumeCpuClock() {
+  _cpuMark         = std::chrono::steady_clock::now();
+  _cpuClockRunning = true;
+}
+
+void WatchyHost::pressButton(uint64_t atUs, uint8_t pin, uint32_t durationMs) {
+  if (_buttonCount == sizeof(_buttons) / sizeof(_buttons[0])) {
+    return;
+  }
+  // keep the script sorted by time
+  int i = _buttonCount++;
+  while (i > 0 && _buttons[i - 1].atUs > atUs) {
+    _buttons[i] = _buttons[i - 1];
+    i--;
+  }
+  _buttons[i] = {atUs, pin, durationMs * 1000, false};
+}
+
+void WatchyHost::consumeButtons(uint64_t upTo) {
+  for (int i = 0; i < _buttonCount; i++) {
+    if (_buttons[i].atUs <= upTo) {
+      _buttons[i].consumed = true;
+    }
+  }
+}
+
+int WatchyHost::pinLevel(uint8_t pin) {
+  uint64_t t = now();
+  if (pin == HostPanel.busyPin) {
+    return HostPanel.busy() ? HIGH : LOW;
+  }
+  if (pin == RTC_INT_PIN) { // open drain, active low
+    return HostRTC.intAsserted() ? LOW : HIGH;
+  }
+  for (int i = 0; i < _buttonCount; i++) {
+    const HostButtonPress &b = _buttons[i];
+    if (!b.consumed && b.pin == pin && t >= b.atUs &&
+        t < b.atUs + b.durationUs) {
+      return HIGH;
+    }
+  }
+  return LOW;
+}
+
+uint64_t WatchyHost::nextWake(uint64_t from, bool lightSleep,
+                              esp_sleep_wakeup_cause_t &cause, uint64_t &ext1) {
+  uint64_t best = UINT64_MAX;
+  cause         = ESP_SLEEP_WAKEUP_UNDEFINED;
+  ext1          = 0;
+  if (timerWakeUs) {
+    best  = from + timerWakeUs;
+    cause = ESP_SLEEP_WAKEUP_TIMER;
+  }
+  if (ext0Enabled && ext0Level == 0) {
+    uint64_t t = HostRTC.intAsserted() ? from : HostRTC.nextInterrupt();
+    if (t < best) {
+      best  = t < from ? from : t;
+      cause = ESP_SLEEP_WAKEUP_EXT0;
+    }
+  }
+  if (lightSleep && gpioWakeEnabled) {
+    if (gpioWake[HostPanel.busyPin] == GPIO_INTR_LOW_LEVEL) {
+      uint64_t t = HostPanel.busy() ? HostPanel.busyUntil() : from;
+      if (t < best) {
+        best  = t;
+        cause = ESP_SLEEP_WAKEUP_GPIO;
+      }
+    }
+    if (gpioWake[RTC_INT_PIN] == GPIO_INTR_LOW_LEVEL) {
+      uint64_t t = HostRTC.intAsserted() ? from : HostRTC.nextInterrupt();
+      if (t < best) {
+        best  = t < from ? from : t;
+        cause = ESP_SLEEP_WAKEUP_GPIO;
+      }
+    }
+    // button released
+    for (int i = 0; i < _buttonCount; i++) {
+      const HostButtonPress &b = _buttons[i];
+      if (gpioWake[b.pin] != GPIO_INTR_LOW_LEVEL) {
+        continue;
+      }
+      uint64_t t = from;
+      if (!b.consumed && from >= b.atUs && from < b.atUs + b.durationUs) {
+        t = b.atUs + b.durationUs;
+      } else if (pinLevel(b.pin) == HIGH) {
+        continue; // held by another press
+      }
+      if (t < best) {
+        best  = t;
+        cause = ESP_SLEEP_WAKEUP_GPIO;
+      }
+    }
+  }
+  for (int i = 0; i < _buttonCount; i++) {
+    const HostButtonPress &b = _buttons[i];
+    if (b.consumed || b.atUs + b.durationUs <= from) {
+      continue;
+    }
+    uint64_t pinMask = (uint64_t)1 << b.pin;
+    bool armed       = (ext1Mask & pinMask) ||
+                 (lightSleep && gpioWakeEnabled && b.pin < 40 &&
+                  gpioWake[b.pin] == GPIO_INTR_HIGH_LEVEL);
+    if (!armed) {
+      continue;
+    }
+    uint64_t t = b.atUs < from ? from : b.atUs;
+    if (t < best) {
+      best  = t;
+      cause = (ext1Mask & pinMask) && !lightSleep ? ESP_SLEEP_WAKEUP_EXT1
+                                                  : ESP_SLEEP_WAKEUP_GPIO;
+      ext1  = pinMask;
+    } else if (t == best && cause == ESP_SLEEP_WAKEUP_EXT1) {
+      ext1 |= pinMask;
+    }
+  }
+  return best;
+}
+
+void WatchyHost::clearWakeSources() {
+  ext0Enabled     = false;
+  ext0Pin         = -1;
+  ext1Mask        = 0;
+  timerWakeUs     = 0;
+  gpioWakeEnabled = false;
+  for (int i = 0; i < 40; i++) {
+    gpioWake[i] = GPIO_INTR_DISABLE;
+  }
+}
+
+// Arduino core
+
+HardwareSerial Serial;
+
+void HardwareSerial::flush() { fflush(stderr); }
+
+// the serial log goes to stderr, stdout is the runner's report
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stderr); }
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  return fwrite(buffer, 1, size, stderr);
+}
+
+unsigned long millis() {
+  return (WatchyHost::now() - WatchyHost::bootUs) / 1000;
+}
+
+unsigned long micros() { return WatchyHost::now() - WatchyHost::bootUs; }
+
+void delay(uint32_t ms) { WatchyHost::spend((uint64_t)ms * 1000); }
+
+void delayMicroseconds(uint32_t us) { WatchyHost::spend(us); }
+
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+int digitalRead(uint8_t pin) {
+  WatchyHost::spend(HOST_POLL_COST_US);
+  return WatchyHost::pinLevel(pin);
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  (void)pin;
+  (void)val;
+}
+
+uint32_t analogReadMilliVolts(uint8_t pin) {
+  (void)pin;
+  return WatchyHost::batteryMv / 2; // battery sits behind a 1/2 divider
+}
+
+// ESP-IDF sleep API
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+  return WatchyHost::wakeCause;
+}
+
+uint64_t esp_sleep_get_ext1_wakeup_status() { return WatchyHost::ext1Status; }
+
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level) {
+  WatchyHost::ext0Enabled = true;
+  WatchyHost::ext0Pin     = gpio_num;
+  WatchyHost::ext0Level   = level;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_ext1_wakeup(uint64_t mask,
+                                       esp_sleep_ext1_wakeup_mode_t mode) {
+  (void)mode;
+  WatchyHost::ext1Mask = mask;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+  WatchyHost::timerWakeUs = time_in_us;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+  WatchyHost::gpioWakeEnabled = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_wakeup_cause_t source) {
+  switch (source) {
+  case ESP_SLEEP_WAKEUP_ALL:
+    WatchyHost::clearWakeSources();
+    break;
+  case ESP_SLEEP_WAKEUP_EXT0:
+    WatchyHost::ext0Enabled = false;
+    break;
+  case ESP_SLEEP_WAKEUP_EXT1:
+    WatchyHost::ext1Mask = 0;
+    break;
+  case ESP_SLEEP_WAKEUP_TIMER:
+    WatchyHost::timerWakeUs = 0;
+    break;
+  case ESP_SLEEP_WAKEUP_GPIO:
+    WatchyHost::gpioWakeEnabled = false;
+    break;
+  default:
+    break;
+  }
+  return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+  if (gpio_num >= 0 && gpio_num < 40) {
+    WatchyHost::gpioWake[gpio_num] = intr_type;
+  }
+  return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio_num) {
+  return gpio_wakeup_enable(gpio_num, GPIO_INTR_DISABLE);
+}
+
+// pin states are not modelled
+esp_err_t gpio_hold_en(gpio_num_t gpio_num) {
+  (void)gpio_num;
+  return ESP_OK;
+}
+
+esp_err_t gpio_hold_dis(gpio_num_t gpio_num) {
+  (void)gpio_num;
+  return ESP_OK;
+}
+
+void gpio_deep_sleep_hold_en() {}
+
+esp_err_t esp_light_sleep_start() {
+  esp_sleep_wakeup_cause_t cause;
+  uint64_t ext1;
+  uint64_t from = WatchyHost::now();
+  uint64_t t    = WatchyHost::nextWake(from, true, cause, ext1);
+  if (t == UINT64_MAX) {
+    return ESP_OK; // nothing armed, the real chip would sleep forever
+  }
+  WatchyHost::advanceTo(t, HOST_LIGHT_SLEEP);
+  WatchyHost::wakeCause = cause;
+  return ESP_OK;
+}
+
+void esp_deep_sleep_start() { throw HostDeepSleep(); }
+
+void esp_restart() { throw HostRestart(); }
+
+bool btStop() { return true; }
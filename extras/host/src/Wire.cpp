@@ -0,0 +1,86 @@
+#include "Wire.h"
+
+#include "WatchyHost.h"
+
+// Start, address and stop framing per transaction, 9 clocks per byte (8
+// data bits and the ACK) on top
+#define HOST_I2C_FRAME_CLOCKS 20
+
+TwoWire Wire;
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+  (void)sda;
+  (void)scl;
+  if (frequency) {
+    _frequency = frequency;
+  }
+  return true;
+}
+
+void TwoWire::attach(uint8_t address, HostI2CDevice *device) {
+  _devices[address & 0x7F] = device;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  _txAddress = address & 0x7F;
+  _txLength  = 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (_txLength >= sizeof(_tx)) {
+    return 0;
+  }
+  _tx[_txLength++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity) {
+  size_t n = 0;
+  while (n < quantity && write(data[n])) {
+    n++;
+  }
+  return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  (void)sendStop;
+  _transactions++;
+  _busTime(_txLength);
+  HostI2CDevice *dev = _devices[_txAddress];
+  if (dev == NULL) {
+    return 2; // address NACK
+  }
+  if (_txLength > 0) {
+    uint8_t reg = _tx[0];
+    for (size_t i = 1; i < _txLength; i++) {
+      dev->writeRegister(reg++, _tx[i]);
+    }
+    _pointer[_txAddress] = reg;
+  }
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity,
+                             bool sendStop) {
+  (void)sendStop;
+  address &= 0x7F;
+  _transactions++;
+  _rxLength = 0;
+  _rxIndex  = 0;
+  _busTime(quantity);
+  HostI2CDevice *dev = _devices[address];
+  if (dev == NULL) {
+    return 0;
+  }
+  uint8_t reg = _pointer[address];
+  for (uint8_t i = 0; i < quantity && _rxLength < sizeof(_rx); i++) {
+    _rx[_rxLength++] = dev->readRegister(reg++);
+  }
+  _pointer[address] = reg;
+  return _rxLength;
+}
+
+void TwoWire::_busTime(size_t bytes) {
+  uint64_t clocks = HOST_I2C_FRAME_CLOCKS + 9 * (uint64_t)bytes;
+  WatchyHost::spend(clocks * 1000000ULL / _frequency);
+}
@@ -0,0 +1,392 @@
+// Runner for a watch face built against the host backend. It plays the
+// part of the ESP32 boot ROM: calls setup() on every simulated boot, catches
+// the deep sleep, fast-forwards the virtual clock to the next armed wake
+// source and boots again with that wake cause, until the run time is over.
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+#include "HostRTC.h"
+#include "HostSSD1681.h"
+#include "Watchy.h"
+#include "WatchyHost.h"
+
+void setup();
+void loop();
+
+struct HostOptions {
+  const char *start   = "2022:01:01:12:00:00";
+  double minutes      = 10;
+  uint8_t rtcType     = RTC_TYPE;
+  const char *pbm     = NULL;
+  bool quiet          = false;
+  bool profile        = false;
+  int bootMs          = -1; // energy model default
+  WatchyDisplay::RefreshMode refreshMode = WatchyDisplay::REFRESH_PARTIAL;
+};
+
+static void _usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [options]\n"
+          "  --start YYYY:MM:DD:HH:MM:SS  RTC time at power on\n"
+          "  --minutes N                  virtual run time (default 10)\n"
+          "  --press SEC=BUTTON[:MS]      press menu|back|up|down SEC seconds\n"
+          "                               after power on, for MS ms (100)\n"
+          "  --rtc pcf8563|ds3231         RTC chip (default per hardware rev)\n"
+          "  --vbat MV                    battery voltage (default 4000)\n"
+          "  --cpu-scale X                ESP32 time per unit of host CPU\n"
+          "                               time (default 1.0)\n"
+          "  --tick MIN                   RTC wake every MIN minutes (1)\n"
+          "  --quiet-hours FROM-TO        no ticks from hour FROM to TO\n"
+          "  --max-partials N             full refresh after N partial ones\n"
+          "  --async-refresh MS           deep sleep through refreshes of\n"
+          "                               MS or longer, 0: never\n"
+          "  --refresh-mode MODE          waveform of partial refreshes:\n"
+          "                               partial, fast or full\n"
+          "  --prewake MS                 wake MS ahead of ticks to draw\n"
+          "                               them, 0: on the tick\n"
+          "  --boot-ms MS                 energy model's wake to setup()\n"
+          "  --wifi                       join an access point, print HTTP\n"
+          "                               requests\n"
+          "  --pbm FILE                   write the final panel image\n"
+          "  --profile                    print every wake profiler record\n"
+          "                               to stderr as it is committed\n"
+          "  --quiet                      summary only\n",
+          argv0);
+  exit(2);
+}
+
+static int _buttonPin(const char *name) {
+  if (!strcmp(name, "menu")) {
+    return MENU_BTN_PIN;
+  }
+  if (!strcmp(name, "back")) {
+    return BACK_BTN_PIN;
+  }
+  if (!strcmp(name, "up")) {
+    return UP_BTN_PIN;
+  }
+  if (!strcmp(name, "down")) {
+    return DOWN_BTN_PIN;
+  }
+  return -1;
+}
+
+static time_t _parseTime(const char *s) {
+  int year, month, day, hour, minute, second;
+  if (sscanf(s, "%d:%d:%d:%d:%d:%d", &year, &month, &day, &hour, &minute,
+             &second) != 6) {
+    return -1;
+  }
+  tmElements_t tm;
+  tm.Year   = CalendarYrToTm(year);
+  tm.Month  = month;
+  tm.Day    = day;
+  tm.Hour   = hour;
+  tm.Minute = minute;
+  tm.Second = second;
+  return makeTime(tm);
+}
+
+static const char *_causeName(esp_sleep_wakeup_cause_t cause) {
+  switch (cause) {
+  case ESP_SLEEP_WAKEUP_EXT0:
+    return "rtc";
+  case ESP_SLEEP_WAKEUP_EXT1:
+    return "button";
+  case ESP_SLEEP_WAKEUP_TIMER:
+    return "timer";
+  case ESP_SLEEP_WAKEUP_GPIO:
+    return "gpio";
+  default:
+    return "reset";
+  }
+}
+
+static void _writePbm(const char *path) {
+  FILE *f = fopen(path, "wb");
+  if (f == NULL) {
+    perror(path);
+    return;
+  }
+  fprintf(f, "P4\n%d %d\n", HostSSD1681::WIDTH, HostSSD1681::HEIGHT);
+  for (uint16_t i = 0; i < HostSSD1681::RAM_SIZE; i++) {
+    fputc(~HostPanel.screen[i] & 0xFF, f); // PBM 1 is black
+  }
+  fclose(f);
+}
+
+// Deep sleep loses everything outside RTC memory. The sketch's own globals
+// are left alone, Watchy keeps its per-boot state in these two statics.
+static void _resetStatics() {
+  Watchy::display.~WatchyDisplay();
+  new (&Watchy::display) WatchyDisplay(
+      GxEPD2_154_D67(DISPLAY_CS, DISPLAY_DC, DISPLAY_RES, DISPLAY_BUSY));
+  Watchy::RTC.~WatchyRTC();
+  new (&Watchy::RTC) WatchyRTC();
+}
+
+int main(int argc, char **argv) {
+  HostOptions opt;
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!strcmp(arg, "--quiet")) {
+      opt.quiet = true;
+      continue;
+    }
+    if (!strcmp(arg, "--profile")) {
+      opt.profile = true;
+      continue;
+    }
+    if (!strcmp(arg, "--wifi")) {
+      WatchyHost::wifi = true;
+      continue;
+    }
+    if (val == NULL) {
+      _usage(argv[0]);
+    }
+    i++;
+    if (!strcmp(arg, "--start")) {
+      opt.start = val;
+    } else if (!strcmp(arg, "--minutes")) {
+      opt.minutes = atof(val);
+    } else if (!strcmp(arg, "--rtc")) {
+      if (!strcmp(val, "pcf8563")) {
+        opt.rtcType = PCF8563;
+      } else if (!strcmp(val, "ds3231")) {
+        opt.rtcType = DS3231;
+      } else {
+        _usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--vbat")) {
+      WatchyHost::batteryMv = atoi(val);
+    } else if (!strcmp(arg, "--cpu-scale")) {
+      WatchyHost::cpuScale = atof(val);
+    } else if (!strcmp(arg, "--tick")) {
+      Watchy::RTC.setTickInterval(atoi(val)); // kept in RTC memory
+    } else if (!strcmp(arg, "--quiet-hours")) {
+      unsigned from, to;
+      if (sscanf(val, "%u-%u", &from, &to) != 2 || from > 23 || to > 23) {
+        _usage(argv[0]);
+      }
+      Watchy::RTC.setQuietHours(from, to);
+    } else if (!strcmp(arg, "--max-partials") ||
+               !strcmp(arg, "--async-refresh")) {
+      refreshPolicy policy = Watchy::display.getRefreshPolicy();
+      if (arg[2] == 'm') {
+        policy.maxPartials = atoi(val);
+      } else {
+        policy.asyncMs = atoi(val);
+      }
+      Watchy::display.setRefreshPolicy(policy); // kept in RTC memory
+    } else if (!strcmp(arg, "--refresh-mode")) {
+      if (!strcmp(val, "partial")) {
+        opt.refreshMode = WatchyDisplay::REFRESH_PARTIAL;
+      } else if (!strcmp(val, "fast")) {
+        opt.refreshMode = WatchyDisplay::REFRESH_FAST;
+      } else if (!strcmp(val, "full")) {
+        opt.refreshMode = WatchyDisplay::REFRESH_FULL;
+      } else {
+        _usage(argv[0]);
+      }
+    } else if (!strcmp(arg, "--prewake")) {
+      Watchy::RTC.setPrewake(atoi(val)); // kept in RTC memory
+    } else if (!strcmp(arg, "--boot-ms")) {
+      opt.bootMs = atoi(val);
+    } else if (!strcmp(arg, "--pbm")) {
+      opt.pbm = val;
+    } else if (!strcmp(arg, "--press")) {
+      char name[16];
+      double at;
+      unsigned ms = 100;
+      if (sscanf(val, "%lf=%15[a-z]:%u", &at, name, &ms) < 2 ||
+          _buttonPin(name) < 0) {
+        _usage(argv[0]);
+      }
+      WatchyHost::pressButton((uint64_t)(at * 1e6), _buttonPin(name), ms);
+    } else {
+      _usage(argv[0]);
+    }
+  }
+
+  time_t start = _parseTime(opt.start);
+  if (start < 0) {
+    _usage(argv[0]);
+  }
+
+  // I2C devices: the RTC answers at its address, the BMA423 reports its
+  // chip id and a finished config load
+  static HostRegisterFile rtcRegs, bmaRegs;
+  bmaRegs.regs[0x00] = 0x13; // BMA423 chip id
+  bmaRegs.regs[0x2A] = 0x01; // INTERNAL_STATUS: init ok
+  Wire.attach(opt.rtcType == DS3231 ? RTC_DS_ADDR : RTC_PCF_ADDR, &rtcRegs);
+  Wire.attach(BMA4_I2C_ADDR_PRIMARY, &bmaRegs);
+  HostRTC.type = opt.rtcType;
+  HostRTC.set(start);
+
+  WatchyHost::endUs = (uint64_t)(opt.minutes * 60e6);
+  esp_sleep_wakeup_cause_t cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+  uint64_t ext1                  = 0;
+  uint32_t boots                 = 0;
+  bool timedOut                  = false;
+  WatchyEnergy energy;
+  if (opt.bootMs >= 0) {
+    energy.model.bootMs = opt.bootMs;
+  }
+  double wakeMah   = 0;
+  uint64_t awakeUs = 0;
+  uint32_t wakes   = 0;
+  // from wake to the start of the first refresh, for wakes that refresh
+  std::vector<uint64_t> toRefreshUs, toRefreshSpiNs;
+  // from the minute to the start of its refresh, for wakes by the RTC alarm
+  // or ahead of it
+  std::vector<uint64_t> lateUs;
+
+  if (opt.profile) {
+    WatchyProfiler::dumpHeader(Serial);
+  }
+  if (!opt.quiet) {
+    printf("%-8s %-7s %10s %10s %5s %5s\n", "time", "wake", "awake ms",
+           "light ms", "full", "part");
+  }
+  while (WatchyHost::now() < WatchyHost::endUs) {
+    uint64_t bootAt     = WatchyHost::now();
+    uint64_t lightAt    = WatchyHost::timeIn[HOST_LIGHT_SLEEP];
+    uint32_t fullAt     = HostPanel.fullRefreshes;
+    uint32_t partialAt  = HostPanel.partialRefreshes;
+    uint64_t spiAt      = HostPanel.spiNs;
+    bool restarted      = false;
+    bool slept          = false;
+    WatchyHost::bootUs     = bootAt;
+    WatchyHost::wakeCause  = cause;
+    WatchyHost::ext1Status = ext1;
+    WatchyHost::clearWakeSources();
+    _resetStatics();
+    Watchy::display.setRefreshMode(opt.refreshMode); // for this boot
+    HostPanel.refreshStartUs = 0;
+    boots++;
+
+    WatchyHost::resumeCpuClock();
+    try {
+      setup();
+      loop();
+      fprintf(stderr, "setup() returned without entering deep sleep\n");
+      WatchyHost::holdCpuClock();
+      return 1;
+    } catch (HostDeepSleep &) {
+      slept = true;
+    } catch (HostRestart &) {
+      restarted = true;
+    } catch (HostTimeout &) {
+      timedOut = true;
+    }
+    WatchyHost::holdCpuClock();
+    if (HostPanel.refreshStartUs != 0) {
+      toRefreshUs.push_back(HostPanel.refreshStartUs - bootAt);
+      toRefreshSpiNs.push_back(HostPanel.refreshStartSpiNs - spiAt);
+      if (cause == ESP_SLEEP_WAKEUP_EXT0 || cause == ESP_SLEEP_WAKEUP_TIMER) {
+        int64_t epoch = (int64_t)HostRTC.now() -
+                        (int64_t)(WatchyHost::now() / 1000000); // at 0
+        uint64_t late = (epoch * 1000000 + HostPanel.refreshStartUs) % 60000000;
+        if (cause == ESP_SLEEP_WAKEUP_EXT0) {
+          late += energy.model.bootMs * 1000; // before setup() on a watch
+        }
+        lateUs.push_back(late);
+      }
+    }
+    if (slept) { // deepSleep() committed a record
+      const wakeProfile &wake =
+          WatchyProfiler::wake(WatchyProfiler::count() - 1);
+      wakeMah += energy.wakeMah(wake);
+      awakeUs += wake.awakeUs;
+      wakes++;
+      if (opt.profile) {
+        WatchyProfiler::dumpWake(Serial, WatchyProfiler::count() - 1);
+      }
+    }
+
+    if (!opt.quiet) {
+      tmElements_t tm;
+      breakTime(start + (time_t)(bootAt / 1000000), tm);
+      printf("%02d:%02d:%02d %-7s %10.1f %10.1f %5u %5u\n", tm.Hour,
+             tm.Minute, tm.Second, _causeName(cause),
+             (WatchyHost::now() - bootAt) / 1000.0,
+             (WatchyHost::timeIn[HOST_LIGHT_SLEEP] - lightAt) / 1000.0,
+             HostPanel.fullRefreshes - fullAt,
+             HostPanel.partialRefreshes - partialAt);
+    }
+    if (timedOut) {
+      break;
+    }
+    if (restarted) {
+      cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+      ext1  = 0;
+      continue;
+    }
+    uint64_t wakeAt = WatchyHost::nextWake(WatchyHost::now(), false, cause, ext1);
+    if (wakeAt >= WatchyHost::endUs) {
+      WatchyHost::advanceTo(WatchyHost::endUs, HOST_DEEP_SLEEP);
+      break;
+    }
+    WatchyHost::advanceTo(wakeAt, HOST_DEEP_SLEEP);
+    WatchyHost::consumeButtons(wakeAt);
+  }
+
+  uint64_t total = WatchyHost::now();
+  printf("boots %u  virtual %.1f s%s\n", boots, total / 1e6,
+         timedOut ? "  (ended while awake)" : "");
+  printf("active %.3f s  light sleep %.3f s  deep sleep %.3f s\n",
+         WatchyHost::timeIn[HOST_ACTIVE] / 1e6,
+         WatchyHost::timeIn[HOST_LIGHT_SLEEP] / 1e6,
+         WatchyHost::timeIn[HOST_DEEP_SLEEP] / 1e6);
+  printf("panel: %u full, %u partial refreshes, %llu SPI bytes\n",
+         HostPanel.fullRefreshes, HostPanel.partialRefreshes,
+         (unsigned long long)HostPanel.bytesWritten);
+  printf("ghosting: at most %u pixels flipped between full refreshes\n",
+         HostPanel.maxGhostPixels);
+  if (!toRefreshUs.empty()) {
+    // medians, the first boot's setup would swamp a mean
+    size_t mid = toRefreshUs.size() / 2;
+    std::nth_element(toRefreshUs.begin(), toRefreshUs.begin() + mid,
+                     toRefreshUs.end());
+    std::nth_element(toRefreshSpiNs.begin(), toRefreshSpiNs.begin() + mid,
+                     toRefreshSpiNs.end());
+    printf("to refresh: p50 %.1f ms from wake, p50 %.2f ms on SPI, %zu "
+           "wakes\n",
+           toRefreshUs[mid] / 1e3, toRefreshSpiNs[mid] / 1e6,
+           toRefreshUs.size());
+  }
+  if (!lateUs.empty()) {
+    size_t mid = lateUs.size() / 2;
+    std::nth_element(lateUs.begin(), lateUs.begin() + mid, lateUs.end());
+    printf("ticks: refresh p50 %.1f ms after the minute, %zu wakes\n",
+           lateUs[mid] / 1e3, lateUs.size());
+  }
+  printf("refresh times: full %.1f ms, partial %.1f ms, fast %.1f ms (last "
+         "waited for, 0: none)\n",
+         Watchy::display.refreshTime(WatchyDisplay::REFRESH_FULL) / 1e3,
+         Watchy::display.refreshTime(WatchyDisplay::REFRESH_PARTIAL) / 1e3,
+         Watchy::display.refreshTime(WatchyDisplay::REFRESH_FAST) / 1e3);
+  printf("i2c: %u transactions\n", Wire.transactions());
+  if (wakes > 0) {
+    // deep sleep and the awake time of an unfinished last boot are charged
+    // at the sleep and active currents
+    double days = total / 86400e6;
+    double mah  = wakeMah +
+                 energy.sleepMah(WatchyHost::timeIn[HOST_DEEP_SLEEP] / 1e6) +
+                 (timedOut ? (total - WatchyHost::bootUs) / 3600e6 *
+                                 energy.model.activeMa
+                           : 0);
+    printf("per wake: %.1f ms awake, %.2f uAh\n", awakeUs / 1e3 / wakes,
+           wakeMah * 1e3 / wakes);
+    printf("energy: %.3f mAh, %.3f mAh/day, %.1f days per charge\n", mah,
+           mah / days, energy.daysPerCharge(mah / days));
+  }
+  if (opt.pbm) {
+    _writePbm(opt.pbm);
+  }
+
+  return 0;
+}
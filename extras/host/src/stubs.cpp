@@ -0,0 +1,78 @@
+// Radio stacks: there is no WiFi or BLE on the host, every connection
+// attempt fails after its modelled timeout so the firmware takes the same
+// offline paths as a watch without credentials. The runner's --wifi joins
+// an access point instead, and prints each HTTP request made through it.
+
+#include <Arduino_JSON.h>
+#include <HTTPClient.h>
+#include <TimeLib.h>
+#include <WiFi.h>
+#include <WiFiManager.h>
+
+#include "BLE.h"
+#include "HostRTC.h"
+#include "WatchyHost.h"
+
+// association and DHCP with an access point in range
+#define HOST_WIFI_CONNECT_MS 1500
+
+WiFiClass WiFi;
+JSONClass JSON;
+
+wl_status_t WiFiClass::begin() {
+  _mode = WIFI_STA;
+  // no stored credentials, unless --wifi
+  return WatchyHost::wifi ? WL_DISCONNECTED : WL_CONNECT_FAILED;
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase) {
+  (void)ssid;
+  (void)passphrase;
+  _mode = WIFI_STA;
+  return WL_DISCONNECTED;
+}
+
+uint8_t WiFiClass::waitForConnectResult(unsigned long timeoutLength) {
+  if (WatchyHost::wifi) {
+    delay(HOST_WIFI_CONNECT_MS);
+    return WL_CONNECTED;
+  }
+  delay(timeoutLength);
+  return WL_CONNECT_FAILED;
+}
+
+bool WiFiClass::mode(wifi_mode_t m) {
+  _mode = m;
+  return true;
+}
+
+bool WiFiManager::autoConnect(const char *apName, const char *apPassword) {
+  (void)apName;
+  (void)apPassword;
+  WiFi.mode(WIFI_AP);
+  if (_apCallback) {
+    _apCallback(this);
+  }
+  delay(_timeout * 1000); // portal times out without a client
+  return false;
+}
+
+bool HTTPClient::begin(const char *url) {
+  tmElements_t tm;
+  breakTime(HostRTC.now(), tm);
+  printf("%02d:%02d:%02d GET %s\n", tm.Hour, tm.Minute, tm.Second, url);
+  return true;
+}
+
+BLE::BLE(void) {}
+
+BLE::~BLE(void) {}
+
+bool BLE::begin(const char *localName) {
+  local_name = localName;
+  return false;
+}
+
+int BLE::updateStatus() { return 4; } // disconnected
+
+int BLE::howManyBytes() { return 0; }
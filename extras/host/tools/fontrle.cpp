@@ -0,0 +1,192 @@
+// Subsets an Adafruit GFX font to the characters a face needs and
+// run-length encodes their glyphs for WatchyDisplay::setFont(const runFont *),
+// printing the result as a header. The font is chosen at build time as for
+// fontsprites, the characters are the argument ("a-b" is a range, a '-' at
+// either end is itself):
+//
+//   make fontrle FONT=DSEG7_Classic_Bold_53 FONT_DIR=../../src
+//   ./build/fontrle 0-9: DSEG7_Classic_Bold_53_digits \
+//     > ../../src/DSEG7_Classic_Bold_53_runs.h
+//
+// FONT_HEADER names the font's header if it is not FONT.h. The output
+// defines the font under its GFX name, so a face includes it instead of the
+// GFX header and keeps its setFont() calls, or under the optional second
+// argument where both are to be includable side by side. Characters left out
+// keep their advance and draw nothing.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define PROGMEM
+#include <gfxfont.h>
+
+#ifndef FONT_HEADER
+#define FONT_HEADER FONT
+#endif
+#define STR(x)  #x
+#define XSTR(x) STR(x)
+#include XSTR(FONT_HEADER.h)
+
+#define BYTES_PER_LINE 12
+#define MAX_RUN        15
+
+static const GFXfont &font = FONT;
+
+static void printChar(uint8_t c) {
+  if (c == '\'' || c == '\\') {
+    printf("'\\%c'", c);
+  } else {
+    printf("'%c'", c);
+  }
+}
+
+// GFX bitmaps are one bit stream per glyph, rows are not byte-aligned
+static bool ink(const GFXglyph &glyph, uint32_t bit) {
+  return font.bitmap[glyph.bitmapOffset + bit / 8] & (0x80 >> (bit % 8));
+}
+
+// A run of equal rows at a time: a byte with the number of pair bytes that
+// follow in the high nibble and the rows less one in the low nibble, then
+// the row's pairs of background and ink runs from its left edge. The
+// background after the last ink is not stored.
+static bool encodeGlyph(const GFXglyph &glyph, std::vector<uint8_t> &out) {
+  int w = glyph.width, h = glyph.height;
+  for (int y = 0; y < h;) {
+    int rows = 1;
+    while (y + rows < h && rows < MAX_RUN + 1) {
+      bool same = true;
+      for (int x = 0; same && x < w; x++) {
+        same = ink(glyph, y * w + x) == ink(glyph, (y + rows) * w + x);
+      }
+      if (!same) {
+        break;
+      }
+      rows++;
+    }
+    std::vector<uint8_t> pairs;
+    for (int x = 0; x < w;) {
+      int clear = 0, set = 0;
+      while (x + clear < w && !ink(glyph, y * w + x + clear)) {
+        clear++;
+      }
+      if (x + clear == w) {
+        break;
+      }
+      while (x + clear + set < w && ink(glyph, y * w + x + clear + set)) {
+        set++;
+      }
+      x += clear + set;
+      for (; clear > MAX_RUN; clear -= MAX_RUN) {
+        pairs.push_back(MAX_RUN << 4);
+      }
+      for (; set > MAX_RUN; set -= MAX_RUN, clear = 0) {
+        pairs.push_back(clear << 4 | MAX_RUN);
+      }
+      pairs.push_back(clear << 4 | set);
+    }
+    if (pairs.size() > MAX_RUN) {
+      return false;
+    }
+    out.push_back(pairs.size() << 4 | (rows - 1));
+    out.insert(out.end(), pairs.begin(), pairs.end());
+    y += rows;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 2 && argc != 3) {
+    fprintf(stderr, "usage: fontrle CHARACTERS [NAME]\n");
+    return 2;
+  }
+  bool keep[256] = {false};
+  const char *set = argv[1];
+  size_t length   = strlen(set);
+  for (size_t i = 0; i < length; i++) {
+    uint8_t from = set[i], to = set[i];
+    if (i + 2 < length && set[i + 1] == '-') {
+      to = set[i + 2];
+      i += 2;
+    }
+    for (unsigned c = from; c <= to; c++) {
+      keep[c] = true;
+    }
+  }
+  unsigned first = 256, last = 0;
+  for (unsigned c = font.first; c <= font.last; c++) {
+    if (keep[c]) {
+      first = c < first ? c : first;
+      last  = c;
+    }
+  }
+  if (first > last) {
+    fprintf(stderr, "no characters of %u..%u\n", font.first, font.last);
+    return 1;
+  }
+  const char *gfxName   = XSTR(FONT);
+  const char *name      = argc == 3 ? argv[2] : gfxName;
+
+  printf("#ifndef %s_RUNS_H\n#define %s_RUNS_H\n\n", name, name);
+  printf("// %s subset to \"%s\", glyphs run-length encoded\n"
+         "// for WatchyDisplay::setFont(const runFont *), generated by\n"
+         "// extras/host/tools/fontrle. Include it instead of %s.h",
+         gfxName, set, gfxName);
+  if (name != gfxName) {
+    printf(",\n// or next to it: this subset is %s.\n\n", name);
+  } else {
+    printf(".\n\n");
+  }
+
+  std::vector<GFXglyph> glyphs;
+  uint32_t size = 0, original = 0;
+  printf("const uint8_t %sRuns[] PROGMEM = {\n", name);
+  for (unsigned c = first; c <= last; c++) {
+    GFXglyph glyph = font.glyph[c - font.first];
+    if (!keep[c] || glyph.width == 0 || glyph.height == 0) {
+      glyph.bitmapOffset = 0;
+      glyph.width = glyph.height = 0;
+      glyphs.push_back(glyph);
+      continue;
+    }
+    original += (glyph.width * glyph.height + 7) / 8;
+    std::vector<uint8_t> runs;
+    if (!encodeGlyph(glyph, runs)) {
+      fprintf(stderr, "a row of '%c' has more than %d runs\n", c, MAX_RUN);
+      return 1;
+    }
+    glyph.bitmapOffset = size;
+    glyphs.push_back(glyph);
+    for (size_t i = 0; i < runs.size(); i++) {
+      printf("%s0x%02X,", i % BYTES_PER_LINE == 0 ? "    " : " ", runs[i]);
+      if (i % BYTES_PER_LINE == BYTES_PER_LINE - 1 || i + 1 == runs.size()) {
+        printf("\n");
+      }
+    }
+    printf("    // ");
+    printChar(c);
+    printf("\n");
+    size += runs.size();
+  }
+  printf("};\n\n");
+
+  printf("const GFXglyph %sRunGlyphs[] PROGMEM = {\n", name);
+  for (unsigned c = first; c <= last; c++) {
+    const GFXglyph &g = glyphs[c - first];
+    printf("    {%u, %u, %u, %u, %d, %d}, // ", g.bitmapOffset, g.width,
+           g.height, g.xAdvance, g.xOffset, g.yOffset);
+    printChar(c);
+    printf("\n");
+  }
+  printf("};\n\n");
+
+  printf("const runFont %s PROGMEM = {{(uint8_t *)%sRuns,\n"
+         "    (GFXglyph *)%sRunGlyphs, 0x%02X, 0x%02X, %u}};\n\n",
+         name, name, name, first, last, font.yAdvance);
+  printf("#endif\n");
+  fprintf(stderr, "%s: %u bytes of glyph bitmaps packed into %u\n", name,
+          original, size);
+  return 0;
+}
@@ -0,0 +1,101 @@
+// Pre-rasterises glyphs of an Adafruit GFX font into the byte-aligned sprites
+// of WatchyDisplay::addFontSprites() and prints them as a header. The font is
+// chosen at build time, FONT is its name and FONT_DIR holds FONT.h:
+//
+//   make fontsprites FONT=DSEG7_Classic_Bold_53 FONT_DIR=../../src
+//   ./build/fontsprites 0 : > DSEG7_Classic_Bold_53_sprites.h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#include <gfxfont.h>
+
+#define STR(x)  #x
+#define XSTR(x) STR(x)
+#include XSTR(FONT.h)
+
+#define BYTES_PER_LINE 12
+
+static const GFXfont &font = FONT;
+
+static void printChar(uint8_t c) {
+  if (c == '\'' || c == '\\') {
+    printf("'\\%c'", c);
+  } else {
+    printf("'%c'", c);
+  }
+}
+
+int main(int argc, char **argv) {
+  uint8_t first = argc > 1 ? argv[1][0] : '0';
+  uint8_t last  = argc > 2 ? argv[2][0] : ':';
+  if (first < font.first || last > font.last || first > last) {
+    fprintf(stderr, "characters out of range %u..%u\n", font.first,
+            font.last);
+    return 1;
+  }
+  const char *name = XSTR(FONT);
+
+  printf("#ifndef %s_SPRITES_H\n#define %s_SPRITES_H\n\n", name, name);
+  printf("// Byte-aligned sprites of %s ", name);
+  printChar(first);
+  printf("..");
+  printChar(last);
+  printf(" for\n// WatchyDisplay::addFontSprites(), generated by "
+         "extras/host/tools/fontsprites.\n// Include %s.h first.\n\n",
+         name);
+
+  uint16_t offsets[256];
+  uint16_t size = 0;
+  printf("const uint8_t %sSpriteBitmaps[] PROGMEM = {\n", name);
+  for (unsigned c = first; c <= last; c++) {
+    const GFXglyph &glyph = font.glyph[c - font.first];
+    uint8_t rowBytes      = (glyph.width + 7) / 8;
+    offsets[c - first]    = size;
+    // GFX bitmaps are one bit stream per glyph, rows are not byte-aligned
+    uint32_t bit = 0;
+    int column   = 0;
+    for (int y = 0; y < glyph.height; y++) {
+      for (int b = 0; b < rowBytes; b++) {
+        uint8_t out = 0;
+        for (int x = b * 8; x < b * 8 + 8 && x < glyph.width; x++, bit++) {
+          uint8_t in = font.bitmap[glyph.bitmapOffset + bit / 8];
+          if (in & (0x80 >> (bit % 8))) {
+            out |= 0x80 >> (x % 8);
+          }
+        }
+        printf("%s0x%02X,", column == 0 ? "    " : " ", out);
+        if (++column == BYTES_PER_LINE) {
+          printf("\n");
+          column = 0;
+        }
+        size++;
+      }
+    }
+    if (column != 0) {
+      printf("\n");
+    }
+    printf("    // ");
+    printChar(c);
+    printf("\n");
+  }
+  printf("};\n\n");
+
+  printf("const uint16_t %sSpriteOffsets[] PROGMEM = {", name);
+  for (unsigned c = first; c <= last; c++) {
+    printf("%s%u,", (c - first) % BYTES_PER_LINE == 0 ? "\n    " : " ",
+           offsets[c - first]);
+  }
+  printf("\n};\n\n");
+
+  printf("const fontSprites %sSprites = {\n    &%s, ", name, name);
+  printChar(first);
+  printf(", ");
+  printChar(last);
+  printf(", %sSpriteBitmaps,\n    %sSpriteOffsets};\n\n", name, name);
+  printf("#endif\n");
+  return 0;
+}
@@ -0,0 +1,163 @@
+// Pre-rasterises a watch hand into the sprites of WatchyDisplay::drawHand()
+// and prints them as PROGMEM arrays. The hand is a convex polygon, symmetric
+// about its axis, pointing to 12 o'clock from the pivot at 0,0: y grows
+// downwards, the tip has a negative y.
+//
+//   ./build/handsprites minuteHand 60 0,16 -4,0 0,-86 4,0 >> hands.h
+//
+// A pixel is inked when its centre lies inside the rotated polygon, the
+// pivot being a pixel centre.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define BYTES_PER_LINE 12
+
+typedef struct point {
+  double x, y;
+} point;
+
+static bool convex(const std::vector<point> &p) {
+  int sign = 0;
+  for (size_t i = 0; i < p.size(); i++) {
+    const point &a = p[i], &b = p[(i + 1) % p.size()],
+                &c = p[(i + 2) % p.size()];
+    double cross = (b.x - a.x) * (c.y - b.y) - (b.y - a.y) * (c.x - b.x);
+    int s        = cross > 0 ? 1 : cross < 0 ? -1 : 0;
+    if (s != 0 && sign != 0 && s != sign) {
+      return false;
+    }
+    sign = s != 0 ? s : sign;
+  }
+  return sign != 0;
+}
+
+static bool symmetric(const std::vector<point> &p) {
+  for (const point &a : p) {
+    bool found = false;
+    for (const point &b : p) {
+      found = found || (b.x == -a.x && b.y == a.y);
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The sprite of the hand turned clockwise by angle (radians): first row,
+// row count, then left end and width per row. Returns false if it does not
+// fit the format.
+static bool rasterise(const std::vector<point> &hand, double angle,
+                      std::vector<uint8_t> &out) {
+  std::vector<point> p;
+  double c = cos(angle), s = sin(angle);
+  double top = 1e9, bottom = -1e9;
+  for (const point &v : hand) {
+    point r = {v.x * c - v.y * s, v.x * s + v.y * c};
+    p.push_back(r);
+    top    = fmin(top, r.y);
+    bottom = fmax(bottom, r.y);
+  }
+  const double eps = 1e-9;
+  int y0 = (int)ceil(top - eps), y1 = (int)floor(bottom + eps);
+  if (y0 < -128 || y1 > 127 || y1 - y0 + 1 > 255) {
+    return false;
+  }
+  out.push_back((uint8_t)(int8_t)y0);
+  out.push_back(y1 - y0 + 1);
+  for (int y = y0; y <= y1; y++) {
+    double left = 1e9, right = -1e9;
+    for (size_t i = 0; i < p.size(); i++) {
+      const point &a = p[i], &b = p[(i + 1) % p.size()];
+      if (y < fmin(a.y, b.y) - eps || y > fmax(a.y, b.y) + eps) {
+        continue;
+      }
+      if (fabs(b.y - a.y) < eps) { // along the row
+        left  = fmin(left, fmin(a.x, b.x));
+        right = fmax(right, fmax(a.x, b.x));
+        continue;
+      }
+      double x = a.x + (b.x - a.x) * (y - a.y) / (b.y - a.y);
+      left     = fmin(left, x);
+      right    = fmax(right, x);
+    }
+    int x0 = (int)ceil(left - eps), x1 = (int)floor(right + eps);
+    if (x1 < x0) {
+      out.push_back(0);
+      out.push_back(0);
+      continue;
+    }
+    if (x0 < -128 || x1 > 127) {
+      return false;
+    }
+    out.push_back((uint8_t)(int8_t)x0);
+    out.push_back(x1 - x0 + 1);
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 6) {
+    fprintf(stderr, "usage: %s NAME STEPS X,Y X,Y X,Y...\n", argv[0]);
+    return 1;
+  }
+  const char *name = argv[1];
+  int steps        = atoi(argv[2]);
+  if (steps <= 0 || steps % 4 != 0) {
+    fprintf(stderr, "STEPS is to be a multiple of 4\n");
+    return 1;
+  }
+  std::vector<point> hand;
+  for (int i = 3; i < argc; i++) {
+    point v;
+    if (sscanf(argv[i], "%lf,%lf", &v.x, &v.y) != 2) {
+      fprintf(stderr, "bad point %s\n", argv[i]);
+      return 1;
+    }
+    hand.push_back(v);
+  }
+  if (!convex(hand) || !symmetric(hand)) {
+    fprintf(stderr, "the hand is to be convex and symmetric about x = 0\n");
+    return 1;
+  }
+
+  std::vector<uint8_t> spans;
+  std::vector<uint16_t> offsets;
+  for (int position = 0; position <= steps / 4; position++) {
+    offsets.push_back(spans.size());
+    if (!rasterise(hand, 2 * M_PI * position / steps, spans)) {
+      fprintf(stderr, "the hand reaches beyond 127 pixels\n");
+      return 1;
+    }
+  }
+
+  printf("// %s: %d positions a turn, %zu sprites for the first quarter in "
+         "%zu bytes.\n// Generated by extras/host/tools/handsprites from",
+         name, steps, offsets.size(), spans.size() + 2 * offsets.size());
+  for (int i = 3; i < argc; i++) {
+    printf(" %s", argv[i]);
+  }
+  printf("\n");
+  printf("const uint8_t %sSpans[] PROGMEM = {\n", name);
+  for (size_t p = 0; p < offsets.size(); p++) {
+    size_t end = p + 1 < offsets.size() ? offsets[p + 1] : spans.size();
+    for (size_t i = offsets[p]; i < end; i++) {
+      int column = (i - offsets[p]) % BYTES_PER_LINE;
+      printf("%s0x%02X,%s", column == 0 ? "    " : " ", spans[i],
+             column == BYTES_PER_LINE - 1 || i + 1 == end ? "\n" : "");
+    }
+  }
+  printf("};\n\n");
+  printf("const uint16_t %sOffsets[] PROGMEM = {", name);
+  for (size_t p = 0; p < offsets.size(); p++) {
+    printf("%s%u,", p % BYTES_PER_LINE == 0 ? "\n    " : " ", offsets[p]);
+  }
+  printf("\n};\n\n");
+  printf("const handSprites %s = {%d, %sSpans, %sOffsets};\n", name, steps,
+         name, name);
+  return 0;
+}
@@ -0,0 +1,225 @@
+// Converts 1bpp images into the packed format of
+// WatchyDisplay::drawPackedBitmap(), as PROGMEM arrays on stdout.
+//
+//   ./build/packbitmap tetris.h tetrisbg > packed.h
+//   ./build/packbitmap -i ../battery.bmp
+//
+// A C header (image2cpp output, as in the example faces) is copied with the
+// named arrays packed, all of them if none are named. The size comes from
+// the "// 'name', WxHpx" line above an array, arrays without one must be
+// full-screen. A .bmp (uncompressed, any bit depth) or binary .pbm becomes
+// one array, named after the file unless a name is given. Dark pixels are
+// the set bits, -i sets the light ones (the icons in extras/ are white on
+// black).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "packbitmap.h"
+
+#define SCREEN_SIZE 200
+
+static bool readFile(const char *path, std::string &data) {
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    return false;
+  }
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    data.append(buf, n);
+  }
+  fclose(f);
+  return true;
+}
+
+static void printArray(const std::string &name, const std::string &label,
+                       int w, int h, const std::vector<uint8_t> &packed) {
+  printf("// '%s', %dx%dpx, packed %d -> %zu bytes\n", label.c_str(), w, h,
+         (w + 7) / 8 * h, packed.size());
+  printf("const unsigned char %s [] PROGMEM = {", name.c_str());
+  for (size_t i = 0; i < packed.size(); i++) {
+    printf("%s0x%02x%s", i % 16 == 0 ? "\n\t" : "", packed[i],
+           i + 1 < packed.size() ? ", " : "\n");
+  }
+  printf("};\n");
+}
+
+static bool wanted(const std::string &name, int argc, char **argv) {
+  if (argc <= 2) {
+    return true;
+  }
+  for (int i = 2; i < argc; i++) {
+    if (name == argv[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static int convertHeader(const std::string &text, int argc, char **argv) {
+  const std::string decl = "const unsigned char ";
+  size_t at = 0;
+  while (true) {
+    size_t start = text.find(decl, at);
+    if (start == std::string::npos) {
+      fputs(text.c_str() + at, stdout);
+      return 0;
+    }
+    size_t nameEnd = text.find_first_of(" [", start + decl.size());
+    size_t open    = text.find('{', start);
+    size_t close   = text.find("};", open);
+    if (nameEnd == std::string::npos || open == std::string::npos ||
+        close == std::string::npos) {
+      fprintf(stderr, "can't parse the array at offset %zu\n", start);
+      return 1;
+    }
+    std::string name = text.substr(start + decl.size(),
+                                   nameEnd - start - decl.size());
+    if (!wanted(name, argc, argv)) {
+      fwrite(text.data() + at, 1, close + 2 - at, stdout);
+      at = close + 2;
+      continue;
+    }
+    std::vector<uint8_t> bits;
+    for (const char *p = text.c_str() + open; p < text.c_str() + close; p++) {
+      if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        bits.push_back(strtoul(p, (char **)&p, 16));
+      }
+    }
+    // "// 'label', WxHpx" on the line before
+    size_t comment    = text.rfind("// '", start);
+    std::string label = name;
+    int w = SCREEN_SIZE, h = SCREEN_SIZE;
+    size_t end = start; // text before the array that is copied
+    if (comment != std::string::npos && comment >= at &&
+        text.find('\n', comment) + 1 == start) {
+      size_t q = text.find('\'', comment + 4);
+      label    = text.substr(comment + 4, q - comment - 4);
+      if (sscanf(text.c_str() + q + 1, ", %dx%dpx", &w, &h) != 2) {
+        fprintf(stderr, "%s: no size\n", name.c_str());
+        return 1;
+      }
+      end = comment;
+    }
+    if ((int)bits.size() != (w + 7) / 8 * h) {
+      fprintf(stderr, "%s: %zu bytes for %dx%d\n", name.c_str(), bits.size(),
+              w, h);
+      return 1;
+    }
+    fwrite(text.data() + at, 1, end - at, stdout);
+    printArray(name, label, w, h, packBitmap(bits.data(), w, h));
+    at = close + 2;
+    if (at < text.size() && text[at] == '\n') {
+      at++;
+    }
+  }
+}
+
+static uint32_t le(const std::string &d, size_t at, int bytes) {
+  uint32_t v = 0;
+  for (int i = bytes - 1; i >= 0; i--) {
+    v = v << 8 | (uint8_t)d[at + i];
+  }
+  return v;
+}
+
+static bool readBmp(const std::string &d, bool invert, int &w, int &h,
+                    std::vector<uint8_t> &bits) {
+  if (d.size() < 54 || d[0] != 'B' || d[1] != 'M' || le(d, 30, 4) != 0) {
+    return false;
+  }
+  uint32_t offset = le(d, 10, 4), infoSize = le(d, 14, 4);
+  w               = (int32_t)le(d, 18, 4);
+  int32_t rows    = (int32_t)le(d, 22, 4);
+  int bpp         = le(d, 28, 2);
+  h               = abs(rows);
+  size_t stride   = ((size_t)w * bpp + 31) / 32 * 4;
+  if (offset + stride * h > d.size() || bpp > 32) {
+    return false;
+  }
+  bits.assign((w + 7) / 8 * h, 0);
+  for (int y = 0; y < h; y++) {
+    size_t row = offset + stride * (rows > 0 ? h - 1 - y : y);
+    for (int x = 0; x < w; x++) {
+      uint8_t r, g, b;
+      if (bpp <= 8) {
+        uint8_t byte = d[row + x * bpp / 8];
+        int index    = (byte >> (8 - bpp - x * bpp % 8)) & ((1 << bpp) - 1);
+        size_t entry = 14 + infoSize + 4 * index;
+        b = d[entry], g = d[entry + 1], r = d[entry + 2];
+      } else {
+        size_t p = row + x * bpp / 8;
+        b = d[p], g = d[p + 1], r = d[p + 2];
+      }
+      if ((r * 299 + g * 587 + b * 114 < 128000) != invert) {
+        bits[y * ((w + 7) / 8) + x / 8] |= 0x80 >> (x % 8);
+      }
+    }
+  }
+  return true;
+}
+
+static bool readPbm(const std::string &d, bool invert, int &w, int &h,
+                    std::vector<uint8_t> &bits) {
+  char magic[3];
+  int n = 0;
+  if (sscanf(d.c_str(), "%2s %d %d%n", magic, &w, &h, &n) != 3 ||
+      strcmp(magic, "P4") != 0) {
+    return false;
+  }
+  size_t size = (w + 7) / 8 * h;
+  if (n + 1 + size > d.size()) {
+    return false;
+  }
+  bits.assign(d.begin() + n + 1, d.begin() + n + 1 + size);
+  for (uint8_t &b : bits) {
+    b = invert ? ~b : b;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  bool invert = argc > 1 && strcmp(argv[1], "-i") == 0;
+  if (invert) {
+    argc--;
+    argv++;
+  }
+  if (argc < 2) {
+    fprintf(stderr,
+            "usage: packbitmap FILE.h [NAME...] | [-i] FILE.bmp|FILE.pbm "
+            "[NAME]\n");
+    return 2;
+  }
+  std::string path = argv[1], data;
+  if (!readFile(argv[1], data)) {
+    perror(argv[1]);
+    return 1;
+  }
+  size_t dot         = path.rfind('.');
+  std::string suffix = dot == std::string::npos ? "" : path.substr(dot + 1);
+  if (suffix == "h") {
+    return convertHeader(data, argc, argv);
+  }
+
+  int w, h;
+  std::vector<uint8_t> bits;
+  if (!(suffix == "bmp" ? readBmp(data, invert, w, h, bits)
+                        : readPbm(data, invert, w, h, bits))) {
+    fprintf(stderr, "%s: not an uncompressed BMP or a P4 PBM\n", argv[1]);
+    return 1;
+  }
+  if (w > SCREEN_SIZE) {
+    fprintf(stderr, "%s: wider than the display\n", argv[1]);
+    return 1;
+  }
+  size_t slash     = path.rfind('/');
+  std::string name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  name             = name.substr(0, name.rfind('.'));
+  printArray(argc > 2 ? argv[2] : name, name, w, h,
+             packBitmap(bits.data(), w, h));
+  return 0;
+}
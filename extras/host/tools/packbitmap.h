@@ -0,0 +1,60 @@
+// Encoder for WatchyDisplay::drawPackedBitmap(), shared by packbitmap and
+// rasterbench. Greedy LZ77: at each byte the longest match in the last
+// WatchyDisplay::PACKED_WINDOW bytes (the nearest of equal length) is taken
+// if it is at least 3 bytes, anything else goes into literal runs.
+
+#ifndef PACKBITMAP_H
+#define PACKBITMAP_H
+
+#include <stdint.h>
+#include <vector>
+
+#define PACKED_WINDOW  1024
+#define PACKED_MIN_RUN 3
+#define PACKED_MAX_RUN 34
+#define PACKED_MAX_LIT 128
+
+// bits: (w + 7) / 8 bytes per row, MSB leftmost
+static std::vector<uint8_t> packBitmap(const uint8_t *bits, int w, int h) {
+  int size = (w + 7) / 8 * h;
+  std::vector<uint8_t> out = {(uint8_t)w, (uint8_t)(w >> 8), (uint8_t)h,
+                              (uint8_t)(h >> 8)};
+  std::vector<uint8_t> literals;
+  auto flush = [&]() {
+    if (!literals.empty()) {
+      out.push_back(literals.size() - 1);
+      out.insert(out.end(), literals.begin(), literals.end());
+      literals.clear();
+    }
+  };
+  for (int i = 0; i < size;) {
+    int best = 0, bestDistance = 0;
+    for (int d = 1; d <= PACKED_WINDOW && d <= i; d++) {
+      int n = 0;
+      while (n < PACKED_MAX_RUN && i + n < size &&
+             bits[i + n] == bits[i + n - d]) {
+        n++;
+      }
+      if (n > best) {
+        best         = n;
+        bestDistance = d;
+      }
+    }
+    if (best >= PACKED_MIN_RUN) {
+      flush();
+      int d = bestDistance - 1;
+      out.push_back(0x80 | (best - PACKED_MIN_RUN) << 2 | d >> 8);
+      out.push_back(d & 0xFF);
+      i += best;
+    } else {
+      literals.push_back(bits[i++]);
+      if (literals.size() == PACKED_MAX_LIT) {
+        flush();
+      }
+    }
+  }
+  flush();
+  return out;
+}
+
+#endif
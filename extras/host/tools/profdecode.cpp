@@ -0,0 +1,130 @@
+// Decoder for WatchyProfiler::dump() output. Reads a serial capture (or the
+// stderr of a host run with --profile) and prints per-phase statistics and
+// log2 histograms of the phase durations. Lines that are not profiler
+// records are ignored.
+//
+//   ./build/7_SEG --minutes 60 --profile 2>&1 >/dev/null | ./build/profdecode
+
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#define HIST_BUCKETS 24 // 1 us .. 8 s
+#define HIST_WIDTH   40
+
+static const char *causeName(int cause) {
+  switch (cause) {
+  case 2:
+    return "rtc";
+  case 3:
+    return "button";
+  case 4:
+    return "timer";
+  case 7:
+    return "gpio";
+  default:
+    return "reset";
+  }
+}
+
+static uint32_t percentile(const std::vector<uint32_t> &sorted, double p) {
+  size_t i = (size_t)(p * (sorted.size() - 1) + 0.5);
+  return sorted[i];
+}
+
+static void printSeries(const char *name, std::vector<uint32_t> values) {
+  if (values.empty()) {
+    return;
+  }
+  std::sort(values.begin(), values.end());
+  double sum = 0;
+  unsigned hist[HIST_BUCKETS] = {};
+  for (uint32_t v : values) {
+    sum += v;
+    int b = 0;
+    while (b < HIST_BUCKETS - 1 && (1u << (b + 1)) <= v) {
+      b++;
+    }
+    hist[b]++;
+  }
+  printf("%-13s n=%-5zu mean %10.1f  p50 %9u  p90 %9u  max %9u us\n", name,
+         values.size(), sum / values.size(), percentile(values, 0.5),
+         percentile(values, 0.9), values.back());
+  unsigned peak = *std::max_element(hist, hist + HIST_BUCKETS);
+  for (int b = 0; b < HIST_BUCKETS; b++) {
+    if (hist[b] == 0) {
+      continue;
+    }
+    int bar = (int)((hist[b] * (uint64_t)HIST_WIDTH + peak - 1) / peak);
+    printf("  %9u us |%-*.*s %u\n", 1u << b, HIST_WIDTH, bar,
+           "########################################", hist[b]);
+  }
+}
+
+int main(int argc, char **argv) {
+  FILE *in = stdin;
+  if (argc > 1 && (in = fopen(argv[1], "r")) == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  std::vector<std::string> phases;
+  std::vector<std::vector<uint32_t>> samples;
+  std::vector<uint32_t> awake;
+  std::vector<std::vector<uint32_t>> awakeByCause(8);
+  unsigned long fullRefreshes = 0, partialRefreshes = 0;
+  char line[512];
+  while (fgets(line, sizeof(line), in)) {
+    line[strcspn(line, "\r\n")] = 0;
+    if (line[0] == 'P' && line[1] == ',') {
+      std::vector<std::string> names;
+      for (char *t = strtok(line + 2, ","); t; t = strtok(NULL, ",")) {
+        names.push_back(t);
+      }
+      if (phases.empty()) {
+        phases = names;
+        samples.resize(phases.size());
+      }
+    } else if (line[0] == 'W' && line[1] == ',' && !phases.empty()) {
+      std::vector<uint32_t> fields;
+      for (char *t = strtok(line + 2, ","); t; t = strtok(NULL, ",")) {
+        fields.push_back(strtoul(t, NULL, 10));
+      }
+      if (fields.size() != phases.size() + 4) {
+        continue; // truncated line
+      }
+      awake.push_back(fields[1]);
+      fullRefreshes += fields[2];
+      partialRefreshes += fields[3];
+      awakeByCause[fields[0] & 7].push_back(fields[1]);
+      for (size_t i = 0; i < phases.size(); i++) {
+        samples[i].push_back(fields[i + 4]);
+      }
+    }
+  }
+  if (awake.empty()) {
+    fprintf(stderr, "no profiler records found\n");
+    return 1;
+  }
+  printSeries("awake", awake);
+  for (size_t i = 0; i < phases.size(); i++) {
+    printSeries(phases[i].c_str(), samples[i]);
+  }
+  printf("\nrefreshes: %lu full, %lu partial\n", fullRefreshes,
+         partialRefreshes);
+  printf("awake time by wake cause\n");
+  for (int c = 0; c < 8; c++) {
+    if (awakeByCause[c].empty()) {
+      continue;
+    }
+    double sum = 0;
+    for (uint32_t v : awakeByCause[c]) {
+      sum += v;
+    }
+    printf("  %-7s n=%-5zu mean %10.1f us\n", causeName(c),
+           awakeByCause[c].size(), sum / awakeByCause[c].size());
+  }
+  return 0;
+}
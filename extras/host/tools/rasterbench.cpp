@@ -0,0 +1,421 @@
+// Micro-benchmarks of WatchyDisplay's raster primitives against Adafruit
+// GFX's per-pixel paths. Each case draws into a random frame, once through
+// a reference display that only implements drawPixel() (as every GFX
+// primitive ends there) and once through WatchyDisplay. Checks that the
+// frames are identical and prints the host time per call of each. Cases
+// that draw another way than Adafruit GFX (the hands) print how many
+// pixels differ instead.
+//
+//   ./build/rasterbench [calls / 200]
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "WatchyDisplay.h"
+
+#include "packbitmap.h"
+#include <Fonts/FreeMonoBold9pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+
+// the fonts of the text layouts below, as Adafruit GFX draws them and as
+// the faces include them, subset and run-length encoded
+namespace gfx {
+#include "../../../examples/WatchFaces/7_SEG/DSEG7_Classic_Regular_39.h"
+#include "../../../examples/WatchFaces/7_SEG/Seven_Segment10pt7b.h"
+#include "../../../examples/WatchFaces/StarryHorizon/MadeSunflower39pt7b.h"
+#include "DSEG7_Classic_Bold_53.h"
+} // namespace gfx
+#include "../../../examples/WatchFaces/7_SEG/DSEG7_Classic_Regular_39_runs.h"
+#include "../../../examples/WatchFaces/7_SEG/Seven_Segment10pt7b_runs.h"
+#include "../../../examples/WatchFaces/StarryHorizon/MadeSunflower39pt7b_runs.h"
+#include "DSEG7_Classic_Bold_53_runs.h"
+
+// the Analog face's hand sprites
+#include "../../../examples/WatchFaces/Analog/hands.h"
+
+// the packed full-screen backgrounds of the example faces
+#include "../../../examples/WatchFaces/MacPaint/macpaint.h"
+#include "../../../examples/WatchFaces/Pokemon/pokemon.h"
+#include "../../../examples/WatchFaces/Tetris/tetris.h"
+
+static const uint16_t W = WatchyDisplay::WIDTH, H = WatchyDisplay::HEIGHT;
+static const uint16_t SIZE = WatchyDisplay::BUFFER_SIZE;
+static const int ROUNDS    = 3; // timed per side and case, the best counts
+
+// WatchyDisplay's buffer and drawPixel() without the raster primitives
+class PixelDisplay : public Adafruit_GFX {
+public:
+  uint8_t buffer[SIZE];
+  PixelDisplay() : Adafruit_GFX(W, H) {}
+  uint8_t *getBuffer() { return buffer; }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) {
+      return;
+    }
+    switch (getRotation()) {
+    case 1:
+      std::swap(x, y);
+      x = W - x - 1;
+      break;
+    case 2:
+      x = W - x - 1;
+      y = H - y - 1;
+      break;
+    case 3:
+      std::swap(x, y);
+      y = H - y - 1;
+      break;
+    }
+    uint16_t i = x / 8 + y * WatchyDisplay::WIDTH_BYTES;
+    if (color == GxEPD_WHITE) {
+      buffer[i] |= 1 << (7 - x % 8);
+    } else {
+      buffer[i] &= ~(1 << (7 - x % 8));
+    }
+  }
+};
+
+static PixelDisplay gfxPath;
+static WatchyDisplay fastPath(GxEPD2_154_D67(DISPLAY_CS, DISPLAY_DC,
+                                             DISPLAY_RES, DISPLAY_BUSY));
+static uint8_t background[SIZE];
+static uint8_t image[SIZE];    // 200x200 random bitmap
+static uint8_t dithered[SIZE]; // 200x200 ordered dither of a pattern
+static std::vector<uint8_t> packedImage, packedDithered, packedSmall;
+// the face backgrounds, unpacked
+static uint8_t tetrisRaw[SIZE], pokemonRaw[SIZE], macpaintRaw[SIZE];
+
+// The clock of the default face and StarryHorizon's, in the GFX font and
+// in its run font
+static void printTime(Adafruit_GFX &d, int16_t x, int minutes) {
+  d.setTextColor(minutes & 1);
+  d.setCursor(x, 53 + 60);
+  d.printf("%02d:%02d", minutes / 60 % 24, minutes % 60);
+}
+
+static void timeBefore(PixelDisplay &d, int i) {
+  d.setFont(&gfx::DSEG7_Classic_Bold_53);
+  printTime(d, 5, i);
+}
+
+static void timeAfter(WatchyDisplay &d, int i) {
+  d.setFont(&DSEG7_Classic_Bold_53_digits);
+  printTime(d, 5, i);
+}
+
+static void sunflowerBefore(PixelDisplay &d, int i) {
+  d.setFont(&gfx::MADE_Sunflower_PERSONAL_USE39pt7b);
+  printTime(d, 12 + i % 8, i);
+}
+
+static void sunflowerAfter(WatchyDisplay &d, int i) {
+  d.setFont(&MADE_Sunflower_PERSONAL_USE39pt7b);
+  printTime(d, 12 + i % 8, i);
+}
+
+static const char *const days[]   = {"Sunday", "Monday", "Tuesday",
+                                     "Wednesday", "Thursday", "Friday",
+                                     "Saturday"};
+static const char *const months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                     "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+static const int8_t temperatures[] = {-7, 3, 12, 27};
+
+// The text of the example faces and the menu, as laid out with
+// getTextBounds() of a String and print(), against measureText() and
+// drawText(). 7_SEG's day and month, right aligned:
+static void dateBefore(PixelDisplay &d, int i) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  d.setFont(&gfx::Seven_Segment10pt7b);
+  d.setTextColor(i & 1);
+  String day = days[i % 7];
+  d.getTextBounds(day, 5, 85, &x1, &y1, &w, &h);
+  d.setCursor(85 - w, 85);
+  d.println(day);
+  String month = months[i % 12];
+  d.getTextBounds(month, 60, 110, &x1, &y1, &w, &h);
+  d.setCursor(85 - w, 110);
+  d.println(month);
+}
+
+static void dateAfter(WatchyDisplay &d, int i) {
+  d.setFont(&Seven_Segment10pt7b);
+  d.setTextColor(i & 1);
+  d.drawText(85, 85, days[i % 7], WatchyDisplay::ALIGN_RIGHT);
+  d.drawText(85, 110, months[i % 12], WatchyDisplay::ALIGN_RIGHT);
+}
+
+// 7_SEG's temperature, its ink ending at x = 159
+static void weatherBefore(PixelDisplay &d, int i) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  int8_t temperature = temperatures[i % 4];
+  d.setFont(&gfx::DSEG7_Classic_Regular_39);
+  d.setTextColor(i & 1);
+  d.getTextBounds(String(temperature), 0, 0, &x1, &y1, &w, &h);
+  d.setCursor(159 - w - x1, 150);
+  d.println(temperature);
+}
+
+static void weatherAfter(WatchyDisplay &d, int i) {
+  char degrees[5];
+  snprintf(degrees, sizeof(degrees), "%d", temperatures[i % 4]);
+  d.setFont(&DSEG7_Classic_Regular_39);
+  d.setTextColor(i & 1);
+  textBounds bounds = d.measureText(degrees);
+  d.drawText(159 - bounds.w - bounds.x, 150, degrees);
+}
+
+// StarryHorizon's date, centred. 84 dates in turn: none is found among
+// the TEXT_BOUNDS_CACHE layouts, each is measured again.
+static void centredBefore(PixelDisplay &d, int i) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  char date[16];
+  snprintf(date, sizeof(date), "%.3s %s %d", days[i % 7], months[i % 12],
+           i % 28 + 1);
+  d.setFont(&FreeSansBold9pt7b);
+  d.setTextColor(i & 1);
+  d.setTextWrap(false);
+  d.getTextBounds(String(date), 100, 140, &x1, &y1, &w, &h);
+  d.setCursor(100 - w / 2, 140);
+  d.print(String(date));
+  d.setTextWrap(true);
+}
+
+static void centredAfter(WatchyDisplay &d, int i) {
+  char date[16];
+  snprintf(date, sizeof(date), "%.3s %s %d", days[i % 7], months[i % 12],
+           i % 28 + 1);
+  d.setFont(&FreeSansBold9pt7b);
+  d.setTextColor(i & 1);
+  d.drawText(100, 140, date, WatchyDisplay::ALIGN_CENTER);
+}
+
+// one date a day, as on the watch: measured once
+static void dailyBefore(PixelDisplay &d, int i) { centredBefore(d, i / 1000); }
+
+static void dailyAfter(WatchyDisplay &d, int i) { centredAfter(d, i / 1000); }
+
+// a menu row, left aligned, is not measured either way
+static void menuBefore(PixelDisplay &d, int i) {
+  d.setFont(&FreeMonoBold9pt7b);
+  d.setTextColor(i & 1);
+  d.setCursor(0, 30 + i % 5 * 30);
+  d.print(months[i % 12]);
+}
+
+static void menuAfter(WatchyDisplay &d, int i) {
+  d.setFont(&FreeMonoBold9pt7b);
+  d.setTextColor(i & 1);
+  d.drawText(0, 30 + i % 5 * 30, months[i % 12]);
+}
+
+// measuring alone
+static void measureBefore(PixelDisplay &d, int i) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  d.setFont(&gfx::Seven_Segment10pt7b);
+  d.getTextBounds(String(days[i % 7]), 0, 0, &x1, &y1, &w, &h);
+}
+
+static void measureAfter(WatchyDisplay &d, int i) {
+  d.setFont(&Seven_Segment10pt7b);
+  d.measureText(days[i % 7]);
+}
+
+// The Analog face's hands as rotated polygons, double trig and two
+// triangles per kite as a face would draw them, against drawHand() of
+// their sprites. "hands triangles" has WatchyDisplay fill the triangles.
+template <class D>
+static void kite(D &d, double angle, double tail, double half,
+                 double tip, uint16_t color) {
+  double s = sin(angle), c = cos(angle);
+  int16_t tx = lround(100 - tail * s), ty = lround(100 + tail * c);
+  int16_t px = lround(100 + tip * s), py = lround(100 - tip * c);
+  int16_t lx = lround(100 - half * c), ly = lround(100 - half * s);
+  int16_t rx = lround(100 + half * c), ry = lround(100 + half * s);
+  d.fillTriangle(tx, ty, lx, ly, px, py, color);
+  d.fillTriangle(tx, ty, px, py, rx, ry, color);
+}
+
+template <class D> static void handsBefore(D &d, int i) {
+  kite(d, 2 * M_PI * (i * 7 % 720) / 720, 14, 5, 56, i & 1);
+  kite(d, 2 * M_PI * (i % 60) / 60, 16, 4, 86, i & 1);
+}
+
+static void handsAfter(WatchyDisplay &d, int i) {
+  d.drawHand(100, 100, &hourHand, i * 7 % 720, i & 1);
+  d.drawHand(100, 100, &minuteHand, i % 60, i & 1);
+}
+
+// Each case is compiled for both displays, so that calls bind to
+// WatchyDisplay's overloads: drawBitmap() is not virtual in Adafruit GFX
+#define CASE(name, body)                                                       \
+  {name, [](PixelDisplay &d, int i) { body; },                                 \
+   [](WatchyDisplay &d, int i) { body; }}
+// packed bitmaps against Adafruit GFX drawing the unpacked one
+#define PACKED(name, x, y, raw, w, h, packed)                                  \
+  {name, [](PixelDisplay &d, int i) { d.drawBitmap(x, y, raw, w, h, i & 1); }, \
+   [](WatchyDisplay &d, int i) { d.drawPackedBitmap(x, y, packed, i & 1); }}
+
+typedef struct benchCase {
+  const char *name;
+  void (*gfx)(PixelDisplay &d, int i);
+  void (*fast)(WatchyDisplay &d, int i);
+  bool exact = true; // the frames are to be identical
+} benchCase;
+
+static const benchCase cases[] = {
+    CASE("fillRect aligned", d.fillRect(8, 8 + i % 8, 64, 64, i & 1)),
+    CASE("fillRect unaligned", d.fillRect(3 + i % 8, 5, 61, 59, i & 1)),
+    CASE("fillRect battery", d.fillRect(159 + i % 3 * 9, 78, 7, 11, i & 1)),
+    CASE("hline full", d.drawFastHLine(0, i % H, W, i & 1)),
+    CASE("hline unaligned", d.drawFastHLine(3 + i % 8, i % H, 150, i & 1)),
+    CASE("vline", d.drawFastVLine(3 + i % 190, 10, 180, i & 1)),
+    CASE("line shallow", d.drawLine(0, 200, 199, 120 + i % 8, i & 1)),
+    CASE("line steep", d.drawLine(60 + i % 8, 200, 100, 80, i & 1)),
+    CASE("line fan", d.drawLine(i % 34 * 20 - 230, 200, 100, 125, i & 1)),
+    CASE("line far", d.drawLine(-900 + i % 7, -300 + i % 5, 1100, 500 - i % 9,
+                                i & 1)),
+    CASE("line outside", d.drawLine(-400, 300 + i % 8, 600, 210, i & 1)),
+    CASE("fillCircle", d.fillCircle(100, 100, 20 + i % 8, i & 1)),
+    CASE("fillCircle small", d.fillCircle(3 + i % 190, i % 200, i % 3, i & 1)),
+    CASE("fillCircle horizon", d.fillCircle(100, 800, 650 + i % 8, i & 1)),
+    CASE("fillCircle clipped", d.fillCircle(i % 240 - 20, 190, 30, i & 1)),
+    CASE("drawCircle", d.drawCircle(100, 100, 20 + i % 8, i & 1)),
+    CASE("drawCircle horizon", d.drawCircle(100, 800, 650 + i % 8, i & 1)),
+    CASE("drawCircle around", d.drawCircle(100, 100, 300 + i % 8, i & 1)),
+    CASE("fillTriangle", d.fillTriangle(100, 100, 30 + i % 8, 180, 170, 150,
+                                        i & 1)),
+    CASE("fillTriangle far", d.fillTriangle(100, 100 + i % 8, -2000, -3000,
+                                            -1800, 3000, i & 1)),
+    CASE("bitmap 200x200", d.drawBitmap(0, 0, image, W, H, i & 1)),
+    CASE("bitmap 200x200 opaque",
+         d.drawBitmap(0, 0, image, W, H, GxEPD_WHITE, GxEPD_BLACK)),
+    CASE("bitmap 40x60 aligned",
+         d.drawBitmap(24 + i % 2 * 48, 20, image, 40, 60, i & 1)),
+    CASE("bitmap 38x50 unaligned",
+         d.drawBitmap(35 + i % 2 * 35, 70, image, 38, 50, i & 1)),
+    CASE("bitmap 38x50 opaque",
+         d.drawBitmap(35 + i % 8, 70, image, 38, 50, i & 1, !(i & 1))),
+    CASE("bitmap clipped", d.drawBitmap(-13, 170, image, 40, 60, i & 1)),
+    {"text DSEG7 53", timeBefore, timeAfter},
+    {"text Sunflower 39", sunflowerBefore, sunflowerAfter},
+    CASE("bitmap dithered", d.drawBitmap(0, 0, dithered, W, H, i & 1)),
+    PACKED("packed dithered", 0, 0, dithered, W, H, packedDithered.data()),
+    PACKED("packed unaligned", 3 + i % 8, 5, dithered, 120, 90,
+           packedSmall.data()),
+    PACKED("packed random", 0, 0, image, W, H, packedImage.data()),
+    CASE("bitmap tetrisbg", d.drawBitmap(0, 0, tetrisRaw, W, H, i & 1)),
+    PACKED("packed tetrisbg", 0, 0, tetrisRaw, W, H, tetrisbg),
+    CASE("bitmap pokemon", d.drawBitmap(0, 0, pokemonRaw, W, H, i & 1)),
+    PACKED("packed pokemon", 0, 0, pokemonRaw, W, H, pokemon),
+    CASE("bitmap macpaint", d.drawBitmap(0, 0, macpaintRaw, W, H, i & 1)),
+    PACKED("packed macpaint", 0, 0, macpaintRaw, W, H, window),
+    {"text date", dateBefore, dateAfter},
+    {"text weather", weatherBefore, weatherAfter},
+    {"text centred", centredBefore, centredAfter},
+    {"text centred daily", dailyBefore, dailyAfter},
+    {"text menu", menuBefore, menuAfter},
+    {"text measure", measureBefore, measureAfter},
+    {"hands triangles", handsBefore, handsBefore},
+    {"hands", handsBefore, handsAfter, false},
+    CASE("fillRect rotated", d.setRotation(1 + i % 3);
+         d.fillRect(3 + i % 8, 20, 61, 100, i & 1); d.setRotation(0)),
+    CASE("line rotated", d.setRotation(1 + i % 3);
+         d.drawLine(0, 200, 100, 80 + i % 8, i & 1); d.setRotation(0)),
+    CASE("text clipped", d.setFont(&FreeMonoBold9pt7b); d.setTextColor(i & 1);
+         d.setTextWrap(false); d.setCursor(i % 8 - 20, 8 + i % 5);
+         d.print(days[i % 7]); d.setCursor(150 + i % 8, 199);
+         d.print(months[i % 12]); d.setTextWrap(true)),
+    CASE("text size 2 rotated", d.setFont(&FreeSansBold9pt7b);
+         d.setTextColor(i & 1); d.setTextSize(2); d.setRotation(i % 4);
+         d.setCursor(5 + i % 8, 60); d.print(months[i % 12]);
+         d.setRotation(0); d.setTextSize(1)),
+};
+
+// host ns per call
+template <class D>
+static double bench(D &display, void (*draw)(D &, int), int calls) {
+  memcpy(display.getBuffer(), background, SIZE);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls; i++) {
+    draw(display, i);
+  }
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+             .count() /
+         calls;
+}
+
+int main(int argc, char **argv) {
+  int calls = 200 * (argc > 1 ? atoi(argv[1]) : 5);
+  srand(1);
+  for (uint16_t i = 0; i < SIZE; i++) {
+    background[i] = rand();
+    image[i]      = rand();
+  }
+  // Bayer 4x4 dither of soft blobs, like the faces' art
+  static const uint8_t bayer[4][4] = {
+      {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < W; x++) {
+      int level = 8 + 8 * sin(x / 23.0) * cos(y / 17.0);
+      if (level > bayer[y % 4][x % 4]) {
+        dithered[y * W / 8 + x / 8] |= 0x80 >> (x % 8);
+      }
+    }
+  }
+  packedImage    = packBitmap(image, W, H);
+  packedDithered = packBitmap(dithered, W, H);
+  packedSmall    = packBitmap(dithered, 120, 90);
+  const uint8_t *faces[]   = {tetrisbg, pokemon, window};
+  uint8_t *unpacked[]      = {tetrisRaw, pokemonRaw, macpaintRaw};
+  for (int f = 0; f < 3; f++) {
+    fastPath.drawPackedBitmap(0, 0, faces[f], GxEPD_WHITE, GxEPD_BLACK);
+    memcpy(unpacked[f], fastPath.getBuffer(), SIZE);
+  }
+
+  int mismatches = 0;
+  printf("%-24s %10s %10s %8s\n", "case", "gfx ns", "fast ns", "speedup");
+  for (const benchCase &c : cases) {
+    // every call on its own frame, so a mismatch is not drawn over
+    int differ = 0; // most pixels of a call
+    for (int i = 0; i < 64; i++) {
+      memcpy(gfxPath.buffer, background, SIZE);
+      memcpy(fastPath.getBuffer(), background, SIZE);
+      c.gfx(gfxPath, i);
+      c.fast(fastPath, i);
+      if (!c.exact) {
+        int pixels = 0;
+        for (uint16_t b = 0; b < SIZE; b++) {
+          pixels += __builtin_popcount(gfxPath.buffer[b] ^
+                                       fastPath.getBuffer()[b]);
+        }
+        differ = std::max(differ, pixels);
+      } else if (memcmp(gfxPath.buffer, fastPath.getBuffer(), SIZE) != 0) {
+        fprintf(stderr, "%s: frames differ at call %d\n", c.name, i);
+        mismatches++;
+        break;
+      }
+    }
+    // best of alternating rounds, so that a case whose two sides do the
+    // same work reads 1.0x and not whatever the host did meanwhile
+    double gfx = INFINITY, fast = INFINITY;
+    for (int round = 0; round < ROUNDS; round++) {
+      gfx  = std::min(gfx, bench(gfxPath, c.gfx, calls));
+      fast = std::min(fast, bench(fastPath, c.fast, calls));
+    }
+    printf("%-24s %10.0f %10.0f %7.1fx", c.name, gfx, fast, gfx / fast);
+    if (!c.exact) {
+      printf("  up to %d pixels differ", differ);
+    }
+    printf("\n");
+  }
+  return mismatches > 0 ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+#ifndef DSEG7_Classic_Bold_53_digits_RUNS_H
+#define DSEG7_Classic_Bold_53_digits_RUNS_H
+
+// DSEG7_Classic_Bold_53 subset to "0-9:", glyphs run-length encoded
+// for WatchyDisplay::setFont(const runFont *), generated by
+// extras/host/tools/fontrle. Include it instead of DSEG7_Classic_Bold_53.h,
+// or next to it: this subset is DSEG7_Classic_Bold_53_digits.
+
+const uint8_t DSEG7_Classic_Bold_53_digitsRuns[] PROGMEM = {
+    0x20, 0x4F, 0x0A, 0x21, 0x3F, 0x0C, 0x40, 0x12, 0x1F, 0x0A, 0x12, 0x40,
+    0x04, 0x1F, 0x08, 0x14, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x06, 0x1F,
+    0x04, 0x16, 0x3F, 0x07, 0xF0, 0x47, 0x30, 0x06, 0xF0, 0x66, 0x30, 0x05,
+    0xF0, 0x85, 0x30, 0x04, 0xF0, 0xA4, 0x00, 0x30, 0x04, 0xF0, 0xA4, 0x30,
+    0x05, 0xF0, 0x85, 0x30, 0x06, 0xF0, 0x66, 0x3F, 0x07, 0xF0, 0x47, 0x40,
+    0x06, 0x1F, 0x04, 0x16, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x04, 0x1F,
+    0x08, 0x14, 0x40, 0x12, 0x1F, 0x0A, 0x12, 0x21, 0x3F, 0x0C, 0x20, 0x4F,
+    0x0A,
+    // '0'
+    0x00, 0x10, 0x42, 0x10, 0x34, 0x10, 0x25, 0x10, 0x16, 0x1F, 0x07, 0x10,
+    0x16, 0x10, 0x25, 0x10, 0x34, 0x00, 0x10, 0x34, 0x10, 0x25, 0x10, 0x16,
+    0x1F, 0x07, 0x10, 0x16, 0x10, 0x25, 0x10, 0x34, 0x10, 0x42, 0x00,
+    // '1'
+    0x20, 0x4F, 0x0A, 0x21, 0x3F, 0x0C, 0x30, 0x4F, 0x0A, 0x12, 0x30, 0x5F,
+    0x08, 0x14, 0x30, 0x6F, 0x06, 0x15, 0x30, 0x7F, 0x04, 0x16, 0x2F, 0xF0,
+    0xB7, 0x30, 0x7F, 0x04, 0x16, 0x30, 0x6F, 0x06, 0x15, 0x30, 0x5F, 0x08,
+    0x14, 0x20, 0x4F, 0x0A, 0x30, 0x04, 0x1F, 0x08, 0x30, 0x05, 0x1F, 0x06,
+    0x30, 0x06, 0x1F, 0x04, 0x1F, 0x07, 0x30, 0x06, 0x1F, 0x04, 0x30, 0x05,
+    0x1F, 0x06, 0x30, 0x04, 0x1F, 0x08, 0x30, 0x12, 0x1F, 0x0A, 0x21, 0x3F,
+    0x0C, 0x20, 0x4F, 0x0A,
+    // '2'
+    0x20, 0x1F, 0x0A, 0x21, 0x0F, 0x0C, 0x30, 0x1F, 0x0A, 0x12, 0x30, 0x2F,
+    0x08, 0x14, 0x30, 0x3F, 0x06, 0x15, 0x30, 0x4F, 0x04, 0x16, 0x2F, 0xF0,
+    0x87, 0x30, 0x4F, 0x04, 0x16, 0x30, 0x3F, 0x06, 0x15, 0x30, 0x2F, 0x08,
+    0x14, 0x20, 0x1F, 0x0A, 0x30, 0x2F, 0x08, 0x14, 0x30, 0x3F, 0x06, 0x15,
+    0x30, 0x4F, 0x04, 0x16, 0x2F, 0xF0, 0x87, 0x30, 0x4F, 0x04, 0x16, 0x30,
+    0x3F, 0x06, 0x15, 0x30, 0x2F, 0x08, 0x14, 0x30, 0x1F, 0x0A, 0x12, 0x21,
+    0x0F, 0x0C, 0x20, 0x1F, 0x0A,
+    // '3'
+    0x00, 0x30, 0x12, 0xF0, 0xC2, 0x30, 0x04, 0xF0, 0xA4, 0x30, 0x05, 0xF0,
+    0x85, 0x30, 0x06, 0xF0, 0x66, 0x3F, 0x07, 0xF0, 0x47, 0x40, 0x06, 0x1F,
+    0x04, 0x16, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x04, 0x1F, 0x08, 0x14,
+    0x20, 0x4F, 0x0A, 0x30, 0x5F, 0x08, 0x14, 0x30, 0x6F, 0x06, 0x15, 0x30,
+    0x7F, 0x04, 0x16, 0x2F, 0xF0, 0xB7, 0x20, 0xF0, 0xC6, 0x20, 0xF0, 0xD5,
+    0x20, 0xF0, 0xE4, 0x20, 0xF0, 0xF2, 0x00,
+    // '4'
+    0x20, 0x4F, 0x0A, 0x21, 0x3F, 0x0C, 0x30, 0x12, 0x1F, 0x0A, 0x30, 0x04,
+    0x1F, 0x08, 0x30, 0x05, 0x1F, 0x06, 0x30, 0x06, 0x1F, 0x04, 0x1F, 0x07,
+    0x30, 0x06, 0x1F, 0x04, 0x30, 0x05, 0x1F, 0x06, 0x30, 0x04, 0x1F, 0x08,
+    0x20, 0x4F, 0x0A, 0x30, 0x5F, 0x08, 0x14, 0x30, 0x6F, 0x06, 0x15, 0x30,
+    0x7F, 0x04, 0x16, 0x2F, 0xF0, 0xB7, 0x30, 0x7F, 0x04, 0x16, 0x30, 0x6F,
+    0x06, 0x15, 0x30, 0x5F, 0x08, 0x14, 0x30, 0x4F, 0x0A, 0x12, 0x21, 0x3F,
+    0x0C, 0x20, 0x4F, 0x0A,
+    // '5'
+    0x20, 0x4F, 0x0A, 0x21, 0x3F, 0x0C, 0x30, 0x12, 0x1F, 0x0A, 0x30, 0x04,
+    0x1F, 0x08, 0x30, 0x05, 0x1F, 0x06, 0x30, 0x06, 0x1F, 0x04, 0x1F, 0x07,
+    0x30, 0x06, 0x1F, 0x04, 0x30, 0x05, 0x1F, 0x06, 0x30, 0x04, 0x1F, 0x08,
+    0x20, 0x4F, 0x0A, 0x40, 0x04, 0x1F, 0x08, 0x14, 0x40, 0x05, 0x1F, 0x06,
+    0x15, 0x40, 0x06, 0x1F, 0x04, 0x16, 0x3F, 0x07, 0xF0, 0x47, 0x40, 0x06,
+    0x1F, 0x04, 0x16, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x04, 0x1F, 0x08,
+    0x14, 0x40, 0x12, 0x1F, 0x0A, 0x12, 0x21, 0x3F, 0x0C, 0x20, 0x4F, 0x0A,
+    // '6'
+    0x20, 0x4F, 0x0A, 0x21, 0x3F, 0x0C, 0x40, 0x12, 0x1F, 0x0A, 0x12, 0x40,
+    0x04, 0x1F, 0x08, 0x14, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x06, 0x1F,
+    0x04, 0x16, 0x3F, 0x07, 0xF0, 0x47, 0x30, 0x06, 0xF0, 0x66, 0x30, 0x05,
+    0xF0, 0x85, 0x30, 0x04, 0xF0, 0xA4, 0x00, 0x20, 0xF0, 0xE4, 0x20, 0xF0,
+    0xD5, 0x20, 0xF0, 0xC6, 0x2F, 0xF0, 0xB7, 0x20, 0xF0, 0xC6, 0x20, 0xF0,
+    0xD5, 0x20, 0xF0, 0xE4, 0x20, 0xF0, 0xF2, 0x00,
+    // '7'
+    0x20, 0x4F, 0x0A, 0x21, 0x3F, 0x0C, 0x40, 0x12, 0x1F, 0x0A, 0x12, 0x40,
+    0x04, 0x1F, 0x08, 0x14, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x06, 0x1F,
+    0x04, 0x16, 0x3F, 0x07, 0xF0, 0x47, 0x40, 0x06, 0x1F, 0x04, 0x16, 0x40,
+    0x05, 0x1F, 0x06, 0x15, 0x40, 0x04, 0x1F, 0x08, 0x14, 0x20, 0x4F, 0x0A,
+    0x40, 0x04, 0x1F, 0x08, 0x14, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x06,
+    0x1F, 0x04, 0x16, 0x3F, 0x07, 0xF0, 0x47, 0x40, 0x06, 0x1F, 0x04, 0x16,
+    0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x04, 0x1F, 0x08, 0x14, 0x40, 0x12,
+    0x1F, 0x0A, 0x12, 0x21, 0x3F, 0x0C, 0x20, 0x4F, 0x0A,
+    // '8'
+    0x20, 0x4F, 0x0A, 0x21, 0x3F, 0x0C, 0x40, 0x12, 0x1F, 0x0A, 0x12, 0x40,
+    0x04, 0x1F, 0x08, 0x14, 0x40, 0x05, 0x1F, 0x06, 0x15, 0x40, 0x06, 0x1F,
+    0x04, 0x16, 0x3F, 0x07, 0xF0, 0x47, 0x40, 0x06, 0x1F, 0x04, 0x16, 0x40,
+    0x05, 0x1F, 0x06, 0x15, 0x40, 0x04, 0x1F, 0x08, 0x14, 0x20, 0x4F, 0x0A,
+    0x30, 0x5F, 0x08, 0x14, 0x30, 0x6F, 0x06, 0x15, 0x30, 0x7F, 0x04, 0x16,
+    0x2F, 0xF0, 0xB7, 0x30, 0x7F, 0x04, 0x16, 0x30, 0x6F, 0x06, 0x15, 0x30,
+    0x5F, 0x08, 0x14, 0x30, 0x4F, 0x0A, 0x12, 0x21, 0x3F, 0x0C, 0x20, 0x4F,
+    0x0A,
+    // '9'
+    0x10, 0x23, 0x10, 0x15, 0x10, 0x06, 0x10, 0x07, 0x10, 0x06, 0x10, 0x15,
+    0x10, 0x31, 0x0E, 0x10, 0x14, 0x10, 0x06, 0x11, 0x07, 0x10, 0x06, 0x10,
+    0x15,
+    // ':'
+};
+
+const GFXglyph DSEG7_Classic_Bold_53_digitsRunGlyphs[] PROGMEM = {
+    {0, 34, 53, 44, 5, -53}, // '0'
+    {85, 8, 49, 44, 31, -51}, // '1'
+    {120, 34, 53, 44, 5, -53}, // '2'
+    {196, 31, 53, 44, 8, -53}, // '3'
+    {273, 34, 49, 44, 5, -51}, // '4'
+    {340, 34, 53, 44, 5, -53}, // '5'
+    {416, 34, 53, 44, 5, -53}, // '6'
+    {500, 34, 51, 44, 5, -53}, // '7'
+    {568, 34, 53, 44, 5, -53}, // '8'
+    {661, 34, 53, 44, 5, -53}, // '9'
+    {746, 8, 28, 12, 2, -40}, // ':'
+};
+
+const runFont DSEG7_Classic_Bold_53_digits PROGMEM = {{(uint8_t *)DSEG7_Classic_Bold_53_digitsRuns,
+    (GFXglyph *)DSEG7_Classic_Bold_53_digitsRunGlyphs, 0x30, 0x3A, 58}};
+
+#endif
@@ -1,7 +1,7 @@
 #include "Watchy.h"
 
 WatchyRTC Watchy::RTC;
-GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> Watchy::display(
+WatchyDisplay Watchy::display(
     GxEPD2_154_D67(DISPLAY_CS, DISPLAY_DC, DISPLAY_RES, DISPLAY_BUSY));
 
 RTC_DATA_ATTR int guiState;
@@ -10,279 +10,374 @@ RTC_DATA_ATTR BMA423 sensor;
 RTC_DATA_ATTR bool WIFI_CONFIGURED;
 RTC_DATA_ATTR bool BLE_CONFIGURED;
 RTC_DATA_ATTR weatherData currentWeather;
-RTC_DATA_ATTR int weatherIntervalCounter = -1;
+// set by JOB_WEATHER, the fetch waits for the face's getWeatherData() and
+// its arguments, so the job does not wake the watch: it is run by the first
+// tick at or after its deadline. The interval it was scheduled with, in
+// minutes.
+RTC_DATA_ATTR bool weatherDue;
+RTC_DATA_ATTR uint8_t weatherInterval;
 RTC_DATA_ATTR bool displayFullInit       = true;
 
+// the minute of the tick drawn ahead, 0: none, and its frame. The display
+// buffer holds the frame until a button press before the tick draws over it,
+// only then is it copied to the heap. Kept while awake.
+static uint8_t *aheadFrame;
+static time_t aheadMinute;
+
+// menu entries, user code can add more with addApp()
+watchyApp Watchy::apps[MAX_APPS] = {
+    {"About Watchy", &Watchy::showAbout, APP_STATE},
+    {"Vibrate Motor", &Watchy::showBuzz, MAIN_MENU_STATE},
+    {"Show Accelerometer", &Watchy::showAccelerometer, MAIN_MENU_STATE},
+    {"Set Time", &Watchy::setTime, MAIN_MENU_STATE},
+    {"Setup WiFi", &Watchy::setupWifi, APP_STATE},
+    {"Update Firmware", &Watchy::showUpdateFW, FW_UPDATE_STATE},
+    {"Sync NTP", &Watchy::showSyncNTP, MAIN_MENU_STATE}};
+uint8_t Watchy::appCount = 7;
+
 void Watchy::init(String datetime) {
   esp_sleep_wakeup_cause_t wakeup_reason;
   wakeup_reason = esp_sleep_get_wakeup_cause(); // get wake up reason
-  Wire.begin(SDA, SCL);                         // init i2c
+  WatchyProfiler::beginWake(wakeup_reason);
+  WatchyProfiler::begin(WatchyProfiler::WIRE_BEGIN);
+  Wire.begin(SDA, SCL); // init i2c
+  WatchyProfiler::end(WatchyProfiler::WIRE_BEGIN);
+  WatchyProfiler::begin(WatchyProfiler::RTC_INIT);
   RTC.init();
+  WatchyProfiler::end(WatchyProfiler::RTC_INIT);
 
-  // Init the display here for all cases, if unused, it will do nothing
+  // Init the display here for all cases, the panel is only woken from
+  // hibernation once something is drawn. The RTC chip is probed on the first
+  // boot only.
+  WatchyProfiler::begin(WatchyProfiler::DISPLAY_INIT);
+  gpio_hold_dis((gpio_num_t)DISPLAY_CS); // held through a running refresh
   display.epd2.selectSPI(SPI, SPISettings(20000000, MSBFIRST, SPI_MODE0)); // Set SPI to 20Mhz (default is 4Mhz)
   display.init(0, displayFullInit, 10,
                true); // 10ms by spec, and fast pulldown reset
   display.epd2.setBusyCallback(displayBusyCallback);
+  WatchyProfiler::end(WatchyProfiler::DISPLAY_INIT);
 
+  _onTick     = false;
+  aheadMinute = 0;
+  free(aheadFrame); // none after deep sleep, unless init() runs again
+  aheadFrame = NULL;
   switch (wakeup_reason) {
   case ESP_SLEEP_WAKEUP_EXT0: // RTC Alarm
-    if (guiState == WATCHFACE_STATE) {
-      RTC.read(currentTime);
-      showWatchFace(true); // partial updates on tick
+    RTC.read(currentTime);
+    _onTick     = currentTime.Second == 0; // alarms go off on the minute
+    _tickMicros = 0;
+    _runDueJobs();
+    if (guiState == WATCHFACE_STATE && RTC.isTick(currentTime)) {
+      showWatchFace(true); // what changed, full when the policy says so
     }
     break;
   case ESP_SLEEP_WAKEUP_EXT1: // button Press
     handleButtonPress();
     break;
+  case ESP_SLEEP_WAKEUP_TIMER: // ahead of a tick, or a refresh ran on and
+                               // deepSleep() finishes it
+    _drawAhead();
+    break;
   default: // reset
     RTC.config(datetime);
     _bmaConfig();
     RTC.read(currentTime);
-    showWatchFace(false); // full update on reset
+    _scheduleJobs();
+    showWatchFace(false); // full update on reset, the panel is unknown
     break;
   }
   deepSleep();
 }
 
 void Watchy::displayBusyCallback(const void *) {
+  WatchyProfiler::begin(WatchyProfiler::BUSY);
   gpio_wakeup_enable((gpio_num_t)DISPLAY_BUSY, GPIO_INTR_LOW_LEVEL);
   esp_sleep_enable_gpio_wakeup();
   esp_light_sleep_start();
+  WatchyProfiler::end(WatchyProfiler::BUSY);
 }
 
 void Watchy::deepSleep() {
-  display.hibernate();
+  WatchyProfiler::begin(WatchyProfiler::DEEP_SLEEP);
+  // a refresh still running is left to the panel, a short wake after it
+  // hibernates the panel: BUSY is no RTC GPIO, it can't wake the ESP32
+  uint32_t refreshUs = display.refreshRunningUs();
+  if (refreshUs == 0) {
+    display.hibernate();
+  }
+  display.storeFrame(); // for displayChanges() on the next wake
   displayFullInit = false; // Notify not to init it again
-  RTC.clearAlarm();        // resets the alarm flag in the RTC
+  RTC.clearAlarm(WatchyScheduler::nextDeadline()); // resets the alarm flag
+  uint64_t timerUs = _prewakeUs();
+  if (refreshUs > 0 && (timerUs == 0 || refreshUs < timerUs)) {
+    timerUs = refreshUs;
+  }
                     // Set pins 0-39 to input to avoid power leaking out
   for (int i = 0; i < 40; i++) {
-    pinMode(i, INPUT);
+    if (refreshUs == 0 || i != DISPLAY_CS) {
+      pinMode(i, INPUT);
+    }
+  }
+  if (refreshUs > 0) {
+    gpio_hold_en((gpio_num_t)DISPLAY_CS); // the panel stays deselected
+    gpio_deep_sleep_hold_en();
+  }
+  if (timerUs > 0) {
+    esp_sleep_enable_timer_wakeup(timerUs);
   }
   esp_sleep_enable_ext0_wakeup((gpio_num_t)RTC_INT_PIN,
                                0); // enable deep sleep wake on RTC interrupt
   esp_sleep_enable_ext1_wakeup(
       BTN_PIN_MASK,
       ESP_EXT1_WAKEUP_ANY_HIGH); // enable deep sleep wake on button press
+  WatchyProfiler::end(WatchyProfiler::DEEP_SLEEP);
+  WatchyProfiler::commitWake(display.fullRefreshes, display.partialRefreshes);
   esp_deep_sleep_start();
 }
 
+static const uint8_t buttonPins[] = {MENU_BTN_PIN, BACK_BTN_PIN, UP_BTN_PIN,
+                                     DOWN_BTN_PIN};
+
 void Watchy::handleButtonPress() {
   uint64_t wakeupBit = esp_sleep_get_ext1_wakeup_status();
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    pinMode(buttonPins[i], INPUT);
+    if (wakeupBit == (uint64_t)1 << buttonPins[i]) {
+      _heldPin    = buttonPins[i]; // may still be held, repeats if so
+      _heldButton = wakeupBit;
+      _nextRepeat = millis() + LONG_PRESS_MS;
+    }
+  }
+  _buttonSession(wakeupBit);
+}
+
+// The press that woke the watch, then a session in light sleep until the
+// menu is left or idle for SESSION_TIMEOUT_MS
+void Watchy::_buttonSession(uint64_t button) {
+  if (menuIndex >= appCount) { // entries were removed since the last boot
+    menuIndex = 0;
+  }
+  while (button != 0 && _handleButton(button)) {
+    button = waitButton(SESSION_TIMEOUT_MS);
+  }
+}
+
+// returns false when the session ends
+bool Watchy::_handleButton(uint64_t button) {
+  if (buttonRepeats > 0 && !(button & (UP_BTN_MASK | DOWN_BTN_MASK))) {
+    return true; // only scrolling repeats
+  }
   // Menu Button
-  if (wakeupBit & MENU_BTN_MASK) {
+  if (button & MENU_BTN_MASK) {
     if (guiState ==
         WATCHFACE_STATE) { // enter menu state if coming from watch face
       showMenu(menuIndex, false);
     } else if (guiState ==
                MAIN_MENU_STATE) { // if already in menu, then select menu item
-      switch (menuIndex) {
-      case 0:
-        showAbout();
-        break;
-      case 1:
-        showBuzz();
-        break;
-      case 2:
-        showAccelerometer();
-        break;
-      case 3:
-        setTime();
-        break;
-      case 4:
-        setupWifi();
-        break;
-      case 5:
-        showUpdateFW();
-        break;
-      case 6:
-        showSyncNTP();
-        break;
-      default:
-        break;
-      }
+      _openApp(menuIndex);
     } else if (guiState == FW_UPDATE_STATE) {
       updateFWBegin();
     }
   }
   // Back Button
-  else if (wakeupBit & BACK_BTN_MASK) {
+  else if (button & BACK_BTN_MASK) {
     if (guiState == MAIN_MENU_STATE) { // exit to watch face if already in menu
       RTC.read(currentTime);
-      showWatchFace(false);
+      showWatchFace(true);
+      return false;
     } else if (guiState == APP_STATE) {
       showMenu(menuIndex, false); // exit to menu if already in app
     } else if (guiState == FW_UPDATE_STATE) {
       showMenu(menuIndex, false); // exit to menu if already in app
     } else if (guiState == WATCHFACE_STATE) {
-      return;
+      return false;
     }
   }
   // Up Button
-  else if (wakeupBit & UP_BTN_MASK) {
+  else if (button & UP_BTN_MASK) {
     if (guiState == MAIN_MENU_STATE) { // increment menu index
-      menuIndex--;
-      if (menuIndex < 0) {
-        menuIndex = MENU_LENGTH - 1;
-      }
-      showMenu(menuIndex, true);
+      _moveMenu(-1);
     } else if (guiState == WATCHFACE_STATE) {
-      return;
+      return false;
     }
   }
   // Down Button
-  else if (wakeupBit & DOWN_BTN_MASK) {
+  else if (button & DOWN_BTN_MASK) {
     if (guiState == MAIN_MENU_STATE) { // decrement menu index
-      menuIndex++;
-      if (menuIndex > MENU_LENGTH - 1) {
-        menuIndex = 0;
-      }
-      showMenu(menuIndex, true);
+      _moveMenu(1);
     } else if (guiState == WATCHFACE_STATE) {
-      return;
+      return false;
     }
   }
+  return true;
+}
 
-  /***************** fast menu *****************/
-  bool timeout     = false;
-  long lastTimeout = millis();
-  pinMode(MENU_BTN_PIN, INPUT);
-  pinMode(BACK_BTN_PIN, INPUT);
-  pinMode(UP_BTN_PIN, INPUT);
-  pinMode(DOWN_BTN_PIN, INPUT);
-  while (!timeout) {
-    if (millis() - lastTimeout > 5000) {
-      timeout = true;
-    } else {
-      if (digitalRead(MENU_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState ==
-            MAIN_MENU_STATE) { // if already in menu, then select menu item
-          switch (menuIndex) {
-          case 0:
-            showAbout();
-            break;
-          case 1:
-            showBuzz();
-            break;
-          case 2:
-            showAccelerometer();
-            break;
-          case 3:
-            setTime();
-            break;
-          case 4:
-            setupWifi();
-            break;
-          case 5:
-            showUpdateFW();
-            break;
-          case 6:
-            showSyncNTP();
-            break;
-          default:
-            break;
-          }
-        } else if (guiState == FW_UPDATE_STATE) {
-          updateFWBegin();
-        }
-      } else if (digitalRead(BACK_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState ==
-            MAIN_MENU_STATE) { // exit to watch face if already in menu
-          RTC.read(currentTime);
-          showWatchFace(false);
-          break; // leave loop
-        } else if (guiState == APP_STATE) {
-          showMenu(menuIndex, false); // exit to menu if already in app
-        } else if (guiState == FW_UPDATE_STATE) {
-          showMenu(menuIndex, false); // exit to menu if already in app
-        }
-      } else if (digitalRead(UP_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState == MAIN_MENU_STATE) { // increment menu index
-          menuIndex--;
-          if (menuIndex < 0) {
-            menuIndex = MENU_LENGTH - 1;
-          }
-          showFastMenu(menuIndex);
-        }
-      } else if (digitalRead(DOWN_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState == MAIN_MENU_STATE) { // decrement menu index
-          menuIndex++;
-          if (menuIndex > MENU_LENGTH - 1) {
-            menuIndex = 0;
-          }
-          showFastMenu(menuIndex);
-        }
+uint64_t Watchy::waitButton(uint32_t timeoutMs) {
+  if (_heldButton != 0) {
+    // until it is released or repeats
+    long untilRepeat = (long)(_nextRepeat - millis());
+    if (untilRepeat > 0) {
+      _lightSleep((uint64_t)1 << _heldPin, GPIO_INTR_LOW_LEVEL, untilRepeat);
+    }
+    if (digitalRead(_heldPin) == HIGH) {
+      buttonRepeats++;
+      _nextRepeat += REPEAT_MS;
+      return _heldButton;
+    }
+    _heldButton = 0;
+    _lightSleep(0, GPIO_INTR_DISABLE, DEBOUNCE_MS); // let the contact settle
+  }
+  uint64_t pins = 0;
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    pins |= (uint64_t)1 << buttonPins[i];
+  }
+  unsigned long start = millis();
+  while (millis() - start < timeoutMs) {
+    _lightSleep(pins, GPIO_INTR_HIGH_LEVEL, timeoutMs - (millis() - start));
+    for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+      if (digitalRead(buttonPins[i]) == HIGH) {
+        _heldPin      = buttonPins[i];
+        _heldButton   = (uint64_t)1 << _heldPin;
+        _nextRepeat   = millis() + LONG_PRESS_MS;
+        buttonRepeats = 0;
+        return _heldButton;
       }
     }
   }
+  return 0;
+}
+
+// Light sleeps until the RTC alarm marks the minute, or a button is pressed
+// first and returned as by waitButton(). Returns 0 for the alarm and after
+// timeoutMs without either.
+uint64_t Watchy::_waitForTick(uint32_t timeoutMs) {
+  uint64_t pins = 0;
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    pinMode(buttonPins[i], INPUT);
+    pins |= (uint64_t)1 << buttonPins[i];
+  }
+  pinMode(RTC_INT_PIN, INPUT);
+  unsigned long start = millis();
+  while (digitalRead(RTC_INT_PIN) == HIGH) { // active low
+    if (millis() - start >= timeoutMs) {
+      return 0;
+    }
+    gpio_wakeup_enable((gpio_num_t)RTC_INT_PIN, GPIO_INTR_LOW_LEVEL);
+    _lightSleep(pins, GPIO_INTR_HIGH_LEVEL, timeoutMs - (millis() - start));
+    gpio_wakeup_disable((gpio_num_t)RTC_INT_PIN);
+    if (digitalRead(RTC_INT_PIN) == LOW) {
+      _onTick     = true;
+      _tickMicros = micros();
+      return 0;
+    }
+    for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+      if (digitalRead(buttonPins[i]) == HIGH) {
+        _heldPin      = buttonPins[i];
+        _heldButton   = (uint64_t)1 << _heldPin;
+        _nextRepeat   = millis() + LONG_PRESS_MS;
+        buttonRepeats = 0;
+        return _heldButton;
+      }
+    }
+  }
+  return 0;
+}
+
+// Light sleep until one of `pins` is at `level`, or for timeoutMs
+void Watchy::_lightSleep(uint64_t pins, gpio_int_type_t level,
+                         uint32_t timeoutMs) {
+  WatchyProfiler::begin(WatchyProfiler::IDLE);
+  gpio_wakeup_disable((gpio_num_t)DISPLAY_BUSY); // left on by the BUSY waits
+  for (uint8_t pin = 0; pins != 0; pin++, pins >>= 1) {
+    if (pins & 1) {
+      gpio_wakeup_enable((gpio_num_t)pin, level);
+    }
+  }
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup((uint64_t)timeoutMs * 1000);
+  esp_light_sleep_start();
+  // the display's BUSY waits light sleep too, only on BUSY
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    gpio_wakeup_disable((gpio_num_t)buttonPins[i]);
+  }
+  WatchyProfiler::end(WatchyProfiler::IDLE);
 }
 
 void Watchy::showMenu(byte menuIndex, bool partialRefresh) {
   display.setFullWindow();
-  display.fillScreen(GxEPD_BLACK);
-  display.setFont(&FreeMonoBold9pt7b);
+  _drawMenu(menuIndex);
 
-  int16_t x1, y1;
-  uint16_t w, h;
-  int16_t yPos;
-
-  const char *menuItems[] = {
-      "About Watchy", "Vibrate Motor", "Show Accelerometer",
-      "Set Time",     "Setup WiFi",    "Update Firmware",
-      "Sync NTP"};
-  for (int i = 0; i < MENU_LENGTH; i++) {
-    yPos = MENU_HEIGHT + (MENU_HEIGHT * i);
-    display.setCursor(0, yPos);
-    if (i == menuIndex) {
-      display.getTextBounds(menuItems[i], 0, yPos, &x1, &y1, &w, &h);
-      display.fillRect(x1 - 1, y1 - 10, 200, h + 15, GxEPD_WHITE);
-      display.setTextColor(GxEPD_BLACK);
-      display.println(menuItems[i]);
-    } else {
-      display.setTextColor(GxEPD_WHITE);
-      display.println(menuItems[i]);
-    }
+  if (partialRefresh) {
+    display.display(true);
+  } else {
+    display.refresh();
   }
 
-  display.display(partialRefresh);
+  _menuPage = menuIndex / MENU_ROWS;
+  guiState  = MAIN_MENU_STATE;
+}
+
+void Watchy::showFastMenu(byte menuIndex) { showMenu(menuIndex, true); }
 
-  guiState = MAIN_MENU_STATE;
+bool Watchy::addApp(const char *name, appHandler open, int state) {
+  if (appCount == MAX_APPS) {
+    return false;
+  }
+  apps[appCount++] = {name, open, state};
+  return true;
 }
 
-void Watchy::showFastMenu(byte menuIndex) {
-  display.setFullWindow();
+// Moves the selection by `step`. Within a page only the two rows change,
+// displayChanges() sends just those.
+void Watchy::_moveMenu(int8_t step) {
+  uint8_t previous = menuIndex;
+  menuIndex        = (menuIndex + step + appCount) % appCount;
+  if (_menuPage != menuIndex / MENU_ROWS ||
+      _menuPage != previous / MENU_ROWS) {
+    showMenu(menuIndex, true);
+    return;
+  }
+  _drawMenu(menuIndex);
+  display.displayChanges();
+}
+
+// The page of `selected`, top to bottom: the highlight band reaches into
+// the rows next to it, a descender of the row above included.
+void Watchy::_drawMenu(uint8_t selected) {
   display.fillScreen(GxEPD_BLACK);
   display.setFont(&FreeMonoBold9pt7b);
-
-  int16_t x1, y1;
-  uint16_t w, h;
-  int16_t yPos;
-
-  const char *menuItems[] = {
-      "About Watchy", "Vibrate Motor", "Show Accelerometer",
-      "Set Time",     "Setup WiFi",    "Update Firmware",
-      "Sync NTP"};
-  for (int i = 0; i < MENU_LENGTH; i++) {
-    yPos = MENU_HEIGHT + (MENU_HEIGHT * i);
-    display.setCursor(0, yPos);
-    if (i == menuIndex) {
-      display.getTextBounds(menuItems[i], 0, yPos, &x1, &y1, &w, &h);
-      display.fillRect(x1 - 1, y1 - 10, 200, h + 15, GxEPD_WHITE);
-      display.setTextColor(GxEPD_BLACK);
-      display.println(menuItems[i]);
-    } else {
-      display.setTextColor(GxEPD_WHITE);
-      display.println(menuItems[i]);
+  uint8_t page = selected / MENU_ROWS;
+  for (uint8_t row = 0; row < MENU_ROWS; row++) {
+    uint8_t i = page * MENU_ROWS + row;
+    if (i < appCount) {
+      _drawMenuRow(i, i == selected);
     }
   }
+}
 
-  display.display(true);
+void Watchy::_drawMenuRow(uint8_t i, bool selected) {
+  int16_t yPos = MENU_HEIGHT + MENU_HEIGHT * (i % MENU_ROWS); // baseline
+  if (selected) { // around the name's ink, measured without the
+                  // measureText() memo that the watch face's text uses
+    int16_t x1, y1;
+    uint16_t w, h;
+    display.getTextBounds(apps[i].name, 0, yPos, &x1, &y1, &w, &h);
+    display.fillRect(x1 - 1, y1 - 10, DISPLAY_WIDTH, h + 15, GxEPD_WHITE);
+  }
+  display.setTextColor(selected ? GxEPD_BLACK : GxEPD_WHITE);
+  display.setCursor(0, yPos);
+  display.print(apps[i].name);
+}
 
-  guiState = MAIN_MENU_STATE;
+void Watchy::_openApp(uint8_t i) {
+  if (i >= appCount) {
+    return;
+  }
+  _menuPage   = -1; // the app draws over the menu
+  aheadMinute = 0;  // and may change what the watch face shows
+  (this->*apps[i].open)();
+  guiState = apps[i].state;
 }
 
 void Watchy::showAbout() {
@@ -304,7 +399,7 @@ void Watchy::showAbout() {
   display.print(voltage);
   display.println("V");
 
-  display.display(false); // full refresh
+  display.refresh();
 
   guiState = APP_STATE;
 }
@@ -316,7 +411,7 @@ void Watchy::showBuzz() {
   display.setTextColor(GxEPD_WHITE);
   display.setCursor(70, 80);
   display.println("Buzz!");
-  display.display(false); // full refresh
+  display.refresh();
   vibMotor();
   showMenu(menuIndex, false);
 }
@@ -354,15 +449,18 @@ void Watchy::setTime() {
 
   display.setFullWindow();
 
+  uint64_t button         = 0;
+  unsigned long lastPress = millis();
+
   while (1) {
 
-    if (digitalRead(MENU_BTN_PIN) == 1) {
+    if ((button & MENU_BTN_MASK) && buttonRepeats == 0) {
       setIndex++;
       if (setIndex > SET_DAY) {
         break;
       }
     }
-    if (digitalRead(BACK_BTN_PIN) == 1) {
+    if ((button & BACK_BTN_MASK) && buttonRepeats == 0) {
       if (setIndex != SET_HOUR) {
         setIndex--;
       }
@@ -370,7 +468,7 @@ void Watchy::setTime() {
 
     blink = 1 - blink;
 
-    if (digitalRead(DOWN_BTN_PIN) == 1) {
+    if (button & DOWN_BTN_MASK) { // repeats while held
       blink = 1;
       switch (setIndex) {
       case SET_HOUR:
@@ -393,7 +491,7 @@ void Watchy::setTime() {
       }
     }
 
-    if (digitalRead(UP_BTN_PIN) == 1) {
+    if (button & UP_BTN_MASK) {
       blink = 1;
       switch (setIndex) {
       case SET_HOUR:
@@ -418,7 +516,7 @@ void Watchy::setTime() {
 
     display.fillScreen(GxEPD_BLACK);
     display.setTextColor(GxEPD_WHITE);
-    display.setFont(&DSEG7_Classic_Bold_53);
+    display.setFont(&DSEG7_Classic_Bold_53_digits);
 
     display.setCursor(5, 80);
     if (setIndex == SET_HOUR) { // blink hour digits
@@ -472,6 +570,14 @@ void Watchy::setTime() {
     }
     display.print(day);
     display.display(true); // partial refresh
+
+    button = waitButton(SET_TIME_BLINK_MS);
+    if (button != 0) {
+      lastPress = millis();
+    } else if (millis() - lastPress > APP_IDLE_TIMEOUT_MS) {
+      showMenu(menuIndex, false); // abandoned, the time is left as it was
+      return;
+    }
   }
 
   tmElements_t tm;
@@ -495,64 +601,65 @@ void Watchy::showAccelerometer() {
 
   Accel acc;
 
-  long previousMillis = 0;
-  long interval       = 200;
+  long interval           = 200;
+  unsigned long lastPress = millis();
 
   guiState = APP_STATE;
 
   pinMode(BACK_BTN_PIN, INPUT);
 
   while (1) {
+    // Get acceleration data
+    bool res          = sensor.getAccel(acc);
+    uint8_t direction = sensor.getDirection();
+    display.fillScreen(GxEPD_BLACK);
+    display.setCursor(0, 30);
+    if (res == false) {
+      display.println("getAccel FAIL");
+    } else {
+      display.print("  X:");
+      display.println(acc.x);
+      display.print("  Y:");
+      display.println(acc.y);
+      display.print("  Z:");
+      display.println(acc.z);
+
+      display.setCursor(30, 130);
+      switch (direction) {
+      case DIRECTION_DISP_DOWN:
+        display.println("FACE DOWN");
+        break;
+      case DIRECTION_DISP_UP:
+        display.println("FACE UP");
+        break;
+      case DIRECTION_BOTTOM_EDGE:
+        display.println("BOTTOM EDGE");
+        break;
+      case DIRECTION_TOP_EDGE:
+        display.println("TOP EDGE");
+        break;
+      case DIRECTION_RIGHT_EDGE:
+        display.println("RIGHT EDGE");
+        break;
+      case DIRECTION_LEFT_EDGE:
+        display.println("LEFT EDGE");
+        break;
+      default:
+        display.println("ERROR!!!");
+        break;
+      }
+    }
+    display.display(true); // partial refresh
 
-    unsigned long currentMillis = millis();
-
-    if (digitalRead(BACK_BTN_PIN) == 1) {
+    // light sleep between samples, BACK ends it
+    uint64_t button = waitButton(interval);
+    if (button & BACK_BTN_MASK) {
       break;
     }
-
-    if (currentMillis - previousMillis > interval) {
-      previousMillis = currentMillis;
-      // Get acceleration data
-      bool res          = sensor.getAccel(acc);
-      uint8_t direction = sensor.getDirection();
-      display.fillScreen(GxEPD_BLACK);
-      display.setCursor(0, 30);
-      if (res == false) {
-        display.println("getAccel FAIL");
-      } else {
-        display.print("  X:");
-        display.println(acc.x);
-        display.print("  Y:");
-        display.println(acc.y);
-        display.print("  Z:");
-        display.println(acc.z);
-
-        display.setCursor(30, 130);
-        switch (direction) {
-        case DIRECTION_DISP_DOWN:
-          display.println("FACE DOWN");
-          break;
-        case DIRECTION_DISP_UP:
-          display.println("FACE UP");
-          break;
-        case DIRECTION_BOTTOM_EDGE:
-          display.println("BOTTOM EDGE");
-          break;
-        case DIRECTION_TOP_EDGE:
-          display.println("TOP EDGE");
-          break;
-        case DIRECTION_RIGHT_EDGE:
-          display.println("RIGHT EDGE");
-          break;
-        case DIRECTION_LEFT_EDGE:
-          display.println("LEFT EDGE");
-          break;
-        default:
-          display.println("ERROR!!!");
-          break;
-        }
-      }
-      display.display(true); // full refresh
+    if (button != 0) {
+      lastPress = millis();
+    } else if (millis() - lastPress > APP_IDLE_TIMEOUT_MS) {
+      break;
     }
   }
 
@@ -560,14 +667,110 @@ void Watchy::showAccelerometer() {
 }
 
 void Watchy::showWatchFace(bool partialRefresh) {
+  _menuPage = -1;
   display.setFullWindow();
-  drawWatchFace();
-  display.display(partialRefresh); // partial refresh
+  WatchyProfiler::begin(WatchyProfiler::DRAW);
+  if (partialRefresh &&
+      aheadMinute == makeTime(currentTime) - currentTime.Second) {
+    if (aheadFrame != NULL) {
+      memcpy(display.getBuffer(), aheadFrame, WatchyDisplay::BUFFER_SIZE);
+    }
+  } else {
+    _drawFace(partialRefresh);
+  }
+  WatchyProfiler::end(WatchyProfiler::DRAW);
+  WatchyProfiler::begin(WatchyProfiler::SPI);
+  if (partialRefresh) {
+    display.refresh(makeTime(currentTime)); // nothing if nothing changed
+  } else {
+    display.display(false);
+  }
+  WatchyProfiler::end(WatchyProfiler::SPI);
   guiState = WATCHFACE_STATE;
 }
 
+void Watchy::_drawFace(bool restoreLayer) {
+  uint32_t key = staticLayerKey();
+  if (!restoreLayer || !display.restoreLayer(key)) {
+    if (drawStaticLayer()) {
+      display.storeLayer(key);
+    }
+  }
+  drawWatchFace();
+}
+
+// Woken PREWAKE_MS before a tick: runs the jobs due on it, draws its minute
+// and powers the panel up, then starts the refresh as the RTC alarm marks
+// the minute. A button
+// pressed before then is handled first, the frame is kept for
+// showWatchFace() of that minute. Any other timer wake is for a refresh
+// that ran on.
+void Watchy::_drawAhead() {
+  if (guiState != WATCHFACE_STATE) {
+    return;
+  }
+  RTC.read(currentTime);
+  uint32_t leftMs = (SECS_PER_MIN - currentTime.Second) * 1000;
+  if (leftMs > RTC.getPrewake() + 2000UL) {
+    return;
+  }
+  time_t minute = makeTime(currentTime) - currentTime.Second + SECS_PER_MIN;
+  breakTime(minute, currentTime);
+  if (!RTC.isTick(currentTime)) {
+    return;
+  }
+  _runDueJobs(); // before the face draws, as on the tick
+  if (makeTime(currentTime) != minute) {
+    return; // a job set the clock, the tick's alarm wakes the watch
+  }
+  display.setFullWindow();
+  WatchyProfiler::begin(WatchyProfiler::DRAW);
+  _drawFace(true);
+  WatchyProfiler::end(WatchyProfiler::DRAW);
+  aheadMinute = minute;
+  display.wake();
+  uint64_t button;
+  while ((button = _waitForTick(leftMs + 1000)) != 0) {
+    if (aheadFrame == NULL && aheadMinute != 0) { // the menu draws over it
+      aheadFrame = (uint8_t *)malloc(WatchyDisplay::BUFFER_SIZE);
+      if (aheadFrame == NULL) {
+        aheadMinute = 0; // redrawn then
+      } else {
+        memcpy(aheadFrame, display.getBuffer(), WatchyDisplay::BUFFER_SIZE);
+      }
+    }
+    _buttonSession(button);
+    if (guiState != WATCHFACE_STATE) {
+      return; // the tick's wake is taken by the menu or an app
+    }
+  }
+  if (_onTick) {
+    breakTime(minute, currentTime);
+  } else { // a button session, or the alarm did not come
+    RTC.read(currentTime);
+  }
+  _runDueJobs(); // due while a button session ran
+  showWatchFace(true);
+}
+
+// Deep sleep until the wake ahead of the next tick, 0: the RTC alarm wakes
+// the watch on the tick
+uint64_t Watchy::_prewakeUs() {
+  if (RTC.getPrewake() == 0 || guiState != WATCHFACE_STATE) {
+    return 0;
+  }
+  tmElements_t tm;
+  if (!_onTick) { // how far into the second is unknown, take its end
+    RTC.read(tm);
+    return RTC.untilPrewake(tm, 1000000);
+  }
+  unsigned long elapsed = micros() - _tickMicros;
+  breakTime(makeTime(currentTime) + elapsed / 1000000, tm);
+  return RTC.untilPrewake(tm, elapsed % 1000000);
+}
+
 void Watchy::drawWatchFace() {
-  display.setFont(&DSEG7_Classic_Bold_53);
+  display.setFont(&DSEG7_Classic_Bold_53_digits);
   display.setCursor(5, 53 + 60);
   if (currentTime.Hour < 10) {
     display.print("0");
@@ -580,6 +783,10 @@ void Watchy::drawWatchFace() {
   display.println(currentTime.Minute);
 }
 
+bool Watchy::drawStaticLayer() { return false; }
+
+uint32_t Watchy::staticLayerKey() { return 0; }
+
 weatherData Watchy::getWeatherData() {
   return getWeatherData(settings.cityID, settings.weatherUnit,
                         settings.weatherLang, settings.weatherURL,
@@ -590,48 +797,103 @@ weatherData Watchy::getWeatherData(String cityID, String units, String lang,
                                    String url, String apiKey,
                                    uint8_t updateInterval) {
   currentWeather.isMetric = units == String("metric");
-  if (weatherIntervalCounter < 0) { //-1 on first run, set to updateInterval
-    weatherIntervalCounter = updateInterval;
+  bool firstCall          = !WatchyScheduler::scheduled(JOB_WEATHER);
+  if (firstCall || weatherDue) {
+    weatherDue = false;
+    _fetchWeather(cityID, units, lang, url, apiKey);
   }
-  if (weatherIntervalCounter >=
-      updateInterval) { // only update if WEATHER_UPDATE_INTERVAL has elapsed
-                        // i.e. 30 minutes
+  if (firstCall || updateInterval != weatherInterval) {
+    // on the minute, like the RTC alarm
+    uint32_t now    = makeTime(currentTime) - currentTime.Second;
+    uint32_t period = updateInterval * SECS_PER_MIN;
+    WatchyScheduler::schedule(JOB_WEATHER, now + period, period, false);
+    weatherInterval = updateInterval;
+  }
+  return currentWeather;
+}
+
+void Watchy::_fetchWeather(String cityID, String units, String lang,
+                           String url, String apiKey) {
+  WatchyProfiler::begin(WatchyProfiler::WIFI);
+  if (connectWiFi()) {
+    HTTPClient http; // Use Weather API for live data if WiFi is connected
+    http.setConnectTimeout(3000); // 3 second max timeout
+    String weatherQueryURL = url + cityID + String("&units=") + units +
+                             String("&lang=") + lang + String("&appid=") +
+                             apiKey;
+    http.begin(weatherQueryURL.c_str());
+    int httpResponseCode = http.GET();
+    if (httpResponseCode == 200) {
+      String payload             = http.getString();
+      JSONVar responseObject     = JSON.parse(payload);
+      currentWeather.temperature = int(responseObject["main"]["temp"]);
+      currentWeather.weatherConditionCode =
+          int(responseObject["weather"][0]["id"]);
+      currentWeather.weatherDescription = responseObject["weather"][0]["main"];
+    } else {
+      // http error
+    }
+    http.end();
+    // turn off radios
+    WiFi.mode(WIFI_OFF);
+    btStop();
+    WatchyProfiler::end(WatchyProfiler::WIFI);
+  } else { // No WiFi, use internal temperature sensor
+    WatchyProfiler::end(WatchyProfiler::WIFI);
+    uint8_t temperature = sensor.readTemperature(); // celsius
+    if (!currentWeather.isMetric) {
+      temperature = temperature * 9. / 5. + 32.; // fahrenheit
+    }
+    currentWeather.temperature          = temperature;
+    currentWeather.weatherConditionCode = 800;
+  }
+}
+
+void Watchy::runJob(uint8_t job) {
+  switch (job) {
+  case JOB_WEATHER: // the arguments are the face's, not kept across wakes
+    weatherDue = true;
+    break;
+  case JOB_NTP_SYNC:
+    WatchyProfiler::begin(WatchyProfiler::WIFI);
     if (connectWiFi()) {
-      HTTPClient http; // Use Weather API for live data if WiFi is connected
-      http.setConnectTimeout(3000); // 3 second max timeout
-      String weatherQueryURL = url + cityID + String("&units=") + units +
-                               String("&lang=") + lang + String("&appid=") +
-                               apiKey;
-      http.begin(weatherQueryURL.c_str());
-      int httpResponseCode = http.GET();
-      if (httpResponseCode == 200) {
-        String payload             = http.getString();
-        JSONVar responseObject     = JSON.parse(payload);
-        currentWeather.temperature = int(responseObject["main"]["temp"]);
-        currentWeather.weatherConditionCode =
-            int(responseObject["weather"][0]["id"]);
-        currentWeather.weatherDescription =
-            responseObject["weather"][0]["main"];
-      } else {
-        // http error
+      if (syncNTP()) {
+        RTC.read(currentTime);
       }
-      http.end();
-      // turn off radios
       WiFi.mode(WIFI_OFF);
       btStop();
-    } else { // No WiFi, use internal temperature sensor
-      uint8_t temperature = sensor.readTemperature(); // celsius
-      if (!currentWeather.isMetric) {
-        temperature = temperature * 9. / 5. + 32.; // fahrenheit
-      }
-      currentWeather.temperature          = temperature;
-      currentWeather.weatherConditionCode = 800;
     }
-    weatherIntervalCounter = 0;
-  } else {
-    weatherIntervalCounter++;
+    WatchyProfiler::end(WatchyProfiler::WIFI);
+    break;
+  case JOB_STEP_RESET:
+    sensor.resetStepCounter();
+    break;
+  }
+}
+
+// Jobs kept from the last power on are dropped, the step counter is reset at
+// midnight, weather refreshes are scheduled by the first getWeatherData()
+// and wait for a tick.
+void Watchy::_scheduleJobs() {
+  uint32_t now = makeTime(currentTime) - currentTime.Second;
+  WatchyScheduler::clear();
+  WatchyScheduler::schedule(JOB_STEP_RESET,
+                            now - now % SECS_PER_DAY + SECS_PER_DAY,
+                            SECS_PER_DAY);
+  if (NTP_SYNC_INTERVAL > 0) {
+    WatchyScheduler::schedule(JOB_NTP_SYNC,
+                              now + NTP_SYNC_INTERVAL * SECS_PER_HOUR,
+                              NTP_SYNC_INTERVAL * SECS_PER_HOUR);
+  }
+}
+
+void Watchy::_runDueJobs() {
+  uint32_t now = makeTime(currentTime);
+  int16_t job;
+  while ((job = WatchyScheduler::nextDue(now)) != NO_JOB) {
+    runJob(job);
+    _onTick = false; // it may have set the clock
   }
-  return currentWeather;
 }
 
 float Watchy::getBatteryVoltage() {
@@ -762,6 +1024,7 @@ void Watchy::_bmaConfig() {
 
 void Watchy::setupWifi() {
   display.epd2.setBusyCallback(0); // temporarily disable lightsleep on busy
+  WatchyProfiler::begin(WatchyProfiler::WIFI);
   WiFiManager wifiManager;
   wifiManager.resetSettings();
   wifiManager.setTimeout(WIFI_AP_TIMEOUT);
@@ -777,10 +1040,11 @@ void Watchy::setupWifi() {
     display.println("Connected to");
     display.println(WiFi.SSID());
   }
-  display.display(false); // full refresh
+  display.refresh();
   // turn off radios
   WiFi.mode(WIFI_OFF);
   btStop();
+  WatchyProfiler::end(WatchyProfiler::WIFI);
   display.epd2.setBusyCallback(displayBusyCallback); // enable lightsleep on
                                                      // busy
   guiState = APP_STATE;
@@ -797,7 +1061,7 @@ void Watchy::_configModeCallback(WiFiManager *myWiFiManager) {
   display.println(WIFI_AP_SSID);
   display.print("IP: ");
   display.println(WiFi.softAPIP());
-  display.display(false); // full refresh
+  display.refresh();
 }
 
 bool Watchy::connectWiFi() {
@@ -834,7 +1098,7 @@ void Watchy::showUpdateFW() {
   display.println("again when ready");
   display.println(" ");
   display.println("Keep USB powered");
-  display.display(false); // full refresh
+  display.refresh();
 
   guiState = FW_UPDATE_STATE;
 }
@@ -851,8 +1115,9 @@ void Watchy::updateFWBegin() {
   display.println(" ");
   display.println("Waiting for");
   display.println("connection...");
-  display.display(false); // full refresh
+  display.refresh();
 
+  WatchyProfiler::begin(WatchyProfiler::BLE);
   BLE BT;
   BT.begin("Watchy BLE OTA");
   int prevStatus = -1;
@@ -871,7 +1136,7 @@ void Watchy::updateFWBegin() {
         display.println(" ");
         display.println("Waiting for");
         display.println("upload...");
-        display.display(false); // full refresh
+        display.refresh();
       }
       if (currentStatus == 1) {
         display.setFullWindow();
@@ -896,7 +1161,7 @@ void Watchy::updateFWBegin() {
         display.println("completed!");
         display.println(" ");
         display.println("Rebooting...");
-        display.display(false); // full refresh
+        display.refresh();
 
         delay(2000);
         esp_restart();
@@ -910,7 +1175,7 @@ void Watchy::updateFWBegin() {
         display.println("BLE Disconnected!");
         display.println(" ");
         display.println("exiting...");
-        display.display(false); // full refresh
+        display.refresh();
         delay(1000);
         break;
       }
@@ -922,6 +1187,7 @@ void Watchy::updateFWBegin() {
   // turn off radios
   WiFi.mode(WIFI_OFF);
   btStop();
+  WatchyProfiler::end(WatchyProfiler::BLE);
   showMenu(menuIndex, false);
 }
 
@@ -932,7 +1198,8 @@ void Watchy::showSyncNTP() {
   display.setTextColor(GxEPD_WHITE);
   display.setCursor(0, 30);
   display.println("Syncing NTP... ");
-  display.display(false); // full refresh
+  display.refresh();
+  WatchyProfiler::begin(WatchyProfiler::WIFI);
   if (connectWiFi()) {
     if (syncNTP()) {
       display.println("NTP Sync Success\n");
@@ -962,7 +1229,8 @@ void Watchy::showSyncNTP() {
   } else {
     display.println("WiFi Not Configured");
   }
-  display.display(true); // full refresh
+  WatchyProfiler::end(WatchyProfiler::WIFI);
+  display.refresh();
   delay(3000);
   showMenu(menuIndex, false);
 }
@@ -7,11 +7,15 @@
 #include <NTPClient.h>
 #include <WiFiUdp.h>
 #include <Arduino_JSON.h>
-#include <GxEPD2_BW.h>
+#include "WatchyDisplay.h"
 #include <Wire.h>
 #include <Fonts/FreeMonoBold9pt7b.h>
-#include "DSEG7_Classic_Bold_53.h"
+#include "DSEG7_Classic_Bold_53_runs.h"
 #include "WatchyRTC.h"
+#include "WatchyScheduler.h"
+#include "WatchyProfiler.h"
+#include "WatchyEnergy.h"
+#include "WatchyMath.h"
 #include "BLE.h"
 #include "bma.h"
 #include "config.h"
@@ -23,6 +27,19 @@ typedef struct weatherData {
   String weatherDescription;
 } weatherData;
 
+class Watchy;
+typedef void (Watchy::*appHandler)();
+
+// Menu entry: open() draws the app and may return straight away, leaving the
+// buttons to handleButtonPress(), or run until the app is done. guiState is
+// set to state once it returns: APP_STATE while the app stays open,
+// MAIN_MENU_STATE if it went back to the menu itself.
+typedef struct watchyApp {
+  const char *name;
+  appHandler open;
+  int state;
+} watchyApp;
+
 typedef struct watchySettings {
   // Weather Settings
   String cityID;
@@ -40,12 +57,20 @@ typedef struct watchySettings {
 class Watchy {
 public:
   static WatchyRTC RTC;
-  static GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> display;
+  static WatchyDisplay display;
+  static watchyApp apps[MAX_APPS];
+  static uint8_t appCount;
   tmElements_t currentTime;
   watchySettings settings;
+  // waitButton(): 0 for a press, 1 once it is held for LONG_PRESS_MS, then
+  // one more for every REPEAT_MS it stays held
+  uint8_t buttonRepeats;
 
 public:
-  explicit Watchy(const watchySettings &s) : settings(s) {} // constructor
+  explicit Watchy(const watchySettings &s)
+      : settings(s), buttonRepeats(0), _heldButton(0), _menuPage(-1),
+        _onTick(false) {
+  } // constructor
   void init(String datetime = "");
   void deepSleep();
   static void displayBusyCallback(const void *);
@@ -53,8 +78,18 @@ public:
   void vibMotor(uint8_t intervalMs = 100, uint8_t length = 20);
 
   void handleButtonPress();
+  // Light sleeps, with the display still initialised, until a button is
+  // pressed or repeats while held, and returns its *_BTN_MASK. Returns 0
+  // after timeoutMs without a press.
+  uint64_t waitButton(uint32_t timeoutMs);
+  // partialRefresh forces a partial refresh, otherwise display.refresh()
+  // decides
   void showMenu(byte menuIndex, bool partialRefresh);
   void showFastMenu(byte menuIndex);
+  // Adds a menu entry, for a subclass' method use
+  // static_cast<appHandler>(&MyWatchy::showMyApp). Call before init().
+  static bool addApp(const char *name, appHandler open,
+                     int state = APP_STATE);
   void showAbout();
   void showBuzz();
   void showAccelerometer();
@@ -70,12 +105,52 @@ public:
                              String url, String apiKey, uint8_t updateInterval);
   void updateFWBegin();
 
+  // Draws the static layer, from RTC memory unless partialRefresh is false,
+  // then drawWatchFace() over it, or takes the frame drawn ahead for this
+  // minute with prewake (see WatchyRTC::setPrewake()). With partialRefresh the panel gets what
+  // changed, or a full refresh when the refresh policy calls for one (see
+  // WatchyDisplay::refresh()), without it always a full refresh.
   void showWatchFace(bool partialRefresh);
   virtual void drawWatchFace(); // override this method for different watch
                                 // faces
+  // Optional static layer: what stays the same from tick to tick, from the
+  // fillScreen() on. It is kept packed in RTC memory and restored before
+  // drawWatchFace() while staticLayerKey() returns the same, so a face with
+  // one only draws what changes. It is drawn again on forced full refreshes
+  // (reset). Return false if there is none, the default.
+  virtual bool drawStaticLayer();
+  // Changes whenever the static layer would come out differently, e.g. with
+  // a setting or the date it shows
+  virtual uint32_t staticLayerKey();
+  // Runs a due WatchyScheduler job. Override to handle ids from JOB_USER on
+  // and call Watchy::runJob() for the others.
+  virtual void runJob(uint8_t job);
 
 private:
+  uint64_t _heldButton; // mask of the button last returned while held
+  uint8_t _heldPin;
+  unsigned long _nextRepeat; // millis()
+  int8_t _menuPage;          // menu page in the frame buffer, -1: none
+  bool _onTick;              // the minute started at _tickMicros
+  unsigned long _tickMicros; // micros()
+
+  void _moveMenu(int8_t step);
+  void _drawMenu(uint8_t selected);
+  void _drawMenuRow(uint8_t i, bool selected);
+  void _openApp(uint8_t i);
+
+  bool _handleButton(uint64_t button);
+  void _buttonSession(uint64_t button);
+  uint64_t _waitForTick(uint32_t timeoutMs);
+  void _drawFace(bool restoreLayer);
+  void _drawAhead();
+  uint64_t _prewakeUs();
+  void _lightSleep(uint64_t pins, gpio_int_type_t level, uint32_t timeoutMs);
   void _bmaConfig();
+  void _scheduleJobs();
+  void _runDueJobs();
+  void _fetchWeather(String cityID, String units, String lang, String url,
+                     String apiKey);
   static void _configModeCallback(WiFiManager *myWiFiManager);
   static uint16_t _readRegister(uint8_t address, uint8_t reg, uint8_t *data,
                                 uint16_t len);
@@ -0,0 +1,1523 @@
+#include "WatchyDisplay.h"
+#include "WatchyProfiler.h"
+
+RTC_DATA_ATTR uint8_t frameStore[FRAME_STORE_SIZE];
+RTC_DATA_ATTR uint16_t frameStoreLength; // 0: nothing stored
+RTC_DATA_ATTR uint16_t frameStoreCrc;
+RTC_DATA_ATTR uint8_t layerStore[LAYER_STORE_SIZE];
+RTC_DATA_ATTR uint16_t layerStoreLength; // 0: nothing stored
+RTC_DATA_ATTR uint16_t layerStoreCrc;
+RTC_DATA_ATTR uint32_t layerStoreKey;
+// refresh(): the policy and the ghosting since the last full refresh
+RTC_DATA_ATTR refreshPolicy refreshSettings = {
+    REFRESH_MAX_PIXELS, REFRESH_MAX_PARTIALS, REFRESH_CLEAN_HOUR,
+    REFRESH_ASYNC_MS};
+RTC_DATA_ATTR uint32_t ghostPixelCount = WatchyDisplay::GHOST_UNKNOWN;
+RTC_DATA_ATTR uint16_t ghostRefreshCount;
+RTC_DATA_ATTR uint32_t cleanDay; // of the last timed refresh, 0: none
+// setInverted(), and whether the panel still shows the other polarity
+RTC_DATA_ATTR bool panelInverted;
+RTC_DATA_ATTR bool inversionPending;
+// a refresh that was not waited for, and the window of the previous RAM to
+// catch up once it is over (w = 0: none)
+RTC_DATA_ATTR uint32_t refreshTimes[3]; // per RefreshMode, µs
+RTC_DATA_ATTR bool refreshRunning;
+RTC_DATA_ATTR int16_t runningX, runningY, runningW, runningH;
+
+// measureText(): memoised bounds, replaced round robin
+typedef struct textLayout {
+  const GFXfont *font;
+  uint32_t hash; // FNV-1a of the string, checked before the string
+  uint8_t sizeX, sizeY;
+  char text[TEXT_BOUNDS_LENGTH]; // "": unused
+  textBounds bounds;
+} textLayout;
+RTC_DATA_ATTR textLayout textLayouts[TEXT_BOUNDS_CACHE];
+RTC_DATA_ATTR uint8_t textLayoutNext;
+
+// drawPackedBitmap(): the window and room for the longest token, slid back
+// when full
+static uint8_t packedHistory[2 * WatchyDisplay::PACKED_WINDOW];
+
+// CRC-16/CCITT-FALSE of each byte value
+static const uint16_t crcTable[256] PROGMEM = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0};
+
+static uint16_t crc16(const uint8_t *data, uint16_t length) {
+  uint16_t crc = 0xFFFF; // CRC-16/CCITT-FALSE
+  while (length--) {
+    crc = crc << 8 ^ pgm_read_word(&crcTable[(crc >> 8 ^ *data++) & 0xFF]);
+  }
+  return crc;
+}
+
+// The buffer in drawPackedBitmap()'s format, quicker to write than
+// packbitmap's exhaustive search: a match is only looked for one byte back,
+// one row up and at the last position that started with the same three
+// bytes. Returns the packed length, 0 if it does not fit in size bytes.
+static uint16_t packLayer(const uint8_t *frame, uint8_t *packed,
+                          uint16_t size) {
+  const uint16_t n = WatchyDisplay::BUFFER_SIZE;
+  uint16_t last[256]; // by hash of three bytes, position + 1, 0: none
+  memset(last, 0, sizeof(last));
+  if (size < 4) {
+    return 0;
+  }
+  packed[0] = WatchyDisplay::WIDTH & 0xFF;
+  packed[1] = WatchyDisplay::WIDTH >> 8;
+  packed[2] = WatchyDisplay::HEIGHT & 0xFF;
+  packed[3] = WatchyDisplay::HEIGHT >> 8;
+  uint16_t out = 4, literals = 0; // pending, ending at i
+  for (uint16_t i = 0; i <= n;) {
+    uint16_t best = 0, distance = 0;
+    if (i + 2 < n) {
+      uint8_t hash = frame[i] ^ frame[i + 1] << 3 ^ frame[i + 2] << 5;
+      uint16_t candidates[3] = {1, WatchyDisplay::WIDTH_BYTES,
+                                (uint16_t)(last[hash] ? i + 1 - last[hash] : 0)};
+      last[hash] = i + 1;
+      for (uint8_t c = 0; c < 3; c++) {
+        uint16_t d = candidates[c];
+        if (d == 0 || d > i || d > WatchyDisplay::PACKED_WINDOW) {
+          continue;
+        }
+        uint16_t length = 0;
+        while (length < 34 && i + length < n &&
+               frame[i + length] == frame[i + length - d]) {
+          length++;
+        }
+        if (length > best) {
+          best     = length;
+          distance = d;
+        }
+      }
+    }
+    if (best < 3 && i < n && literals < 128) {
+      literals++;
+      i++;
+      continue;
+    }
+    if (literals > 0) {
+      if (out + 1 + literals > size) {
+        return 0;
+      }
+      packed[out++] = literals - 1;
+      memcpy(packed + out, frame + i - literals, literals);
+      out += literals;
+      literals = 0;
+    }
+    if (i == n) {
+      break;
+    }
+    if (best >= 3) {
+      if (out + 2 > size) {
+        return 0;
+      }
+      packed[out++] = 0x80 | (best - 3) << 2 | (distance - 1) >> 8;
+      packed[out++] = (distance - 1) & 0xFF;
+      i += best;
+    }
+  }
+  return out;
+}
+
+// packLayer() undone straight into the frame, which is its own history.
+// Returns false if the tokens do not make up exactly one frame.
+static bool unpackLayer(const uint8_t *packed, uint16_t length,
+                        uint8_t *frame) {
+  const uint8_t *in  = packed + 4;
+  const uint8_t *end = packed + length;
+  uint16_t pos       = 0;
+  while (in < end) {
+    uint8_t token = *in++;
+    if (token < 0x80) {
+      uint8_t n = token + 1;
+      if (pos + n > WatchyDisplay::BUFFER_SIZE || in + n > end) {
+        return false;
+      }
+      memcpy(frame + pos, in, n);
+      in += n;
+      pos += n;
+    } else {
+      if (in == end) {
+        return false;
+      }
+      uint8_t n  = ((token >> 2) & 0x1F) + 3;
+      uint16_t d = ((token & 0x03) << 8 | *in++) + 1;
+      if (d > pos || pos + n > WatchyDisplay::BUFFER_SIZE) {
+        return false;
+      }
+      if (d == 1) {
+        memset(frame + pos, frame[pos - 1], n);
+        pos += n;
+        continue;
+      }
+      // at most d bytes at a time, the source may overlap what is written
+      while (n > 0) {
+        uint8_t chunk = n < d ? n : d;
+        memcpy(frame + pos, frame + pos - d, chunk);
+        pos += chunk;
+        n -= chunk;
+      }
+    }
+  }
+  return pos == WatchyDisplay::BUFFER_SIZE;
+}
+
+// rounds towards minus infinity, b > 0
+static inline int32_t floorDiv(int32_t a, int32_t b) {
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+// fillCircle(): Adafruit GFX fills the column x0 +-cx from y0 - ch to
+// y0 + ch, which makes the rows up to ch from y0 at least cx wide either
+// side. half[] keeps the widest column per ch for rows near..far, the rows
+// take the widest of the columns reaching them afterwards.
+static inline void circleColumn(int16_t *half, int16_t near, int16_t far,
+                                int16_t cx, int16_t ch) {
+  if (ch >= near) {
+    int16_t &w = half[min(ch, far) - near];
+    w          = max(w, cx);
+  }
+}
+
+#define _swap_int16(a, b)                                                      \
+  {                                                                            \
+    int16_t t = a;                                                             \
+    a         = b;                                                             \
+    b         = t;                                                             \
+  }
+
+WatchyDisplay::WatchyDisplay(GxEPD2_154_D67 epd2_instance)
+    : Adafruit_GFX(WIDTH, HEIGHT), epd2(epd2_instance), fullRefreshes(0),
+      partialRefreshes(0), _previousValid(false), _panelReady(false),
+      _mode(REFRESH_PARTIAL), _async(false), _startedRunning(false),
+      _fontSpritesCount(0), _spriteFont(NULL), _sprites(NULL),
+      _runFont(NULL) {
+  memset(_buffer, 0x00, sizeof(_buffer));
+  setFullWindow();
+}
+
+void WatchyDisplay::init(uint32_t serial_diag_bitrate, bool initial,
+                         uint16_t reset_duration, bool pulldown_rst_mode) {
+  // the panel is reset on first use, wakes that never draw leave it asleep
+  _diagBitrate   = serial_diag_bitrate;
+  _initial       = initial;
+  _resetDuration = reset_duration;
+  _pulldownRst   = pulldown_rst_mode;
+  _panelReady    = false;
+  if (initial) {
+    refreshRunning = false; // the panel is reset and redrawn from scratch
+  }
+  setFullWindow();
+}
+
+void WatchyDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+    return;
+  }
+  switch (getRotation()) {
+  case 1:
+    _swap_int16(x, y);
+    x = WIDTH - x - 1;
+    break;
+  case 2:
+    x = WIDTH - x - 1;
+    y = HEIGHT - y - 1;
+    break;
+  case 3:
+    _swap_int16(x, y);
+    y = HEIGHT - y - 1;
+    break;
+  }
+  if (_using_partial_mode &&
+      ((x < _pw_x) || (x >= _pw_x + _pw_w) || (y < _pw_y) ||
+       (y >= _pw_y + _pw_h))) {
+    return;
+  }
+  uint16_t i = x / 8 + y * WIDTH_BYTES;
+  if (color == GxEPD_WHITE) {
+    _buffer[i] |= (1 << (7 - x % 8));
+  } else {
+    _buffer[i] &= ~(1 << (7 - x % 8));
+  }
+}
+
+void WatchyDisplay::fillScreen(uint16_t color) {
+  if (_using_partial_mode) {
+    _fillRect(_pw_x, _pw_y, _pw_w, _pw_h, color);
+    return;
+  }
+  memset(_buffer, (color == GxEPD_WHITE) ? 0xFF : 0x00, sizeof(_buffer));
+}
+
+// Negative sizes extend left or up from x, y, as in GFXcanvas1
+void WatchyDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                  uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void WatchyDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                  uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void WatchyDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color) {
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  _rotate(x, y, w, h);
+  _fillRect(x, y, w, h, color);
+}
+
+// Bresenham as in Adafruit_GFX::writeLine(), clipped to the window first
+// and setting the pixels in place
+void WatchyDisplay::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                              uint16_t color) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::writeLine(x0, y0, x1, y1, color);
+    return;
+  }
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    _swap_int16(x0, y0);
+    _swap_int16(x1, y1);
+  }
+  if (x0 > x1) {
+    _swap_int16(x0, x1);
+    _swap_int16(y0, y1);
+  }
+  int16_t dx = x1 - x0, dy = abs(y1 - y0);
+  int16_t err = dx / 2, ystep = y0 < y1 ? 1 : -1;
+  // window bounds in the swapped coordinates
+  int16_t minX = steep ? _pw_y : _pw_x, maxX = minX + (steep ? _pw_h : _pw_w);
+  int16_t minY = steep ? _pw_x : _pw_y, maxY = minY + (steep ? _pw_w : _pw_h);
+  // Step k draws x0 + k at y0 + ystep * m, where m = ceil((k * dy - err) /
+  // dx) is the number of y steps so far. The steps inside the window on
+  // both axes are a range of k, found without walking up to it.
+  int32_t k0 = max(0, minX - x0), k1 = min((int)dx, maxX - 1 - x0);
+  int32_t m0 = ystep > 0 ? minY - y0 : y0 - (maxY - 1); // y steps in range
+  int32_t m1 = ystep > 0 ? maxY - 1 - y0 : y0 - minY;
+  if (dy == 0) {
+    if (m0 > 0 || m1 < 0) {
+      return;
+    }
+  } else {
+    k0 = max(k0, floorDiv((m0 - 1) * dx + err, dy) + 1);
+    k1 = min(k1, floorDiv(m1 * dx + err, dy));
+  }
+  if (k0 > k1) {
+    return;
+  }
+  int32_t m = dx == 0 ? 0 : (k0 * dy - err + dx - 1) / dx;
+  err       = err - k0 * dy + m * dx;
+  y0 += ystep * m;
+  bool white = color == GxEPD_WHITE;
+  for (int16_t x = x0 + k0; x <= x0 + k1; x++) {
+    int16_t px = steep ? y0 : x, py = steep ? x : y0;
+    uint16_t i  = py * WIDTH_BYTES + px / 8;
+    uint8_t bit = 0x80 >> (px % 8);
+    _buffer[i]  = white ? _buffer[i] | bit : _buffer[i] & ~bit;
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void WatchyDisplay::drawCircle(int16_t x0, int16_t y0, int16_t r,
+                               uint16_t color) {
+  if (r < 0 || x0 + r < 0 || x0 - r >= width() || y0 + r < 0 ||
+      y0 - r >= height()) {
+    return;
+  }
+  // the outline keeps within a pixel of r, so a screen inside r - 1 misses it
+  int32_t fx = max(abs(x0), abs(width() - 1 - x0));
+  int32_t fy = max(abs(y0), abs(height() - 1 - y0));
+  if (fx * fx + fy * fy < (int32_t)(r - 1) * (r - 1)) {
+    return;
+  }
+  // Adafruit_GFX::drawCircle() without the virtual calls
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  WatchyDisplay::drawPixel(x0, y0 + r, color);
+  WatchyDisplay::drawPixel(x0, y0 - r, color);
+  WatchyDisplay::drawPixel(x0 + r, y0, color);
+  WatchyDisplay::drawPixel(x0 - r, y0, color);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    WatchyDisplay::drawPixel(x0 + x, y0 + y, color);
+    WatchyDisplay::drawPixel(x0 - x, y0 + y, color);
+    WatchyDisplay::drawPixel(x0 + x, y0 - y, color);
+    WatchyDisplay::drawPixel(x0 - x, y0 - y, color);
+    WatchyDisplay::drawPixel(x0 + y, y0 + x, color);
+    WatchyDisplay::drawPixel(x0 - y, y0 + x, color);
+    WatchyDisplay::drawPixel(x0 + y, y0 - x, color);
+    WatchyDisplay::drawPixel(x0 - y, y0 - x, color);
+  }
+}
+
+void WatchyDisplay::fillCircle(int16_t x0, int16_t y0, int16_t r,
+                               uint16_t color) {
+  if (getRotation() != 0 || r < 0) {
+    Adafruit_GFX::fillCircle(x0, y0, r, color);
+    return;
+  }
+  int16_t top    = max((int16_t)(y0 - r), _pw_y);
+  int16_t bottom = min((int16_t)(y0 + r), (int16_t)(_pw_y + _pw_h - 1));
+  if (top > bottom || x0 + r < _pw_x || x0 - r >= _pw_x + _pw_w) {
+    return;
+  }
+  // half widths of the rows top..bottom, by distance from y0
+  int16_t near = top <= y0 && y0 <= bottom ? 0 : min(abs(top - y0),
+                                                     abs(bottom - y0));
+  int16_t far  = max(abs(top - y0), abs(bottom - y0));
+  int16_t half[HEIGHT];
+  for (int16_t d = near; d <= far; d++) {
+    half[d - near] = -1;
+  }
+  // Adafruit_GFX::fillCircleHelper(), columns become row widths
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+  circleColumn(half, near, far, 0, r);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < y + 1) {
+      circleColumn(half, near, far, x, y);
+    }
+    if (y != py) {
+      circleColumn(half, near, far, py, px);
+      py = y;
+    }
+    px = x;
+  }
+  for (int16_t d = far - 1; d >= near; d--) {
+    half[d - near] = max(half[d - near], half[d + 1 - near]);
+  }
+  for (int16_t row = top; row <= bottom; row++) {
+    int16_t w = half[abs(row - y0) - near];
+    if (w >= 0) {
+      _fillRect(x0 - w, row, 2 * w + 1, 1, color);
+    }
+  }
+}
+
+// Adafruit_GFX::fillTriangle(), the row spans' ends are linear in y, so the
+// rows above and below the screen are skipped instead of stepped through
+void WatchyDisplay::fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                 int16_t y1, int16_t x2, int16_t y2,
+                                 uint16_t color) {
+  if (y0 > y1) {
+    _swap_int16(y0, y1);
+    _swap_int16(x0, x1);
+  }
+  if (y1 > y2) {
+    _swap_int16(y2, y1);
+    _swap_int16(x2, x1);
+  }
+  if (y0 > y1) {
+    _swap_int16(y0, y1);
+    _swap_int16(x0, x1);
+  }
+  if (y2 < 0 || y0 >= height() || max(x0, max(x1, x2)) < 0 ||
+      min(x0, min(x1, x2)) >= width()) {
+    return;
+  }
+  if (y0 == y2) {
+    Adafruit_GFX::fillTriangle(x0, y0, x1, y1, x2, y2, color);
+    return;
+  }
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0;
+  int16_t dx12 = x2 - x1, dy12 = y2 - y1;
+  int16_t last   = y1 == y2 ? y1 : y1 - 1; // last row of the upper part
+  int16_t top    = max(y0, (int16_t)0);
+  int16_t bottom = min(y2, (int16_t)(height() - 1));
+  for (int16_t y = top; y <= bottom; y++) {
+    int16_t a = y <= last ? x0 + (int32_t)dx01 * (y - y0) / dy01
+                          : x1 + (int32_t)dx12 * (y - y1) / dy12;
+    int16_t b = x0 + (int32_t)dx02 * (y - y0) / dy02;
+    if (a > b) {
+      _swap_int16(a, b);
+    }
+    drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                               int16_t w, int16_t h, uint16_t color) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+    return;
+  }
+  _blit(x, y, bitmap, w, h, color, false, color);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                               int16_t w, int16_t h, uint16_t color,
+                               uint16_t bg) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+    return;
+  }
+  _blit(x, y, bitmap, w, h, color, true, bg);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+                               int16_t w, int16_t h, uint16_t color) {
+  drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+                               int16_t w, int16_t h, uint16_t color,
+                               uint16_t bg) {
+  drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color, bg);
+}
+
+void WatchyDisplay::setFont(const GFXfont *f) {
+  Adafruit_GFX::setFont(f);
+  _runFont = NULL;
+}
+
+void WatchyDisplay::setFont(const runFont *f) {
+  Adafruit_GFX::setFont(f ? &f->font : NULL);
+  _runFont = f;
+}
+
+size_t WatchyDisplay::write(uint8_t c) {
+  if (_runFont == NULL && gfxFont != _spriteFont) {
+    _spriteFont = gfxFont;
+    _sprites    = gfxFont ? _findSprites(gfxFont) : NULL;
+  }
+  if (_runFont == NULL && _sprites != NULL && c >= _sprites->first &&
+      c <= _sprites->last && textsize_x == 1 && textsize_y == 1 &&
+      getRotation() == 0) {
+    // same cursor handling as Adafruit_GFX::write()
+    const GFXfont *font   = _sprites->font;
+    const GFXglyph *glyph = font->glyph + (c - pgm_read_word(&font->first));
+    uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+    if (w > 0 && h > 0) {
+      int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+      int16_t yo = (int8_t)pgm_read_byte(&glyph->yOffset);
+      if (wrap && cursor_x + xo + w > _width) {
+        cursor_x = 0;
+        cursor_y += (uint8_t)pgm_read_byte(&font->yAdvance);
+      }
+      uint16_t offset = pgm_read_word(&_sprites->offset[c - _sprites->first]);
+      _blit(cursor_x + xo, cursor_y + yo, _sprites->bitmap + offset, w, h,
+            textcolor, false, textcolor);
+    }
+    cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance);
+    return 1;
+  }
+  if (gfxFont == NULL) {
+    return Adafruit_GFX::write(c); // the built-in 5x7 font
+  }
+  // same cursor handling as Adafruit_GFX::write()
+  const GFXfont *font = gfxFont;
+  uint8_t yAdvance    = pgm_read_byte(&font->yAdvance);
+  uint16_t first      = pgm_read_word(&font->first);
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += (int16_t)textsize_y * yAdvance;
+    return 1;
+  }
+  if (c == '\r' || c < first || c > pgm_read_word(&font->last)) {
+    return 1;
+  }
+  const GFXglyph *glyph = font->glyph + (c - first);
+  uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+  if (w > 0 && h > 0) {
+    int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+    if (wrap && cursor_x + textsize_x * (xo + w) > _width) {
+      cursor_x = 0;
+      cursor_y += (int16_t)textsize_y * yAdvance;
+    }
+    const uint8_t *bitmap = font->bitmap + pgm_read_word(&glyph->bitmapOffset);
+    if (_runFont != NULL) {
+      _drawRuns(cursor_x, cursor_y, glyph, bitmap);
+    } else {
+      _drawBits(cursor_x, cursor_y, glyph, bitmap);
+    }
+  }
+  cursor_x += (uint8_t)pgm_read_byte(&glyph->xAdvance) * (int16_t)textsize_x;
+  return 1;
+}
+
+// Strings too long to keep are measured every time
+textBounds WatchyDisplay::measureText(const char *str) {
+  uint32_t hash = 2166136261u;
+  size_t length = 0;
+  for (; str[length] != '\0'; length++) {
+    hash = (hash ^ (uint8_t)str[length]) * 16777619u;
+  }
+  textBounds bounds = {0, 0, 0, 0};
+  if (length == 0) {
+    return bounds;
+  }
+  bool kept = length < TEXT_BOUNDS_LENGTH;
+  for (uint8_t i = 0; kept && i < TEXT_BOUNDS_CACHE; i++) {
+    const textLayout &known = textLayouts[i];
+    if (known.hash == hash && known.font == gfxFont &&
+        known.sizeX == textsize_x && known.sizeY == textsize_y &&
+        strcmp(known.text, str) == 0) {
+      return known.bounds;
+    }
+  }
+  bool wrapping = wrap;
+  wrap          = false;
+  getTextBounds(str, 0, 0, &bounds.x, &bounds.y, &bounds.w, &bounds.h);
+  wrap = wrapping;
+  if (kept) {
+    textLayout &entry = textLayouts[textLayoutNext];
+    entry.font        = gfxFont;
+    entry.hash        = hash;
+    entry.sizeX       = textsize_x;
+    entry.sizeY       = textsize_y;
+    memcpy(entry.text, str, length + 1);
+    entry.bounds   = bounds;
+    textLayoutNext = (textLayoutNext + 1) % TEXT_BOUNDS_CACHE;
+  }
+  return bounds;
+}
+
+void WatchyDisplay::drawText(int16_t x, int16_t y, const char *str,
+                             TextAlign align) {
+  if (align != ALIGN_LEFT) {
+    uint16_t w = measureText(str).w;
+    x -= align == ALIGN_CENTER ? w / 2 : w;
+  }
+  bool wrapping = wrap;
+  wrap          = false;
+  setCursor(x, y);
+  print(str);
+  wrap = wrapping;
+}
+
+// Ink of a GFX glyph, its bits running on from row to row as drawChar()
+// reads them. At text size 1 and rotation 0 each bit goes straight into the
+// buffer, otherwise a span is filled per run of ink.
+void WatchyDisplay::_drawBits(int16_t x, int16_t y, const GFXglyph *glyph,
+                              const uint8_t *bitmap) {
+  uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+  x += (int8_t)pgm_read_byte(&glyph->xOffset) * textsize_x;
+  y += (int8_t)pgm_read_byte(&glyph->yOffset) * textsize_y;
+  uint16_t bit = 0;
+  uint8_t bits = 0;
+  if (textsize_x == 1 && textsize_y == 1 && getRotation() == 0) {
+    bool white = textcolor == GxEPD_WHITE;
+    for (int16_t row = y; row < y + h; row++) {
+      uint8_t *p   = _buffer + row * WIDTH_BYTES;
+      bool visible = row >= _pw_y && row < _pw_y + _pw_h;
+      for (int16_t col = x; col < x + w; col++, bit++) {
+        if ((bit & 7) == 0) {
+          bits = pgm_read_byte(bitmap + bit / 8);
+        }
+        if ((bits & 0x80) && visible && col >= _pw_x && col < _pw_x + _pw_w) {
+          uint8_t mask = 0x80 >> (col & 7);
+          p[col / 8]   = white ? p[col / 8] | mask : p[col / 8] & ~mask;
+        }
+        bits <<= 1;
+      }
+    }
+    return;
+  }
+  for (uint8_t row = 0; row < h; row++) {
+    int16_t top   = y + row * textsize_y;
+    uint8_t start = 0, span = 0;
+    for (uint8_t col = 0; col < w; col++, bit++) {
+      if ((bit & 7) == 0) {
+        bits = pgm_read_byte(bitmap + bit / 8);
+      }
+      if (bits & 0x80) {
+        start = span > 0 ? start : col;
+        span++;
+      } else if (span > 0) {
+        _fillSpan(x + start * textsize_x, top, span * textsize_x, textsize_y);
+        span = 0;
+      }
+      bits <<= 1;
+    }
+    if (span > 0) {
+      _fillSpan(x + start * textsize_x, top, span * textsize_x, textsize_y);
+    }
+  }
+}
+
+// Ink of a run or GFX glyph: panel coordinates at rotation 0, textsize_y
+// pixels high per glyph row
+void WatchyDisplay::_fillSpan(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (getRotation() == 0) {
+    _fillRect(x, y, w, h, textcolor);
+  } else {
+    fillRect(x, y, w, h, textcolor);
+  }
+}
+
+// The stored quarter covers 12 to 3 o'clock. 3 to 6 o'clock is it mirrored
+// top to bottom, the second half of the turn the first mirrored left to
+// right. Equal rows are filled together.
+void WatchyDisplay::drawHand(int16_t x, int16_t y, const handSprites *hand,
+                             uint16_t position, uint16_t color) {
+  uint16_t steps = hand->steps;
+  position %= steps;
+  bool flipX = position > steps / 2;
+  if (flipX) {
+    position = steps - position;
+  }
+  bool flipY = position > steps / 4;
+  if (flipY) {
+    position = steps / 2 - position;
+  }
+  const uint8_t *sprite =
+      hand->spans + pgm_read_word(&hand->offset[position]);
+  int8_t top   = pgm_read_byte(sprite++);
+  uint8_t rows = pgm_read_byte(sprite++);
+  for (uint8_t i = 0; i < rows;) {
+    int8_t left = pgm_read_byte(sprite);
+    uint8_t w   = pgm_read_byte(sprite + 1);
+    uint8_t n   = 1; // equal rows, one fill
+    while (i + n < rows && pgm_read_byte(sprite + 2 * n) == (uint8_t)left &&
+           pgm_read_byte(sprite + 2 * n + 1) == w) {
+      n++;
+    }
+    sprite += 2 * n;
+    int16_t row = flipY ? -(top + i + n - 1) : top + i;
+    i += n;
+    if (w == 0) {
+      continue;
+    }
+    int16_t sx = x + (flipX ? -left - w + 1 : left);
+    if (getRotation() == 0) {
+      _fillRect(sx, y + row, w, n, color);
+    } else {
+      fillRect(sx, y + row, w, n, color);
+    }
+  }
+}
+
+// Draws a glyph of a run font at the cursor x, y. Each ink run is one fill
+// over all the equal rows of its group, scaled by the text size as
+// Adafruit_GFX::drawChar() scales pixels. Runs split across pair bytes are
+// joined first.
+void WatchyDisplay::_drawRuns(int16_t x, int16_t y, const GFXglyph *glyph,
+                              const uint8_t *runs) {
+  uint8_t h = pgm_read_byte(&glyph->height);
+  x += (int8_t)pgm_read_byte(&glyph->xOffset) * textsize_x;
+  y += (int8_t)pgm_read_byte(&glyph->yOffset) * textsize_y;
+  for (uint8_t row = 0; row < h;) {
+    uint8_t group = pgm_read_byte(runs++);
+    uint8_t pairs = group >> 4, rows = (group & 0x0F) + 1;
+    int16_t top = y + row * textsize_y, height = rows * textsize_y;
+    uint8_t col = 0, start = 0, span = 0; // ink from start, not filled yet
+    for (; pairs > 0; pairs--) {
+      uint8_t pair  = pgm_read_byte(runs++);
+      uint8_t clear = pair >> 4, ink = pair & 0x0F;
+      if (span > 0 && clear > 0) {
+        _fillSpan(x + start * textsize_x, top, span * textsize_x, height);
+        span = 0;
+      }
+      col += clear;
+      start = span > 0 ? start : col;
+      span += ink;
+      col += ink;
+    }
+    if (span > 0) {
+      _fillSpan(x + start * textsize_x, top, span * textsize_x, height);
+    }
+    row += rows;
+  }
+}
+
+bool WatchyDisplay::addFontSprites(const fontSprites *sprites) {
+  for (uint8_t i = 0; i < _fontSpritesCount; i++) {
+    if (_fontSprites[i] == sprites) {
+      return true;
+    }
+  }
+  if (_fontSpritesCount == MAX_FONT_SPRITES) {
+    return false;
+  }
+  _fontSprites[_fontSpritesCount++] = sprites;
+  _spriteFont                       = NULL; // look up again
+  return true;
+}
+
+// Font headers define their arrays const, so every file that includes one
+// has its own copy: fonts are matched by their glyphs, not by address.
+const fontSprites *WatchyDisplay::_findSprites(const GFXfont *font) {
+  for (uint8_t i = 0; i < _fontSpritesCount; i++) {
+    const fontSprites *sprites = _fontSprites[i];
+    const GFXfont *known       = sprites->font;
+    if (font == known) {
+      return sprites;
+    }
+    if (font->first != known->first || font->last != known->last ||
+        font->yAdvance != known->yAdvance) {
+      continue;
+    }
+    bool same = true;
+    for (uint16_t c = sprites->first; same && c <= sprites->last; c++) {
+      const GFXglyph *a = font->glyph + (c - font->first);
+      const GFXglyph *b = known->glyph + (c - known->first);
+      same = memcmp(a, b, sizeof(GFXglyph)) == 0 &&
+             memcmp(font->bitmap + b->bitmapOffset,
+                    known->bitmap + b->bitmapOffset,
+                    (b->width * b->height + 7) / 8) == 0;
+    }
+    if (same) {
+      return sprites;
+    }
+  }
+  return NULL;
+}
+
+// Fills a panel-oriented rectangle, clipped to the window: edge masks for
+// the partial bytes at either end of each row, memset for the rest
+void WatchyDisplay::_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                              uint16_t color) {
+  int16_t x1 = min((int16_t)(x + w), (int16_t)(_pw_x + _pw_w));
+  int16_t y1 = min((int16_t)(y + h), (int16_t)(_pw_y + _pw_h));
+  x          = max(x, _pw_x);
+  y          = max(y, _pw_y);
+  if (x >= x1 || y >= y1) {
+    return;
+  }
+  int16_t b0 = x / 8, b1 = (x1 - 1) / 8;
+  uint8_t m0 = 0xFF >> (x % 8), m1 = 0xFF << (7 - (x1 - 1) % 8);
+  if (b0 == b1) {
+    m0 &= m1;
+  }
+  uint8_t fill = color == GxEPD_WHITE ? 0xFF : 0x00;
+  for (int16_t row = y; row < y1; row++) {
+    uint8_t *p = _buffer + row * WIDTH_BYTES;
+    p[b0]      = (p[b0] & ~m0) | (fill & m0);
+    if (b1 > b0) {
+      memset(p + b0 + 1, fill, b1 - b0 - 1);
+      p[b1] = (p[b1] & ~m1) | (fill & m1);
+    }
+  }
+}
+
+// Draws a 1bpp bitmap ((w + 7) / 8 bytes per row, MSB leftmost) at a panel
+// position: set bits in color, clear bits in bg if opaque. Rows are shifted
+// into place a byte at a time and merged under a mask of the covered
+// pixels, byte-aligned opaque rows are copied. The window is whole bytes
+// wide, so clipping whole bytes is exact.
+void WatchyDisplay::_blit(int16_t x, int16_t y, const uint8_t *bitmap,
+                          int16_t w, int16_t h, uint16_t color, bool opaque,
+                          uint16_t bg) {
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  int16_t rowBytes = (w + 7) / 8;
+  uint8_t lastMask = 0xFF << ((8 - w % 8) % 8);
+  uint8_t shift    = x & 7;
+  int16_t bx       = (x - shift) / 8;
+  int16_t wb0      = _pw_x / 8;
+  int16_t wb1      = (_pw_x + _pw_w) / 8;
+  int16_t y0       = max(y, _pw_y);
+  int16_t y1       = min((int16_t)(y + h), (int16_t)(_pw_y + _pw_h));
+  bool white       = color == GxEPD_WHITE;
+  bool bgWhite     = bg == GxEPD_WHITE;
+  bool copy        = opaque && white && !bgWhite && shift == 0 &&
+              w % 8 == 0 && bx >= wb0 && bx + rowBytes <= wb1;
+  for (int16_t row = y0; row < y1; row++) {
+    const uint8_t *src = bitmap + (row - y) * rowBytes;
+    uint8_t *dst       = _buffer + row * WIDTH_BYTES;
+    if (copy) {
+      memcpy_P(dst + bx, src, rowBytes);
+      continue;
+    }
+    uint8_t carry = 0, carryMask = 0;
+    for (int16_t i = 0; i < rowBytes + (shift != 0); i++) {
+      uint8_t bits = 0, mask = 0;
+      if (i < rowBytes) {
+        mask = i == rowBytes - 1 ? lastMask : 0xFF;
+        bits = pgm_read_byte(src + i) & mask;
+      }
+      uint8_t ink   = carry | (bits >> shift);
+      uint8_t cover = carryMask | (mask >> shift);
+      carry         = shift ? bits << (8 - shift) : 0;
+      carryMask     = shift ? mask << (8 - shift) : 0;
+      int16_t b     = bx + i;
+      if (b < wb0 || b >= wb1) {
+        continue;
+      }
+      if (opaque) {
+        uint8_t on = (white ? ink : 0) | (bgWhite ? cover & ~ink : 0);
+        dst[b]     = (dst[b] & ~cover) | on;
+      } else if (white) {
+        dst[b] |= ink;
+      } else {
+        dst[b] &= ~ink;
+      }
+    }
+  }
+}
+
+void WatchyDisplay::drawPackedBitmap(int16_t x, int16_t y,
+                                     const uint8_t *packed, uint16_t color) {
+  _drawPacked(x, y, packed, color, false, color);
+}
+
+void WatchyDisplay::drawPackedBitmap(int16_t x, int16_t y,
+                                     const uint8_t *packed, uint16_t color,
+                                     uint16_t bg) {
+  _drawPacked(x, y, packed, color, true, bg);
+}
+
+void WatchyDisplay::_drawPacked(int16_t x, int16_t y, const uint8_t *packed,
+                                uint16_t color, bool opaque, uint16_t bg) {
+  int16_t w = pgm_read_byte(packed) | pgm_read_byte(packed + 1) << 8;
+  int16_t h = pgm_read_byte(packed + 2) | pgm_read_byte(packed + 3) << 8;
+  if (w <= 0 || w > WIDTH || h <= 0) {
+    return;
+  }
+  const uint8_t *in = packed + 4;
+  uint8_t rowBytes  = (w + 7) / 8;
+  uint16_t pos = 0, rowStart = 0; // in packedHistory
+  // A full-width image inside the window is contiguous in the buffer, each
+  // token is blended as it is decoded instead of row by row
+  bool stream = getRotation() == 0 && x == 0 && w == WIDTH && _pw_x == 0 &&
+                _pw_w == WIDTH && y >= _pw_y && y + h <= _pw_y + _pw_h;
+  uint8_t *dst = _buffer + y * WIDTH_BYTES;
+  uint8_t *end = dst + h * WIDTH_BYTES;
+  bool white   = color == GxEPD_WHITE;
+  bool bgWhite = bg == GxEPD_WHITE;
+  for (int16_t row = 0; row < h;) {
+    if (pos > sizeof(packedHistory) - 128) {
+      // the unfinished row is shorter than the window, so it is kept too
+      memmove(packedHistory, packedHistory + pos - PACKED_WINDOW,
+              PACKED_WINDOW);
+      rowStart -= pos - PACKED_WINDOW;
+      pos = PACKED_WINDOW;
+    }
+    uint16_t start = pos;
+    uint8_t token  = pgm_read_byte(in++);
+    if (token < 0x80) {
+      memcpy_P(packedHistory + pos, in, token + 1);
+      in += token + 1;
+      pos += token + 1;
+    } else {
+      uint8_t n  = ((token >> 2) & 0x1F) + 3;
+      uint16_t d = ((token & 0x03) << 8 | pgm_read_byte(in++)) + 1;
+      if (d > pos) {
+        return; // corrupt
+      }
+      for (; n > 0; n--, pos++) {
+        packedHistory[pos] = packedHistory[pos - d];
+      }
+    }
+    if (stream) {
+      const uint8_t *ink = packedHistory + start;
+      uint16_t n         = min((int)(pos - start), (int)(end - dst));
+      if (opaque) {
+        for (uint16_t i = 0; i < n; i++) {
+          dst[i] = (white ? ink[i] : 0) | (bgWhite ? ~ink[i] : 0);
+        }
+      } else if (white) {
+        for (uint16_t i = 0; i < n; i++) {
+          dst[i] |= ink[i];
+        }
+      } else {
+        for (uint16_t i = 0; i < n; i++) {
+          dst[i] &= ~ink[i];
+        }
+      }
+      dst += n;
+      if (dst == end) {
+        return;
+      }
+      continue;
+    }
+    for (; row < h && pos - rowStart >= rowBytes; row++) {
+      const uint8_t *bits = packedHistory + rowStart;
+      if (getRotation() != 0) {
+        if (opaque) {
+          Adafruit_GFX::drawBitmap(x, y + row, bits, w, 1, color, bg);
+        } else {
+          Adafruit_GFX::drawBitmap(x, y + row, bits, w, 1, color);
+        }
+      } else {
+        _blit(x, y + row, bits, w, 1, color, opaque, bg);
+      }
+      rowStart += rowBytes;
+    }
+  }
+}
+
+void WatchyDisplay::setFullWindow() {
+  _using_partial_mode = false;
+  _pw_x               = 0;
+  _pw_y               = 0;
+  _pw_w               = WIDTH;
+  _pw_h               = HEIGHT;
+}
+
+void WatchyDisplay::setPartialWindow(int16_t x, int16_t y, int16_t w,
+                                     int16_t h) {
+  _rotate(x, y, w, h);
+  if (!_clipWindow(x, y, w, h)) {
+    return;
+  }
+  _using_partial_mode = true;
+  _pw_x               = x;
+  _pw_y               = y;
+  _pw_w               = w;
+  _pw_h               = h;
+}
+
+void WatchyDisplay::display(bool partial_update_mode) {
+  _wakePanel();
+  frameStoreLength = 0; // the panel no longer shows the stored frame
+  if (_using_partial_mode) {
+    // window coordinates are already in panel orientation
+    epd2.writeWindow(WatchyPanel::RAM_CURRENT, _buffer, _pw_x, _pw_y, _pw_w,
+                     _pw_h);
+    bool running = _refreshPanel(true, _pw_x, _pw_y, _pw_w, _pw_h,
+                                 _countChanges(_pw_x, _pw_y, _pw_w, _pw_h));
+    if (epd2.hasFastPartialUpdate && !running) {
+      _writeAgain(_pw_x, _pw_y, _pw_w, _pw_h);
+    }
+    _keepWindow(_pw_x, _pw_y, _pw_w, _pw_h);
+    return;
+  }
+  if (!partial_update_mode) {
+    epd2.writeWindow(WatchyPanel::RAM_PREVIOUS, _buffer, 0, 0, WIDTH, HEIGHT);
+  }
+  epd2.writeWindow(WatchyPanel::RAM_CURRENT, _buffer, 0, 0, WIDTH, HEIGHT);
+  bool running =
+      _refreshPanel(partial_update_mode, 0, 0, WIDTH, HEIGHT,
+                    partial_update_mode ? _countChanges(0, 0, WIDTH, HEIGHT)
+                                        : 0);
+  if (epd2.hasFastPartialUpdate && !running) {
+    // keep the controller's previous image in sync for the next differential
+    // update
+    _writeAgain(0, 0, WIDTH, HEIGHT);
+  }
+  if (!partial_update_mode && !running) {
+    epd2.powerOff();
+  }
+  memcpy(_previous, _buffer, sizeof(_buffer));
+  _previousValid = true;
+}
+
+void WatchyDisplay::displayWindow(int16_t x, int16_t y, int16_t w,
+                                  int16_t h) {
+  _rotate(x, y, w, h);
+  if (!_clipWindow(x, y, w, h)) {
+    return;
+  }
+  _wakePanel();
+  frameStoreLength = 0;
+  epd2.writeWindow(WatchyPanel::RAM_CURRENT, _buffer, x, y, w, h);
+  _refreshPanel(true, x, y, w, h, _countChanges(x, y, w, h));
+  if (epd2.hasFastPartialUpdate) {
+    _writeAgain(x, y, w, h);
+  }
+  _keepWindow(x, y, w, h);
+}
+
+bool WatchyDisplay::displayChanges() {
+  if (!_previousValid) {
+    _previousValid = _restoreFrame();
+  }
+  if (!_previousValid || _using_partial_mode || inversionPending) {
+    display(true); // a full refresh while the polarity changes
+    return true;
+  }
+  // boxes in bytes (x) and rows (y), inclusive
+  int16_t bx0[MAX_DIRTY_BOXES], bx1[MAX_DIRTY_BOXES];
+  int16_t by0[MAX_DIRTY_BOXES], by1[MAX_DIRTY_BOXES];
+  uint8_t boxes  = 0;
+  uint32_t flips = 0;
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    const uint8_t *row  = _buffer + y * WIDTH_BYTES;
+    const uint8_t *prev = _previous + y * WIDTH_BYTES;
+    if (memcmp(row, prev, WIDTH_BYTES) == 0) {
+      continue;
+    }
+    int16_t x0 = 0, x1 = WIDTH_BYTES - 1;
+    while (row[x0] == prev[x0]) {
+      x0++;
+    }
+    while (row[x1] == prev[x1]) {
+      x1--;
+    }
+    for (int16_t x = x0; x <= x1; x++) {
+      flips += __builtin_popcount(row[x] ^ prev[x]);
+    }
+    uint8_t b = boxes;
+    if (boxes > 0 && (y - by1[boxes - 1] <= DIFF_MERGE_ROWS ||
+                      boxes == MAX_DIRTY_BOXES)) {
+      b = boxes - 1; // extend the last box
+    } else {
+      boxes++;
+      bx0[b] = x0;
+      bx1[b] = x1;
+      by0[b] = y;
+    }
+    bx0[b] = min(bx0[b], x0);
+    bx1[b] = max(bx1[b], x1);
+    by1[b] = y;
+  }
+  if (boxes == 0) {
+    return false;
+  }
+  _wakePanel();
+  frameStoreLength = 0;
+  int16_t ux0 = bx0[0], ux1 = bx1[0];
+  for (uint8_t b = 0; b < boxes; b++) {
+    int16_t x = bx0[b] * 8, y = by0[b];
+    int16_t w = (bx1[b] - bx0[b] + 1) * 8, h = by1[b] - by0[b] + 1;
+    epd2.writeWindow(WatchyPanel::RAM_CURRENT, _buffer, x, y, w, h);
+    ux0 = min(ux0, bx0[b]);
+    ux1 = max(ux1, bx1[b]);
+  }
+  // one refresh for all boxes, the waveform takes as long for any size
+  bool running = _refreshPanel(true, ux0 * 8, by0[0], (ux1 - ux0 + 1) * 8,
+                               by1[boxes - 1] - by0[0] + 1, flips);
+  for (uint8_t b = 0; b < boxes; b++) {
+    int16_t x = bx0[b] * 8, y = by0[b];
+    int16_t w = (bx1[b] - bx0[b] + 1) * 8, h = by1[b] - by0[b] + 1;
+    if (epd2.hasFastPartialUpdate && !running) {
+      _writeAgain(x, y, w, h);
+    }
+    _keepWindow(x, y, w, h);
+  }
+  return true;
+}
+
+void WatchyDisplay::refresh(uint32_t now) {
+  uint32_t day    = _cleanDay(now);
+  bool full       = (_fullRefreshDue(day) || inversionPending) &&
+                    !_using_partial_mode;
+  // the day's clean refresh is done by a full one, or not needed on a clean
+  // panel. One skipped in a partial window waits for the full window.
+  if (day != 0 && (full || cleanDay == 0 || ghostPixelCount == 0)) {
+    cleanDay = day;
+  }
+  uint16_t waveMs = epd2.partial_refresh_time;
+  if (full || _mode == REFRESH_FULL) {
+    waveMs = epd2.full_refresh_time;
+  } else if (_mode == REFRESH_FAST) {
+    waveMs = epd2.fast_refresh_time;
+  }
+  uint16_t async  = refreshSettings.asyncMs;
+  _async          = async > 0 && waveMs >= async;
+  if (full) {
+    display(false);
+  } else {
+    displayChanges();
+  }
+  _async = false;
+}
+
+void WatchyDisplay::wake() {
+  _wakePanel();
+  epd2.powerUp();
+}
+
+uint32_t WatchyDisplay::refreshRunningUs() {
+  if (!_startedRunning || !refreshRunning) {
+    return 0;
+  }
+  int32_t left = _runningUntil - micros();
+  return left > 0 ? left : 0;
+}
+
+void WatchyDisplay::setRefreshMode(RefreshMode mode) { _mode = mode; }
+
+WatchyDisplay::RefreshMode WatchyDisplay::getRefreshMode() { return _mode; }
+
+uint32_t WatchyDisplay::refreshTime(RefreshMode mode) {
+  return refreshTimes[mode];
+}
+
+void WatchyDisplay::setRefreshPolicy(const refreshPolicy &policy) {
+  refreshSettings = policy;
+  cleanDay        = 0;
+}
+
+const refreshPolicy &WatchyDisplay::getRefreshPolicy() {
+  return refreshSettings;
+}
+
+void WatchyDisplay::setInverted(bool inverted) {
+  if (inverted == panelInverted) {
+    return;
+  }
+  panelInverted    = inverted;
+  inversionPending = true; // every pixel flips, not only the changed ones
+  epd2.setInverted(inverted);
+}
+
+bool WatchyDisplay::getInverted() { return panelInverted; }
+
+uint32_t WatchyDisplay::ghostPixels() { return ghostPixelCount; }
+
+uint16_t WatchyDisplay::ghostRefreshes() { return ghostRefreshCount; }
+
+// Days are counted from cleanHour, so the first timed refresh in a new one
+// is the first from cleanHour on. 0: the time is unknown, there is no daily
+// full refresh, or cleanHour has not come yet.
+uint32_t WatchyDisplay::_cleanDay(uint32_t now) {
+  uint8_t hour    = refreshSettings.cleanHour;
+  uint32_t offset = hour * 3600UL;
+  if (now == 0 || hour >= 24 || now < offset) {
+    return 0;
+  }
+  return (now - offset) / 86400UL + 1;
+}
+
+bool WatchyDisplay::_fullRefreshDue(uint32_t day) {
+  const refreshPolicy &p = refreshSettings;
+  return ghostPixelCount == GHOST_UNKNOWN ||
+         (p.maxPixels > 0 && ghostPixelCount >= p.maxPixels) ||
+         (p.maxPartials > 0 && ghostRefreshCount >= p.maxPartials) ||
+         (day != 0 && cleanDay != 0 && day != cleanDay && ghostPixelCount > 0);
+}
+
+void WatchyDisplay::hibernate() {
+  if (refreshRunning) {
+    _wakePanel(); // waits for the refresh
+  }
+  if (_panelReady) {
+    epd2.hibernate();
+    _panelReady = false;
+  }
+}
+
+void WatchyDisplay::powerOff() {
+  if (_panelReady) {
+    epd2.powerOff();
+  }
+}
+
+// After a refresh the controller's previous RAM is brought up to the frame
+// shown, as GxEPD2's write...Again() do, for the next differential refresh
+void WatchyDisplay::_writeAgain(int16_t x, int16_t y, int16_t w, int16_t h) {
+  epd2.writeWindow(WatchyPanel::RAM_PREVIOUS, _buffer, x, y, w, h);
+  epd2.writeWindow(WatchyPanel::RAM_CURRENT, _buffer, x, y, w, h);
+}
+
+// epd2.refresh() of the window with the refresh mode's waveform, or of the
+// whole panel in mode 1 if not partial or after setInverted(), counted with
+// the pixels it flips.
+// From refresh() the refresh is only started, and true returned: the
+// controller's RAM is then caught up by _finishRefresh(). A full refresh
+// leaves both RAMs holding the frame, a partial one the previous RAM behind.
+bool WatchyDisplay::_refreshPanel(bool partial, int16_t x, int16_t y,
+                                  int16_t w, int16_t h, uint32_t flips) {
+  partial = partial && _mode != REFRESH_FULL && !inversionPending;
+  const uint8_t *lut =
+      partial && _mode == REFRESH_FAST ? WatchyPanel::FAST_LUT : NULL;
+  RefreshMode mode = partial ? _mode : REFRESH_FULL;
+  uint16_t ms      = epd2.full_refresh_time;
+  if (partial) {
+    ms = lut != NULL ? epd2.fast_refresh_time : epd2.partial_refresh_time;
+    partialRefreshes++;
+    _addGhost(flips);
+  } else {
+    fullRefreshes++;
+    ghostPixelCount   = 0;
+    ghostRefreshCount = 0;
+    inversionPending  = false;
+  }
+  if (!_async) {
+    unsigned long start = micros();
+    if (lut != NULL) {
+      epd2.refresh(lut, x, y, w, h);
+    } else if (partial) {
+      epd2.refresh(x, y, w, h);
+    } else {
+      epd2.refresh(false);
+    }
+    refreshTimes[mode] = micros() - start;
+    return false;
+  }
+  epd2.startRefresh(partial, x, y, w, h, lut);
+  _runningUntil   = micros() + (ms + epd2.power_off_time) * 1000UL;
+  _startedRunning = true;
+  refreshRunning  = true;
+  runningX        = x;
+  runningY        = y;
+  runningW        = partial ? w : 0;
+  runningH        = h;
+  return true;
+}
+
+// After deep sleep the frame the refresh showed comes from the frame store.
+// If it was not stored the previous RAM stays behind, and the next refresh()
+// is a full one.
+void WatchyDisplay::_finishRefresh() {
+  if (runningW > 0 && !_previousValid) {
+    _previousValid = _restoreFrame();
+  }
+  if (runningW > 0 && !_previousValid) {
+    runningW        = 0;
+    ghostPixelCount = GHOST_UNKNOWN;
+  }
+  epd2.finishRefresh(_previous, runningX, runningY, runningW, runningH);
+  refreshRunning  = false;
+  _startedRunning = false;
+}
+
+void WatchyDisplay::_wakePanel() {
+  if (!_panelReady) {
+    WatchyProfiler::begin(WatchyProfiler::DISPLAY_INIT);
+    epd2.setInverted(panelInverted);
+    if (refreshRunning) {
+      epd2.resume(_diagBitrate, _resetDuration, _pulldownRst);
+    } else {
+      epd2.init(_diagBitrate, _initial, _resetDuration, _pulldownRst);
+    }
+    _panelReady = true;
+    WatchyProfiler::end(WatchyProfiler::DISPLAY_INIT);
+  }
+  if (refreshRunning) {
+    _finishRefresh();
+  }
+}
+
+void WatchyDisplay::_rotate(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+  switch (getRotation()) {
+  case 1:
+    _swap_int16(x, y);
+    _swap_int16(w, h);
+    x = WIDTH - x - w;
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    _swap_int16(x, y);
+    _swap_int16(w, h);
+    y = HEIGHT - y - h;
+    break;
+  }
+}
+
+// Each row is XORed with the row above (the first with white) before
+// packing, so vertical edges and repeated rows turn into runs of zeroes.
+static inline uint8_t rowDelta(const uint8_t *frame, uint16_t i) {
+  return frame[i] ^ (i >= WatchyDisplay::WIDTH_BYTES
+                         ? frame[i - WatchyDisplay::WIDTH_BYTES]
+                         : 0xFF);
+}
+
+bool WatchyDisplay::storeFrame() {
+  if (frameStoreLength != 0) {
+    return true; // the panel still shows the stored frame
+  }
+  if (!_previousValid) {
+    return false;
+  }
+  // PackBits: n < 128 is followed by n + 1 literal bytes, n >= 128 by one
+  // byte repeated n - 125 times
+  uint16_t out = 0, i = 0;
+  while (i < BUFFER_SIZE) {
+    uint8_t value = rowDelta(_previous, i);
+    uint16_t run  = 1;
+    while (i + run < BUFFER_SIZE && run < 130 &&
+           rowDelta(_previous, i + run) == value) {
+      run++;
+    }
+    if (run >= 3) {
+      if (out + 2 > FRAME_STORE_SIZE) {
+        return false;
+      }
+      frameStore[out++] = run + 125;
+      frameStore[out++] = value;
+      i += run;
+      continue;
+    }
+    // literals up to the next run of 3
+    uint16_t start = out++;
+    uint8_t n      = 0;
+    while (i < BUFFER_SIZE && n < 128) {
+      value = rowDelta(_previous, i);
+      if (i + 2 < BUFFER_SIZE && rowDelta(_previous, i + 1) == value &&
+          rowDelta(_previous, i + 2) == value) {
+        break;
+      }
+      if (out == FRAME_STORE_SIZE) {
+        return false;
+      }
+      frameStore[out++] = value;
+      i++;
+      n++;
+    }
+    frameStore[start] = n - 1;
+  }
+  frameStoreLength = out;
+  frameStoreCrc    = crc16(frameStore, out);
+  return true;
+}
+
+bool WatchyDisplay::_restoreFrame() {
+  if (frameStoreLength == 0 || frameStoreLength > FRAME_STORE_SIZE ||
+      crc16(frameStore, frameStoreLength) != frameStoreCrc) {
+    return false;
+  }
+  uint16_t in = 0, out = 0;
+  while (in < frameStoreLength) {
+    uint8_t n = frameStore[in++];
+    if (n < 128) {
+      if (out + n + 1 > BUFFER_SIZE || in + n + 1 > frameStoreLength) {
+        return false;
+      }
+      memcpy(_previous + out, frameStore + in, n + 1);
+      in += n + 1;
+      out += n + 1;
+    } else {
+      if (out + n - 125 > BUFFER_SIZE || in >= frameStoreLength) {
+        return false;
+      }
+      memset(_previous + out, frameStore[in++], n - 125);
+      out += n - 125;
+    }
+  }
+  if (out != BUFFER_SIZE) {
+    return false;
+  }
+  for (uint16_t i = 0; i < BUFFER_SIZE; i++) {
+    _previous[i] ^= i >= WIDTH_BYTES ? _previous[i - WIDTH_BYTES] : 0xFF;
+  }
+  return true;
+}
+
+bool WatchyDisplay::storeLayer(uint32_t key) {
+  uint16_t length  = packLayer(_buffer, layerStore, LAYER_STORE_SIZE);
+  layerStoreLength = length;
+  layerStoreCrc    = crc16(layerStore, length);
+  layerStoreKey    = key;
+  return length != 0;
+}
+
+bool WatchyDisplay::restoreLayer(uint32_t key) {
+  if (layerStoreLength == 0 || layerStoreLength > LAYER_STORE_SIZE ||
+      layerStoreKey != key ||
+      crc16(layerStore, layerStoreLength) != layerStoreCrc) {
+    return false;
+  }
+  return unpackLayer(layerStore, layerStoreLength, _buffer);
+}
+
+// record a window that was just displayed in the copy of the panel contents
+void WatchyDisplay::_keepWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!_previousValid) {
+    return; // the rest of the panel is still unknown
+  }
+  for (int16_t row = y; row < y + h; row++) {
+    uint16_t i = x / 8 + row * WIDTH_BYTES;
+    memcpy(_previous + i, _buffer + i, w / 8);
+  }
+}
+
+// pixels of a byte-aligned window that differ from the last frame sent
+uint32_t WatchyDisplay::_countChanges(int16_t x, int16_t y, int16_t w,
+                                      int16_t h) {
+  if (!_previousValid) {
+    return (uint32_t)w * h;
+  }
+  uint32_t flips = 0;
+  for (int16_t row = y; row < y + h; row++) {
+    uint16_t i = x / 8 + row * WIDTH_BYTES;
+    for (uint16_t end = i + w / 8; i < end; i++) {
+      flips += __builtin_popcount(_buffer[i] ^ _previous[i]);
+    }
+  }
+  return flips;
+}
+
+void WatchyDisplay::_addGhost(uint32_t pixels) {
+  if (ghostPixelCount == GHOST_UNKNOWN) {
+    return;
+  }
+  ghostPixelCount = min(ghostPixelCount + pixels, GHOST_UNKNOWN - 1);
+  if (ghostRefreshCount < 0xFFFF) {
+    ghostRefreshCount++;
+  }
+}
+
+// clip a panel-oriented window to the panel and widen it to whole bytes in x
+bool WatchyDisplay::_clipWindow(int16_t &x, int16_t &y, int16_t &w,
+                                int16_t &h) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH) {
+    w = WIDTH - x;
+  }
+  if (y + h > HEIGHT) {
+    h = HEIGHT - y;
+  }
+  if ((w <= 0) || (h <= 0)) {
+    return false;
+  }
+  w += x % 8;
+  x -= x % 8;
+  if (w % 8 > 0) {
+    w += 8 - w % 8;
+  }
+  if (x + w > WIDTH) {
+    w = WIDTH - x;
+  }
+  return true;
+}
@@ -0,0 +1,283 @@
+#ifndef WATCHY_DISPLAY_H
+#define WATCHY_DISPLAY_H
+
+#include <Adafruit_GFX.h>
+#include <GxEPD2_154_D67.h>
+
+#include "WatchyPanel.h"
+#include "config.h"
+
+// Glyphs of a GFX font pre-rasterised into byte-aligned 1bpp sprites, one
+// row of (width + 7) / 8 bytes per glyph row, MSB leftmost, set = ink. The
+// glyph metrics stay in the font. Generated by extras/host/tools/fontsprites.
+typedef struct fontSprites {
+  const GFXfont *font;
+  uint8_t first, last;    // cached characters
+  const uint8_t *bitmap;  // PROGMEM
+  const uint16_t *offset; // PROGMEM, per glyph into bitmap
+} fontSprites;
+
+// A GFX font subset to the glyphs a face uses, with each glyph's bitmap
+// run-length encoded instead of a bit stream. Rows come in groups of up to
+// 16 equal ones: a byte with the count of pair bytes that follow in the high
+// nibble and the rows less one in the low nibble, then pairs of background
+// (high nibble) and ink (low nibble) runs from the left edge. Generated by
+// extras/host/tools/fontrle.
+typedef struct runFont {
+  GFXfont font; // bitmap holds the runs, the glyphs index them
+} runFont;
+
+// A watch hand pre-rasterised at each position of its first quarter turn,
+// as one span per row: a convex hand crosses a row once. Positions are
+// counted clockwise from 12 o'clock. The other quarters are drawn
+// mirrored, so the hand has to be symmetric about its axis. Per position:
+// the first row relative to the pivot (int8) and the row count, then per
+// row the span's left end relative to the pivot (int8) and its width.
+// Generated by extras/host/tools/handsprites.
+typedef struct handSprites {
+  uint16_t steps;         // positions a turn, a multiple of 4
+  const uint8_t *spans;   // PROGMEM
+  const uint16_t *offset; // PROGMEM, per position 0..steps / 4 into spans
+} handSprites;
+
+#define NO_CLEAN_HOUR 0xFF
+
+// When refresh() turns to a full refresh. A partial refresh only drives the
+// pixels that change and leaves a little ghosting of them behind. A full
+// refresh is due once the pixels flipped by partial refreshes, or their
+// count, since the last full one reach a limit (0: no limit), and on the
+// first timed refresh of the full window from cleanHour each day. Refreshes
+// whose waveform nominally lasts asyncMs or longer are not waited for, the
+// ESP32 can deep sleep through them (0: all are waited for). Defaults are
+// the REFRESH_* values in config.h.
+typedef struct refreshPolicy {
+  uint32_t maxPixels;
+  uint16_t maxPartials;
+  uint8_t cleanHour; // NO_CLEAN_HOUR: no daily full refresh
+  uint16_t asyncMs;
+} refreshPolicy;
+
+// Ink bounds of a line of text relative to its cursor, as getTextBounds()
+// gives them for a cursor at (0, 0)
+typedef struct textBounds {
+  int16_t x, y;
+  uint16_t w, h;
+} textBounds;
+
+// Framebuffer front end for the 1.54" panel. Drawing goes through Adafruit GFX
+// into a 200x200 1bpp buffer (bit set = white, MSB = leftmost pixel), the
+// panel driver in epd2 is only touched by display()/displayWindow(). epd2
+// extends GxEPD2's SSD1681 driver, which on the host drives the in-memory
+// panel from extras/host, so both targets render identically.
+//
+// Screens draw in one polarity, white on black as the buffer starts out and
+// the menus are drawn. setInverted() swaps black and white on the panel for
+// a light theme.
+class WatchyDisplay : public Adafruit_GFX {
+public:
+  static const uint16_t WIDTH       = GxEPD2_154_D67::WIDTH;
+  static const uint16_t HEIGHT      = GxEPD2_154_D67::HEIGHT;
+  static const uint16_t WIDTH_BYTES = WIDTH / 8;
+  static const uint16_t BUFFER_SIZE = WIDTH_BYTES * HEIGHT;
+  // displayChanges(): at most this many windows are written, dirty row runs
+  // closer than DIFF_MERGE_ROWS share one
+  static const uint8_t MAX_DIRTY_BOXES = 4;
+  static const uint8_t DIFF_MERGE_ROWS = 8;
+  static const uint8_t MAX_FONT_SPRITES = 4;
+  // drawPackedBitmap(): back references reach this far
+  static const uint16_t PACKED_WINDOW = 1024;
+  // ghostPixels() after a reset, until the first full refresh
+  static const uint32_t GHOST_UNKNOWN = 0xFFFFFFFF;
+
+  enum TextAlign { ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT };
+  // waveform of the refreshes that would be partial, see setRefreshMode()
+  enum RefreshMode { REFRESH_PARTIAL, REFRESH_FAST, REFRESH_FULL };
+
+  WatchyPanel epd2;
+  uint16_t fullRefreshes;    // since boot
+  uint16_t partialRefreshes; // since boot
+
+public:
+  explicit WatchyDisplay(GxEPD2_154_D67 epd2_instance);
+  // Takes the epd2.init() arguments. The panel itself is only reset and
+  // initialised by the first refresh, so a wake that draws nothing leaves
+  // it in deep sleep.
+  void init(uint32_t serial_diag_bitrate = 0, bool initial = true,
+            uint16_t reset_duration = 10, bool pulldown_rst_mode = false);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  // Fills, lines and bitmaps write whole bytes of the buffer: spans with
+  // edge masks, bitmap rows shifted into place. Bitmaps fall back to
+  // Adafruit GFX when rotated.
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                 uint16_t color);
+  // Adafruit GFX's shapes, pixel for pixel, with the parts outside the
+  // screen skipped instead of rejected pixel by pixel: lines start and end
+  // at the window's edges, discs and triangles only fill their visible rows,
+  // circles the screen does not touch are not walked at all
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2,
+                    int16_t y2, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg);
+  // Bitmap packed by extras/host/tools/packbitmap: width and height as
+  // little-endian uint16, then tokens. 0nnnnnnn: n + 1 literal bytes follow.
+  // 1nnnnndd dddddddd: n + 3 bytes repeat from d + 1 bytes back. Rows are
+  // decoded into a small history buffer and drawn from there like
+  // drawBitmap() of the unpacked image. At most WIDTH pixels wide.
+  void drawPackedBitmap(int16_t x, int16_t y, const uint8_t *packed,
+                        uint16_t color);
+  void drawPackedBitmap(int16_t x, int16_t y, const uint8_t *packed,
+                        uint16_t color, uint16_t bg);
+  // A hand pivoting on x, y at position (0: 12 o'clock, hand->steps / 4:
+  // 3 o'clock), a fillRect() per row of its sprite
+  void drawHand(int16_t x, int16_t y, const handSprites *hand,
+                uint16_t position, uint16_t color);
+  // A run font is drawn by WatchyDisplay alone, each run of ink as a span.
+  // Setting a GFX font goes back to its bitmap glyphs.
+  void setFont(const GFXfont *f = NULL);
+  void setFont(const runFont *f);
+  // Text in a font with sprites is blitted like a bitmap instead of going
+  // through drawPixel(), at text size 1 and rotation 0. Other GFX fonts are
+  // filled a span per run of ink, the built-in font is Adafruit GFX's.
+  size_t write(uint8_t c);
+  // Registers sprites for their font. They are used for any font with the
+  // same glyphs, so a face's copy of a font header matches too.
+  bool addFontSprites(const fontSprites *sprites);
+  // getTextBounds() of str as one line, never wrapped, in the current font
+  // and text size. Memoised per font, size and string in RTC memory, so a
+  // layout that repeats across wakes is only measured once. Strings of
+  // TEXT_BOUNDS_LENGTH characters or more are measured every time.
+  textBounds measureText(const char *str);
+  // Prints str as one line on the baseline y with the cursor at x, x - w / 2
+  // or x - w, w being the measured ink width. Left aligned text is not
+  // measured.
+  void drawText(int16_t x, int16_t y, const char *str,
+                TextAlign align = ALIGN_LEFT);
+
+  // Full window: drawing and refresh cover the whole panel. Partial window:
+  // drawing is clipped to the window and display() only refreshes it. The
+  // window is widened to whole bytes in x, as the controller requires.
+  void setFullWindow();
+  void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  void display(bool partial_update_mode = false);
+  void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  // Partial refresh of what changed since the last displayed frame: the
+  // dirty byte-aligned boxes are written to the controller and refreshed
+  // together. Returns false, without touching the panel, if nothing
+  // changed. Falls back to display(true) while the last frame is unknown,
+  // and after setInverted().
+  bool displayChanges();
+  // The refresh for frames that do not need a particular one: displayChanges(),
+  // or display() of the whole frame once the refresh policy calls for a full
+  // refresh. now is the RTC time (as makeTime()) for the daily full refresh,
+  // 0 if it is not known.
+  void refresh(uint32_t now = 0);
+  // Resets the panel if need be and powers it up ahead of a refresh that is
+  // to start at a given time, which then only writes what changed before
+  // the waveform starts
+  void wake();
+  // Microseconds until a refresh refresh() did not wait for nominally ends,
+  // 0 if there is none or it is over. Until then the panel is BUSY: the
+  // next wake that uses the panel, or hibernate(), waits for it first.
+  uint32_t refreshRunningUs();
+  // The waveform for what display(), displayWindow(), displayChanges() and
+  // refresh() would refresh partially from now on: the stock partial one
+  // (the default), the quicker WatchyPanel::FAST_LUT that leaves more
+  // ghosting, or the stock full one, which makes them full refreshes. Full
+  // refreshes stay full. Not kept across deep sleep.
+  void setRefreshMode(RefreshMode mode);
+  RefreshMode getRefreshMode();
+  // Microseconds the last refresh with each waveform took, from its start
+  // until BUSY dropped, 0 if none was waited for. Kept in RTC memory.
+  uint32_t refreshTime(RefreshMode mode);
+  // Shows the frames with black and white swapped, through the controller's
+  // RAM options: the buffer, the frames kept in RTC memory and the diffs
+  // stay as drawn, switching costs nothing per pixel. The next refresh is a
+  // full one. Kept in RTC memory.
+  void setInverted(bool inverted);
+  bool getInverted();
+  // The policy is kept in RTC memory
+  void setRefreshPolicy(const refreshPolicy &policy);
+  const refreshPolicy &getRefreshPolicy();
+  // Since the last full refresh: pixels flipped by partial refreshes, all of
+  // a window while the panel's image is unknown, and their count. Kept in
+  // RTC memory.
+  uint32_t ghostPixels();
+  uint16_t ghostRefreshes();
+  // Packs the last displayed frame into FRAME_STORE_SIZE bytes of RTC
+  // memory (row XOR delta, PackBits and a CRC), so displayChanges() can
+  // diff against it after deep sleep. Returns false if the frame is unknown
+  // or does not fit.
+  bool storeFrame();
+  // A watch face's static layer: the whole buffer is packed in
+  // drawPackedBitmap()'s format into LAYER_STORE_SIZE bytes of RTC memory
+  // under a key, and restoreLayer() unpacks it over the whole buffer while
+  // the key matches. Both return false if the layer does not fit or match,
+  // the buffer is then to be drawn afresh.
+  bool storeLayer(uint32_t key);
+  bool restoreLayer(uint32_t key);
+  void hibernate();
+  void powerOff();
+
+  uint8_t *getBuffer() { return _buffer; }
+
+private:
+  uint8_t _buffer[BUFFER_SIZE];
+  uint8_t _previous[BUFFER_SIZE]; // last frame sent to the panel
+  bool _previousValid;
+  bool _using_partial_mode;
+  bool _panelReady; // epd2.init() done and the panel not hibernated
+  uint32_t _diagBitrate;
+  bool _initial;
+  uint16_t _resetDuration;
+  bool _pulldownRst;
+  RefreshMode _mode;
+  bool _async;            // refresh() lets the refresh run on
+  bool _startedRunning;   // this wake left a refresh running
+  uint32_t _runningUntil; // micros()
+  int16_t _pw_x, _pw_y, _pw_w, _pw_h;
+  const fontSprites *_fontSprites[MAX_FONT_SPRITES];
+  uint8_t _fontSpritesCount;
+  const GFXfont *_spriteFont; // font _sprites was looked up for
+  const fontSprites *_sprites;
+  const runFont *_runFont; // set with gfxFont, NULL for GFX fonts
+
+  void _rotate(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+  bool _clipWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+  void _keepWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  uint32_t _countChanges(int16_t x, int16_t y, int16_t w, int16_t h);
+  void _addGhost(uint32_t pixels);
+  uint32_t _cleanDay(uint32_t now);
+  bool _fullRefreshDue(uint32_t day);
+  bool _restoreFrame();
+  void _writeAgain(int16_t x, int16_t y, int16_t w, int16_t h);
+  bool _refreshPanel(bool partial, int16_t x, int16_t y, int16_t w, int16_t h,
+                     uint32_t flips);
+  void _finishRefresh();
+  void _wakePanel();
+  const fontSprites *_findSprites(const GFXfont *font);
+  void _fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void _blit(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+             uint16_t color, bool opaque, uint16_t bg);
+  void _drawRuns(int16_t x, int16_t y, const GFXglyph *glyph,
+                 const uint8_t *runs);
+  void _drawBits(int16_t x, int16_t y, const GFXglyph *glyph,
+                 const uint8_t *bitmap);
+  void _fillSpan(int16_t x, int16_t y, int16_t w, int16_t h);
+  void _drawPacked(int16_t x, int16_t y, const uint8_t *packed,
+                   uint16_t color, bool opaque, uint16_t bg);
+};
+
+#endif
@@ -0,0 +1,72 @@
+#include "WatchyEnergy.h"
+
+#define US_PER_HOUR 3600000000.0f
+
+WatchyEnergy::WatchyEnergy() {
+  model.activeMa         = ENERGY_ACTIVE_MA;
+  model.lightSleepMa     = ENERGY_LIGHT_SLEEP_MA;
+  model.deepSleepMa      = ENERGY_DEEP_SLEEP_MA;
+  model.wifiMa           = ENERGY_WIFI_MA;
+  model.bleMa            = ENERGY_BLE_MA;
+  model.fullRefreshMa    = ENERGY_FULL_REFRESH_MA;
+  model.fullRefreshMs    = ENERGY_FULL_REFRESH_MS;
+  model.partialRefreshMa = ENERGY_PARTIAL_REFRESH_MA;
+  model.partialRefreshMs = ENERGY_PARTIAL_REFRESH_MS;
+  model.bootMs           = ENERGY_BOOT_MS;
+  model.batteryMah       = BATTERY_MAH;
+}
+
+float WatchyEnergy::wakeMah(const wakeProfile &wake) const {
+  float busyUs   = wake.phaseUs[WatchyProfiler::BUSY] +
+                 wake.phaseUs[WatchyProfiler::IDLE];
+  float wifiUs   = wake.phaseUs[WatchyProfiler::WIFI];
+  float bleUs    = wake.phaseUs[WatchyProfiler::BLE];
+  float activeUs = wake.awakeUs - busyUs - wifiUs - bleUs +
+                   model.bootMs * 1000.0f;
+  float maUs = activeUs * model.activeMa + busyUs * model.lightSleepMa +
+               wifiUs * model.wifiMa + bleUs * model.bleMa +
+               wake.fullRefreshes * model.fullRefreshMs * 1000.0f *
+                   model.fullRefreshMa +
+               wake.partialRefreshes * model.partialRefreshMs * 1000.0f *
+                   model.partialRefreshMa;
+  return maUs / US_PER_HOUR;
+}
+
+float WatchyEnergy::sleepMah(float seconds) const {
+  return seconds * model.deepSleepMa / 3600.0f;
+}
+
+float WatchyEnergy::daysPerCharge(float mahPerDay) const {
+  return mahPerDay > 0 ? model.batteryMah / mahPerDay : 0;
+}
+
+float WatchyEnergy::projectedDays(uint16_t intervalS) const {
+  uint16_t n = WatchyProfiler::count();
+  if (n == 0) {
+    return 0;
+  }
+  float mah = 0, awakeS = 0;
+  for (uint16_t i = 0; i < n; i++) {
+    const wakeProfile &wake = WatchyProfiler::wake(i);
+    mah += wakeMah(wake);
+    awakeS += (wake.awakeUs / 1000.0f + model.bootMs) / 1000.0f;
+  }
+  mah /= n;
+  awakeS /= n;
+  float sleepS = intervalS > awakeS ? intervalS - awakeS : 0;
+  return daysPerCharge((mah + sleepMah(sleepS)) * 86400.0f / intervalS);
+}
+
+void WatchyEnergy::report(Print &out, uint16_t intervalS) const {
+  uint16_t n = WatchyProfiler::count();
+  float mah  = 0;
+  for (uint16_t i = 0; i < n; i++) {
+    mah += wakeMah(WatchyProfiler::wake(i));
+  }
+  out.print("wakes: ");
+  out.println(n);
+  out.print("uAh per wake: ");
+  out.println(n ? mah * 1000.0f / n : 0, 2);
+  out.print("days per charge: ");
+  out.println(projectedDays(intervalS), 1);
+}
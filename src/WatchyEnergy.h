@@ -0,0 +1,43 @@
+#ifndef WATCHY_ENERGY_H
+#define WATCHY_ENERGY_H
+
+#include <Arduino.h>
+
+#include "WatchyProfiler.h"
+#include "config.h"
+
+// Current draw of each state the watch can be in. Defaults come from the
+// ENERGY_* values in config.h, measure your own unit for better numbers.
+typedef struct energyModel {
+  float activeMa;
+  float lightSleepMa;
+  float deepSleepMa;
+  float wifiMa; // radio on, includes the CPU
+  float bleMa;
+  float fullRefreshMa; // panel only, on top of the ESP32
+  uint16_t fullRefreshMs;
+  float partialRefreshMa;
+  uint16_t partialRefreshMs;
+  uint16_t bootMs;
+  float batteryMah;
+} energyModel;
+
+// Estimates charge from WatchyProfiler records: each phase is charged at the
+// current of the state it runs in, refreshes at the panel current for the
+// nominal waveform length.
+class WatchyEnergy {
+public:
+  energyModel model;
+
+public:
+  WatchyEnergy();
+  explicit WatchyEnergy(const energyModel &m) : model(m) {}
+  float wakeMah(const wakeProfile &wake) const;
+  float sleepMah(float seconds) const;
+  float daysPerCharge(float mahPerDay) const;
+  // average wake in the profiler ring, one wake every intervalS seconds
+  float projectedDays(uint16_t intervalS = 60) const;
+  void report(Print &out, uint16_t intervalS = 60) const;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#include "WatchyMath.h"
+
+// sin() of the first quadrant in Q16, per half degree
+static const uint16_t quarterSine[ANGLE_STEPS / 4] PROGMEM = {
+    0, 572, 1144, 1716, 2287, 2859, 3430, 4001, 4572, 5142,
+    5712, 6281, 6850, 7419, 7987, 8554, 9121, 9687, 10252, 10817,
+    11380, 11943, 12505, 13066, 13626, 14185, 14742, 15299, 15855, 16409,
+    16962, 17514, 18064, 18613, 19161, 19707, 20252, 20795, 21336, 21876,
+    22415, 22951, 23486, 24019, 24550, 25080, 25607, 26132, 26656, 27177,
+    27697, 28214, 28729, 29242, 29753, 30261, 30767, 31271, 31772, 32271,
+    32768, 33262, 33754, 34242, 34729, 35212, 35693, 36172, 36647, 37120,
+    37590, 38057, 38521, 38982, 39441, 39896, 40348, 40797, 41243, 41686,
+    42126, 42562, 42995, 43425, 43852, 44275, 44695, 45112, 45525, 45935,
+    46341, 46744, 47143, 47538, 47930, 48318, 48703, 49084, 49461, 49834,
+    50203, 50569, 50931, 51289, 51643, 51993, 52339, 52682, 53020, 53354,
+    53684, 54010, 54332, 54650, 54963, 55273, 55578, 55879, 56175, 56468,
+    56756, 57040, 57319, 57594, 57865, 58131, 58393, 58650, 58903, 59152,
+    59396, 59635, 59870, 60100, 60326, 60547, 60764, 60976, 61183, 61386,
+    61584, 61777, 61966, 62149, 62328, 62503, 62672, 62837, 62997, 63152,
+    63303, 63449, 63589, 63725, 63856, 63983, 64104, 64220, 64332, 64439,
+    64540, 64637, 64729, 64816, 64898, 64975, 65048, 65115, 65177, 65234,
+    65287, 65334, 65376, 65414, 65446, 65474, 65496, 65514, 65526, 65534,
+};
+
+static int32_t quarter(int16_t step) {
+  return step == ANGLE_STEPS / 4 ? FIXED_ONE
+                                 : pgm_read_word(&quarterSine[step]);
+}
+
+int32_t fixedSin(int16_t angle) {
+  angle %= ANGLE_STEPS;
+  if (angle < 0) {
+    angle += ANGLE_STEPS;
+  }
+  int16_t step = angle % (ANGLE_STEPS / 4);
+  switch (angle / (ANGLE_STEPS / 4)) {
+  case 0:
+    return quarter(step);
+  case 1:
+    return quarter(ANGLE_STEPS / 4 - step);
+  case 2:
+    return -quarter(step);
+  default:
+    return -quarter(ANGLE_STEPS / 4 - step);
+  }
+}
+
+int32_t fixedCos(int16_t angle) {
+  return fixedSin(angle % ANGLE_STEPS + ANGLE_STEPS / 4);
+}
@@ -0,0 +1,21 @@
+#ifndef WATCHY_MATH_H
+#define WATCHY_MATH_H
+
+#include <Arduino.h>
+
+// Fixed-point trigonometry for faces that rotate things on every wake, in
+// place of the ESP32's soft-float sin() and cos(). Angles are in half
+// degrees, ANGLE_STEPS a turn: one step per minute of the hour hand, 12 per
+// minute of the minute hand. Results are Q16, FIXED_ONE is 1.0.
+#define ANGLE_STEPS 720
+#define FIXED_ONE   65536
+
+int32_t fixedSin(int16_t angle);
+int32_t fixedCos(int16_t angle);
+
+// Q16 to integer, rounding towards zero like a cast from double
+inline int16_t fixedToInt(int32_t v) {
+  return v >= 0 ? v >> 16 : -(-v >> 16);
+}
+
+#endif
@@ -0,0 +1,244 @@
+#include "WatchyPanel.h"
+
+// Waveshare's partial waveform for the 1.54" V2 panel with the drive phase
+// cut from 15 frames to 10, 12 frames in all
+const uint8_t WatchyPanel::FAST_LUT[LUT_SIZE] PROGMEM = {
+    // source voltages per phase for the four transitions of a pixel, then
+    // VCOM, 12 groups each
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // per group: frames of phases A and B, their repeat, of C and D, their
+    // repeat, and the group's repeat
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // frame rates, gate scan selection
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00,
+    // end option, gate voltage, source voltages, VCOM
+    0x02, 0x17, 0x41, 0xB0, 0x32, 0x28};
+
+WatchyPanel::WatchyPanel(const GxEPD2_154_D67 &driver)
+    : GxEPD2_154_D67(driver), _lut(NULL), _inverted(false) {}
+
+void WatchyPanel::writeWindow(uint8_t ram, const uint8_t *frame, int16_t x,
+                              int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  if (_initial_write) {
+    writeScreenBuffer(); // both RAMs white, as GxEPD2's first write does
+  }
+  if (!_using_partial_mode) {
+    _initPart();
+  }
+  _setRamArea(x, y, w, h);
+  _writeCommand(ram);
+  _startTransfer();
+  const uint8_t *row = frame + y * (WIDTH / 8) + x / 8;
+  for (int16_t i = 0; i < h; i++, row += WIDTH / 8) {
+    _pSPIx->writeBytes(row, w / 8);
+  }
+  _endTransfer();
+}
+
+void WatchyPanel::powerUp() {
+  if (!_using_partial_mode) {
+    _initPart();
+  }
+}
+
+void WatchyPanel::startRefresh(bool partial_update_mode, int16_t x, int16_t y,
+                               int16_t w, int16_t h, const uint8_t *lut) {
+  if (_initial_refresh) {
+    partial_update_mode = false; // initial update needs be full update
+  }
+  if (!_using_partial_mode) {
+    _initPart(); // the D67 sets up full and partial mode alike
+  }
+  uint8_t update = partial_update_mode ? 0xFF : 0xF7; // ... analog, clock off
+  if (partial_update_mode && lut != NULL) {
+    _loadLut(lut);
+    update = 0xCF; // without loading the stock waveform
+  } else {
+    _lut = NULL;
+  }
+  if (partial_update_mode) {
+    _setRamArea(x, y, w, h);
+  }
+  _writeCommand(0x22);
+  _writeData(update);
+  _writeCommand(0x20);
+  _initial_refresh    = false;
+  _power_is_on        = false;
+  _using_partial_mode = false; // the next refresh sets up and powers up again
+}
+
+void WatchyPanel::finishRefresh(const uint8_t *frame, int16_t x, int16_t y,
+                                int16_t w, int16_t h) {
+  _waitWhileBusy("startRefresh", full_refresh_time);
+  if (w > 0) {
+    _using_partial_mode = true; // still set up, RAM writes need no power
+    writeWindow(RAM_PREVIOUS, frame, x, y, w, h);
+    writeWindow(RAM_CURRENT, frame, x, y, w, h);
+    _using_partial_mode = false;
+  }
+}
+
+void WatchyPanel::refresh(const uint8_t *lut, int16_t x, int16_t y, int16_t w,
+                          int16_t h) {
+  if (_initial_refresh) {
+    refresh(false); // initial update needs be full update
+    return;
+  }
+  if (!_using_partial_mode) {
+    _initPart();
+  }
+  _loadLut(lut);
+  _setRamArea(x, y, w, h);
+  _writeCommand(0x22);
+  _writeData(0xCC); // clock and analog on, display mode 2
+  _writeCommand(0x20);
+  _waitWhileBusy("refresh lut", fast_refresh_time);
+}
+
+void WatchyPanel::refresh(bool partial_update_mode) {
+  if (partial_update_mode) {
+    refresh(0, 0, WIDTH, HEIGHT);
+    return;
+  }
+  if (!_using_partial_mode) {
+    _initPart(); // the D67 sets up full and partial mode alike
+  }
+  _lut = NULL; // the stock refreshes load their waveform
+  _writeCommand(0x22);
+  _writeData(0xF4); // clock and analog on, load the waveform, display mode 1
+  _writeCommand(0x20);
+  _waitWhileBusy("_Update_Full", full_refresh_time);
+  _initial_refresh = false;
+}
+
+void WatchyPanel::refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (_initial_refresh) {
+    refresh(false); // initial update needs be full update
+    return;
+  }
+  if (!_using_partial_mode) {
+    _initPart();
+  }
+  _lut = NULL;
+  GxEPD2_154_D67::refresh(x, y, w, h);
+}
+
+void WatchyPanel::resume(uint32_t serial_diag_bitrate, uint16_t reset_duration,
+                         bool pulldown_rst_mode) {
+  _diag_enabled       = serial_diag_bitrate > 0;
+  _initial_write      = false;
+  _initial_refresh    = false;
+  _power_is_on        = false;
+  _using_partial_mode = false;
+  _hibernating        = false;
+  _lut                = NULL;
+  _reset_duration     = reset_duration;
+  _pulldown_rst_mode  = pulldown_rst_mode;
+  digitalWrite(_cs, HIGH);
+  pinMode(_cs, OUTPUT);
+  digitalWrite(_dc, HIGH);
+  pinMode(_dc, OUTPUT);
+  pinMode(_busy, INPUT);
+  _pSPIx->begin();
+}
+
+void WatchyPanel::setInverted(bool inverted) {
+  _inverted = inverted;
+  if (_using_partial_mode) {
+    _writeRamOptions();
+  }
+}
+
+void WatchyPanel::_loadLut(const uint8_t *lut) {
+  if (_lut == lut) {
+    return;
+  }
+  _writeCommand(0x32);
+  _startTransfer();
+  _pSPIx->writeBytes(lut, 153);
+  _endTransfer();
+  _writeCommand(0x3F); // end option
+  _writeData(pgm_read_byte(lut + 153));
+  _writeCommand(0x03); // gate voltage
+  _writeData(pgm_read_byte(lut + 154));
+  _writeCommand(0x04); // source voltages
+  _writeData(pgm_read_byte(lut + 155));
+  _writeData(pgm_read_byte(lut + 156));
+  _writeData(pgm_read_byte(lut + 157));
+  _writeCommand(0x2C); // VCOM
+  _writeData(pgm_read_byte(lut + 158));
+  _lut = lut;
+}
+
+// GxEPD2_154_D67's _Init_Part(), which is private: wake the controller from
+// deep sleep, soft reset, set it up and turn the analog supply on
+void WatchyPanel::_initPart() {
+  if (_hibernating) {
+    _reset();
+  }
+  delay(10);           // 10ms according to specs
+  _writeCommand(0x12); // soft reset, also to the stock waveform
+  _lut = NULL;
+  delay(10);           // 10ms according to specs
+  _writeCommand(0x01); // driver output control
+  _writeData(0xC7);
+  _writeData(0x00);
+  _writeData(0x00);
+  _writeCommand(0x3C); // border waveform
+  _writeData(0x05);
+  _writeRamOptions();
+  _writeCommand(0x18); // read built-in temperature sensor
+  _writeData(0x80);
+  if (!_power_is_on) {
+    _writeCommand(0x22);
+    _writeData(0xf8);
+    _writeCommand(0x20);
+    _waitWhileBusy("_PowerOn", power_on_time);
+  }
+  _power_is_on        = true;
+  _using_partial_mode = true;
+}
+
+// display update control 1: the previous and the BW RAM inverted or as
+// they are, all sources used
+void WatchyPanel::_writeRamOptions() {
+  _writeCommand(0x21);
+  _writeData(_inverted ? 0x88 : 0x00);
+  _writeData(0x00);
+}
+
+void WatchyPanel::_setRamArea(int16_t x, int16_t y, int16_t w, int16_t h) {
+  _writeCommand(0x11); // data entry mode: x increase, y increase
+  _writeData(0x03);
+  _writeCommand(0x44); // x window in bytes
+  _writeData(x / 8);
+  _writeData((x + w - 1) / 8);
+  _writeCommand(0x45); // y window
+  _writeData(y % 256);
+  _writeData(y / 256);
+  _writeData((y + h - 1) % 256);
+  _writeData((y + h - 1) / 256);
+  _writeCommand(0x4E); // address counters
+  _writeData(x / 8);
+  _writeCommand(0x4F);
+  _writeData(y % 256);
+  _writeData(y / 256);
+}
@@ -0,0 +1,83 @@
+#ifndef WATCHY_PANEL_H
+#define WATCHY_PANEL_H
+
+#include <GxEPD2_154_D67.h>
+
+// GxEPD2's SSD1681 driver with a faster way into the controller's RAM.
+// GxEPD2 sends an image a byte at a time with SPI.transfer() and yields with
+// delay(1) before and after every write, so each dirty box of a tick costs
+// two milliseconds before the refresh can start. writeWindow() streams the
+// window's rows from the frame with SPI.writeBytes(), which fills the SPI
+// peripheral's 64 byte FIFO per call, and does not yield: a full-screen
+// plane takes about 2 ms at 20 MHz.
+//
+// Partial refreshes can also run a waveform of its own, loaded into the
+// controller's LUT registers. FAST_LUT is the fast one: a shorter drive
+// phase than the stock partial waveform, for more ghosting.
+//
+// setInverted() shows both RAMs inverted, through the controller's RAM
+// options. Differential refreshes compare the inverted images, so the pixels
+// they drive stay the ones whose bits changed.
+class WatchyPanel : public GxEPD2_154_D67 {
+public:
+  static const uint8_t RAM_CURRENT  = 0x24; // shown by the next refresh
+  static const uint8_t RAM_PREVIOUS = 0x26; // diffed against by partial ones
+  // 153 bytes for 0x32, then end option (0x3F), gate voltage (0x03), source
+  // voltages (0x04, 3 bytes) and VCOM (0x2C), as Waveshare's waveforms
+  static const uint8_t LUT_SIZE = 159;
+  static const uint8_t FAST_LUT[LUT_SIZE]; // PROGMEM
+  static const uint16_t fast_refresh_time = 300; // ms, FAST_LUT nominally
+
+  explicit WatchyPanel(const GxEPD2_154_D67 &driver);
+  // Writes the window x, y, w, h of a WIDTH x HEIGHT frame (1bpp, MSB
+  // leftmost) into one of the RAMs. x and w are multiples of 8 and the
+  // window lies on the panel. Like GxEPD2's writes it powers the controller
+  // up for partial refreshes first, and clears both RAMs after init().
+  void writeWindow(uint8_t ram, const uint8_t *frame, int16_t x, int16_t y,
+                   int16_t w, int16_t h);
+  // Sets the controller up and turns the analog supply on, as the first
+  // writeWindow() after init() or a refresh does
+  void powerUp();
+  // refresh(partial_update_mode), or refresh(x, y, w, h) with the stock or
+  // the lut waveform, without waiting for the waveform. The update turns
+  // the analog supply and the clock off at its end, so once BUSY drops the
+  // controller only needs hibernate().
+  void startRefresh(bool partial_update_mode, int16_t x = 0, int16_t y = 0,
+                    int16_t w = WIDTH, int16_t h = HEIGHT,
+                    const uint8_t *lut = NULL);
+  // refresh(x, y, w, h) with the waveform `lut` (LUT_SIZE bytes, PROGMEM)
+  // instead of the stock partial one. The LUT is only sent if the
+  // controller does not hold it yet: a reset, or a stock refresh reloading
+  // its own waveform, loses it.
+  void refresh(const uint8_t *lut, int16_t x, int16_t y, int16_t w,
+               int16_t h);
+  // GxEPD2's, without the soft reset before a full refresh that would drop
+  // the RAM options
+  void refresh(bool partial_update_mode = false);
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h);
+  // Waits for startRefresh() through the busy callback, then writes the
+  // window x, y, w, h of the frame it showed into both RAMs, as GxEPD2's
+  // write...Again() do after a partial refresh (w = 0: nothing to write)
+  void finishRefresh(const uint8_t *frame, int16_t x, int16_t y, int16_t w,
+                     int16_t h);
+  // Takes the init() arguments. For an ESP32 that woke from deep sleep while
+  // a startRefresh() ran: sets up the pins and SPI for a controller that is
+  // still initialised, without the reset of init() that would cut the
+  // waveform short.
+  void resume(uint32_t serial_diag_bitrate, uint16_t reset_duration,
+              bool pulldown_rst_mode);
+  // Black and white swapped from the next refresh on. Sent right away if the
+  // controller is set up, otherwise when it is, as it forgets it on reset.
+  void setInverted(bool inverted);
+
+private:
+  const uint8_t *_lut; // in the controller's LUT registers, NULL: stock
+  bool _inverted;
+
+  void _loadLut(const uint8_t *lut);
+  void _initPart();
+  void _writeRamOptions();
+  void _setRamArea(int16_t x, int16_t y, int16_t w, int16_t h);
+};
+
+#endif
@@ -0,0 +1,105 @@
+#include "WatchyProfiler.h"
+
+RTC_DATA_ATTR wakeProfile wakeProfiles[PROFILE_DEPTH];
+RTC_DATA_ATTR uint16_t wakeProfileHead;
+RTC_DATA_ATTR uint16_t wakeProfileCount;
+
+WatchyProfiler::Phase WatchyProfiler::_stack[MAX_NESTING];
+uint32_t WatchyProfiler::_start[MAX_NESTING];
+uint32_t WatchyProfiler::_nested[MAX_NESTING];
+uint8_t WatchyProfiler::_depth;
+
+static const char *const phaseNames[] = {
+    "wire_begin", "rtc_init", "display_init", "draw", "spi",
+    "busy",       "idle",     "wifi",         "ble",  "deep_sleep"};
+
+void WatchyProfiler::beginWake(uint8_t wakeCause) {
+  wakeProfile &p = wakeProfiles[wakeProfileHead];
+  memset(&p, 0, sizeof(p));
+  p.wakeCause = wakeCause;
+  _depth      = 0;
+}
+
+void WatchyProfiler::begin(Phase phase) {
+  if (_depth == MAX_NESTING) {
+    return;
+  }
+  _stack[_depth]  = phase;
+  _start[_depth]  = micros();
+  _nested[_depth] = 0;
+  _depth++;
+}
+
+void WatchyProfiler::end(Phase phase) {
+  if (_depth == 0 || _stack[_depth - 1] != phase) {
+    return; // unbalanced, or begin() was dropped at MAX_NESTING
+  }
+  _depth--;
+  uint32_t elapsed = micros() - _start[_depth];
+  wakeProfiles[wakeProfileHead].phaseUs[phase] += elapsed - _nested[_depth];
+  if (_depth > 0) {
+    _nested[_depth - 1] += elapsed;
+  }
+}
+
+void WatchyProfiler::commitWake(uint16_t fullRefreshes,
+                                uint16_t partialRefreshes) {
+  wakeProfile &p     = wakeProfiles[wakeProfileHead];
+  p.awakeUs          = micros();
+  p.fullRefreshes    = min(fullRefreshes, (uint16_t)255);
+  p.partialRefreshes = min(partialRefreshes, (uint16_t)255);
+  wakeProfileHead    = (wakeProfileHead + 1) % PROFILE_DEPTH;
+  if (wakeProfileCount < PROFILE_DEPTH) {
+    wakeProfileCount++;
+  }
+}
+
+void WatchyProfiler::dump(Print &out) {
+  dumpHeader(out);
+  for (uint16_t i = 0; i < wakeProfileCount; i++) {
+    dumpWake(out, i);
+  }
+}
+
+void WatchyProfiler::dumpHeader(Print &out) {
+  out.print("P");
+  for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+    out.print(",");
+    out.print(phaseNames[i]);
+  }
+  out.println();
+}
+
+void WatchyProfiler::dumpWake(Print &out, uint16_t index) {
+  const wakeProfile &p = wake(index);
+  out.print("W,");
+  out.print(p.wakeCause);
+  out.print(",");
+  out.print(p.awakeUs);
+  out.print(",");
+  out.print(p.fullRefreshes);
+  out.print(",");
+  out.print(p.partialRefreshes);
+  for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+    out.print(",");
+    out.print(p.phaseUs[i]);
+  }
+  out.println();
+}
+
+void WatchyProfiler::clear() {
+  wakeProfileHead  = 0;
+  wakeProfileCount = 0;
+}
+
+const char *WatchyProfiler::phaseName(Phase phase) {
+  return phaseNames[phase];
+}
+
+uint16_t WatchyProfiler::count() { return wakeProfileCount; }
+
+const wakeProfile &WatchyProfiler::wake(uint16_t index) {
+  uint16_t oldest =
+      (wakeProfileHead + PROFILE_DEPTH - wakeProfileCount) % PROFILE_DEPTH;
+  return wakeProfiles[(oldest + index) % PROFILE_DEPTH];
+}
@@ -0,0 +1,64 @@
+#ifndef WATCHY_PROFILER_H
+#define WATCHY_PROFILER_H
+
+#include <Arduino.h>
+
+#include "config.h"
+
+// Wake-cycle tracer. Every wake fills one record with the time spent in each
+// phase of the wake path, deepSleep() commits it to a ring in RTC memory so
+// the last PROFILE_DEPTH wakes survive deep sleep. Phases nest and times
+// are exclusive: a BUSY wait inside SPI, or WIFI inside DRAW, is only
+// counted once, in the inner phase.
+typedef struct wakeProfile wakeProfile;
+
+class WatchyProfiler {
+public:
+  enum Phase {
+    WIRE_BEGIN,
+    RTC_INIT,
+    DISPLAY_INIT,
+    DRAW,       // drawWatchFace()
+    SPI,        // display.display() without the BUSY waits
+    BUSY,       // light sleep in displayBusyCallback()
+    IDLE,       // light sleep in Watchy::waitButton()
+    WIFI,       // WiFi radio on
+    BLE,        // BLE radio on
+    DEEP_SLEEP, // deepSleep() up to esp_deep_sleep_start()
+    PHASE_COUNT
+  };
+  static const uint8_t MAX_NESTING = 4;
+
+public:
+  static void beginWake(uint8_t wakeCause);
+  static void begin(Phase phase);
+  static void end(Phase phase);
+  static void commitWake(uint16_t fullRefreshes, uint16_t partialRefreshes);
+
+  // Prints the ring oldest first, one "W,cause,awake,full,partial,phase..."
+  // line per
+  // wake after a "P,name..." header, for extras/host/tools/profdecode
+  static void dump(Print &out);
+  static void dumpHeader(Print &out);
+  static void dumpWake(Print &out, uint16_t index);
+  static void clear();
+  static const char *phaseName(Phase phase);
+  static uint16_t count();
+  static const wakeProfile &wake(uint16_t index); // 0 is the oldest
+
+private:
+  static Phase _stack[MAX_NESTING];
+  static uint32_t _start[MAX_NESTING];
+  static uint32_t _nested[MAX_NESTING]; // time spent in inner phases
+  static uint8_t _depth;
+};
+
+struct wakeProfile {
+  uint8_t wakeCause; // esp_sleep_wakeup_cause_t
+  uint8_t fullRefreshes;
+  uint8_t partialRefreshes;
+  uint32_t awakeUs; // micros() at deep sleep entry
+  uint32_t phaseUs[WatchyProfiler::PHASE_COUNT];
+};
+
+#endif
@@ -1,8 +1,19 @@
 #include "WatchyRTC.h"
 
+static RTC_DATA_ATTR uint8_t detectedRtcType; // 0 until a chip answered
+static RTC_DATA_ATTR tickSchedule schedule = {
+    TICK_INTERVAL, QUIET_HOURS_FROM, QUIET_HOURS_TO, 0, {}, PREWAKE_MS};
+// what the alarm registers hold: a minute since midnight, TICK_EVERY_MINUTE
+// or TICK_NONE
+static RTC_DATA_ATTR int16_t programmedTick = TICK_EVERY_MINUTE;
+
 WatchyRTC::WatchyRTC() : rtc_ds(false) {}
 
 void WatchyRTC::init() {
+  if (detectedRtcType != 0) {
+    rtcType = detectedRtcType; // the chip cannot change across deep sleep
+    return;
+  }
   byte error;
   Wire.beginTransmission(RTC_DS_ADDR);
   error = Wire.endTransmission();
@@ -15,8 +26,10 @@ void WatchyRTC::init() {
       rtcType = PCF8563;
     } else {
       // RTC Error
+      return;
     }
   }
+  detectedRtcType = rtcType;
 }
 
 void WatchyRTC::config(
@@ -28,19 +41,132 @@ void WatchyRTC::config(
   }
 }
 
-void WatchyRTC::clearAlarm() {
+void WatchyRTC::clearAlarm(uint32_t wakeBy) {
+  // every minute also covers any wakeBy
+  bool everyMinute =
+      schedule.interval == 1 && schedule.quietFrom == schedule.quietTo;
+  int16_t tick = TICK_EVERY_MINUTE;
+  tmElements_t tm;
+  if (!everyMinute || rtcType != DS3231) {
+    read(tm);
+  }
+  if (!everyMinute) {
+    tick           = nextTick(tm);
+    uint32_t now   = makeTime(tm);
+    uint32_t today = now - now % SECS_PER_DAY;
+    uint32_t at    = today + tick * SECS_PER_MIN;
+    if (at <= now) {
+      at += SECS_PER_DAY;
+    }
+    if (wakeBy != 0 && (tick == TICK_NONE || wakeBy < at)) {
+      wakeBy = max(wakeBy, now + 1);
+      tick   = (wakeBy + SECS_PER_MIN - 1) % SECS_PER_DAY / SECS_PER_MIN;
+    }
+  }
   if (rtcType == DS3231) {
-    rtc_ds.alarm(DS3232RTC::ALARM_2);
+    rtc_ds.alarm(DS3232RTC::ALARM_2); // resets the alarm flag in the RTC
+    if (tick == programmedTick) {
+      return;
+    }
+    if (tick == TICK_NONE) {
+      rtc_ds.alarmInterrupt(DS3232RTC::ALARM_2, false);
+    } else {
+      if (tick == TICK_EVERY_MINUTE) {
+        rtc_ds.setAlarm(DS3232RTC::ALM2_EVERY_MINUTE, 0, 0, 0, 0);
+      } else {
+        rtc_ds.setAlarm(DS3232RTC::ALM2_MATCH_HOURS, 0, tick % 60, tick / 60,
+                        0);
+      }
+      if (programmedTick == TICK_NONE) {
+        rtc_ds.alarmInterrupt(DS3232RTC::ALARM_2, true);
+      }
+    }
   } else {
-    int nextAlarmMinute = 0;
-    rtc_pcf.clearAlarm(); // resets the alarm flag in the RTC
-    nextAlarmMinute = rtc_pcf.getMinute();
-    nextAlarmMinute =
-        (nextAlarmMinute == 59)
-            ? 0
-            : (nextAlarmMinute + 1); // set alarm to trigger 1 minute from now
-    rtc_pcf.setAlarm(nextAlarmMinute, 99, 99, 99);
+    if (tick == TICK_NONE) {
+      rtc_pcf.resetAlarm(); // clears the flag and disables the interrupt
+    } else {
+      // setAlarm() also resets the alarm flag
+      if (tick == TICK_EVERY_MINUTE) {
+        rtc_pcf.setAlarm((tm.Minute + 1) % 60, 99, 99, 99);
+      } else {
+        rtc_pcf.setAlarm(tick % 60, tick / 60, 99, 99);
+      }
+    }
+  }
+  programmedTick = tick;
+}
+
+void WatchyRTC::setTickInterval(uint16_t minutes) {
+  schedule.interval = minutes;
+}
+
+void WatchyRTC::setQuietHours(uint8_t from, uint8_t to) {
+  schedule.quietFrom = from;
+  schedule.quietTo   = to;
+}
+
+bool WatchyRTC::addTickTime(uint8_t hour, uint8_t minute) {
+  if (schedule.times == MAX_TICK_TIMES || hour > 23 || minute > 59) {
+    return false;
+  }
+  schedule.time[schedule.times++] = hour * 60 + minute;
+  return true;
+}
+
+void WatchyRTC::clearTickTimes() { schedule.times = 0; }
+
+void WatchyRTC::setPrewake(uint16_t ms) {
+  schedule.prewake = min(ms, (uint16_t)30000);
+}
+
+uint16_t WatchyRTC::getPrewake() { return schedule.prewake; }
+
+uint64_t WatchyRTC::untilPrewake(const tmElements_t &tm, uint32_t intoSecond) {
+  int16_t tick = nextTick(tm);
+  if (schedule.prewake == 0 || tick == TICK_NONE) {
+    return 0;
+  }
+  int32_t minutes = (tick - (tm.Hour * 60 + tm.Minute) + 24 * 60) % (24 * 60);
+  if (minutes == 0) {
+    minutes = 24 * 60; // the same minute tomorrow
+  }
+  int64_t us = ((int64_t)minutes * SECS_PER_MIN - tm.Second) * 1000000 -
+               intoSecond - (schedule.prewake + ENERGY_BOOT_MS) * 1000LL;
+  return us > 0 ? us : 0;
+}
+
+int16_t WatchyRTC::nextTick(const tmElements_t &tm) {
+  uint16_t now = tm.Hour * 60 + tm.Minute;
+  for (uint16_t i = 1; i <= 24 * 60; i++) {
+    uint16_t minute = (now + i) % (24 * 60);
+    if (_isTick(minute)) {
+      return minute;
+    }
+  }
+  return TICK_NONE;
+}
+
+bool WatchyRTC::isTick(const tmElements_t &tm) {
+  return _isTick(tm.Hour * 60 + tm.Minute);
+}
+
+bool WatchyRTC::_isTick(uint16_t minute) {
+  for (uint8_t i = 0; i < schedule.times; i++) {
+    if (schedule.time[i] == minute) {
+      return true;
+    }
+  }
+  if (schedule.interval == 0 || minute % schedule.interval != 0) {
+    return false;
+  }
+  uint8_t hour = minute / 60;
+  if (schedule.quietFrom < schedule.quietTo) {
+    return hour < schedule.quietFrom || hour >= schedule.quietTo;
+  }
+  if (schedule.quietFrom > schedule.quietTo) { // over midnight
+    return hour < schedule.quietFrom && hour >= schedule.quietTo;
   }
+  return true;
 }
 
 void WatchyRTC::read(tmElements_t &tm) {
@@ -105,6 +231,8 @@ void WatchyRTC::_DSConfig(
   rtc_ds.setAlarm(DS3232RTC::ALM2_EVERY_MINUTE, 0, 0, 0,
                   0); // alarm wakes up Watchy every minute
   rtc_ds.alarmInterrupt(DS3232RTC::ALARM_2, true); // enable alarm interrupt
+  programmedTick = TICK_EVERY_MINUTE;
+  clearAlarm(); // for a schedule other than every minute
 }
 
 void WatchyRTC::_PCFConfig(
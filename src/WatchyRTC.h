@@ -12,6 +12,22 @@
 #define RTC_PCF_ADDR    0x51
 #define YEAR_OFFSET_DS  1970
 #define YEAR_OFFSET_PCF 2000
+#define TICK_NONE       -1 // nextTick(): nothing scheduled
+#define TICK_EVERY_MINUTE -2
+
+// When the RTC alarm wakes the watch, kept in RTC memory. Periodic ticks fall
+// on multiples of interval minutes since midnight and are skipped during
+// quiet hours, the fixed times always fire. With prewake the watch wakes
+// ahead of each tick to have it drawn when the RTC alarm marks the minute,
+// see Watchy::deepSleep().
+typedef struct tickSchedule {
+  uint16_t interval; // minutes, 0: no periodic ticks
+  uint8_t quietFrom; // hours, quietFrom == quietTo: no quiet hours
+  uint8_t quietTo;
+  uint8_t times;
+  uint16_t time[MAX_TICK_TIMES]; // minutes since midnight
+  uint16_t prewake;              // ms, 0: wake on the tick
+} tickSchedule;
 
 class WatchyRTC {
 public:
@@ -23,7 +39,29 @@ public:
   WatchyRTC();
   void init();
   void config(String datetime); // String datetime format is YYYY:MM:DD:HH:MM:SS
-  void clearAlarm();
+  // Clears the alarm flag and programs the alarm for the next tick, or for
+  // `wakeBy` (RTC time, rounded up to the minute) if that comes first. The
+  // alarm reaches at most a day ahead.
+  void clearAlarm(uint32_t wakeBy = 0);
+  // Wake cadence: every `minutes` (1 by default, 60 for hourly), no periodic
+  // ticks between the hours `from` and `to`, and wakes at fixed times. Takes
+  // effect at the next clearAlarm(), i.e. when the watch goes to sleep.
+  void setTickInterval(uint16_t minutes);
+  void setQuietHours(uint8_t from, uint8_t to);
+  bool addTickTime(uint8_t hour, uint8_t minute);
+  void clearTickTimes();
+  // Wakes `ms` (up to 30 s, PREWAKE_MS by default) before each tick, 0: on
+  // it
+  void setPrewake(uint16_t ms);
+  uint16_t getPrewake();
+  // Microseconds from `tm`, `intoSecond` microseconds into its second, to
+  // the prewake ahead of the next tick and ENERGY_BOOT_MS before that. 0 if
+  // prewaking is off or the tick is too close.
+  uint64_t untilPrewake(const tmElements_t &tm, uint32_t intoSecond);
+  // minutes since midnight of the first tick after `tm`, or TICK_NONE
+  int16_t nextTick(const tmElements_t &tm);
+  // whether the minute of `tm` is a tick
+  bool isTick(const tmElements_t &tm);
   void read(tmElements_t &tm);
   void set(tmElements_t tm);
   uint8_t temperature();
@@ -31,6 +69,7 @@ public:
 private:
   void _DSConfig(String datetime);
   void _PCFConfig(String datetime);
+  bool _isTick(uint16_t minute);
   int _getDayOfWeek(int d, int m, int y);
   String _getValue(String data, char separator, int index);
 };
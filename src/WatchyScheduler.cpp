@@ -0,0 +1,108 @@
+#include "WatchyScheduler.h"
+
+static RTC_DATA_ATTR scheduledJob jobs[MAX_JOBS];
+static RTC_DATA_ATTR uint8_t jobCount;
+
+bool WatchyScheduler::schedule(uint8_t job, uint32_t deadline,
+                               uint32_t period, bool wake) {
+  int8_t i = _find(job);
+  if (i < 0) {
+    if (jobCount == MAX_JOBS) {
+      return false;
+    }
+    i = jobCount++;
+  }
+  jobs[i].deadline = deadline;
+  jobs[i].period   = period;
+  jobs[i].job      = job;
+  jobs[i].wake     = wake;
+  _siftUp(i);
+  _siftDown(i);
+  return true;
+}
+
+void WatchyScheduler::cancel(uint8_t job) {
+  int8_t i = _find(job);
+  if (i >= 0) {
+    _remove(i);
+  }
+}
+
+bool WatchyScheduler::scheduled(uint8_t job) { return _find(job) >= 0; }
+
+int16_t WatchyScheduler::nextDue(uint32_t now) {
+  if (jobCount == 0 || jobs[0].deadline > now) {
+    return NO_JOB;
+  }
+  uint8_t job = jobs[0].job;
+  if (jobs[0].period == 0) {
+    _remove(0);
+  } else {
+    uint32_t late = now - jobs[0].deadline;
+    jobs[0].deadline += (late / jobs[0].period + 1) * jobs[0].period;
+    _siftDown(0);
+  }
+  return job;
+}
+
+uint32_t WatchyScheduler::nextDeadline() {
+  uint32_t deadline = 0;
+  for (uint8_t i = 0; i < jobCount; i++) {
+    if (jobs[i].wake && (deadline == 0 || jobs[i].deadline < deadline)) {
+      deadline = jobs[i].deadline;
+    }
+  }
+  return deadline;
+}
+
+void WatchyScheduler::clear() { jobCount = 0; }
+
+int8_t WatchyScheduler::_find(uint8_t job) {
+  for (uint8_t i = 0; i < jobCount; i++) {
+    if (jobs[i].job == job) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void WatchyScheduler::_siftUp(uint8_t i) {
+  while (i > 0) {
+    uint8_t parent = (i - 1) / 2;
+    if (jobs[parent].deadline <= jobs[i].deadline) {
+      return;
+    }
+    scheduledJob t = jobs[parent];
+    jobs[parent]   = jobs[i];
+    jobs[i]        = t;
+    i              = parent;
+  }
+}
+
+void WatchyScheduler::_siftDown(uint8_t i) {
+  while (true) {
+    uint8_t smallest = i;
+    uint8_t left = 2 * i + 1, right = 2 * i + 2;
+    if (left < jobCount && jobs[left].deadline < jobs[smallest].deadline) {
+      smallest = left;
+    }
+    if (right < jobCount && jobs[right].deadline < jobs[smallest].deadline) {
+      smallest = right;
+    }
+    if (smallest == i) {
+      return;
+    }
+    scheduledJob t = jobs[smallest];
+    jobs[smallest] = jobs[i];
+    jobs[i]        = t;
+    i              = smallest;
+  }
+}
+
+void WatchyScheduler::_remove(uint8_t i) {
+  jobs[i] = jobs[--jobCount];
+  if (i < jobCount) {
+    _siftUp(i);
+    _siftDown(i);
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef WATCHY_SCHEDULER_H
+#define WATCHY_SCHEDULER_H
+
+#include <Arduino.h>
+
+#include "config.h"
+
+#define NO_JOB -1
+
+// Timed jobs kept in RTC memory: a min-heap of MAX_JOBS deadlines in RTC
+// time (seconds, as makeTime() of WatchyRTC::read()). Watchy runs the due
+// ones on each RTC wake and sets the next alarm no later than the earliest
+// deadline. A job that is found late runs once, then its next deadline is
+// the first period boundary after now, so skipped wakes are caught up
+// without running a job several times in a row. A job that does not wake
+// the watch runs on the first wake at or after its deadline.
+typedef struct scheduledJob {
+  uint32_t deadline;
+  uint32_t period; // seconds, 0: runs once
+  uint8_t job;
+  bool wake; // its deadline sets the RTC alarm
+} scheduledJob;
+
+class WatchyScheduler {
+public:
+  // Adds the job, or moves it if it is already scheduled
+  static bool schedule(uint8_t job, uint32_t deadline, uint32_t period = 0,
+                       bool wake = true);
+  static void cancel(uint8_t job);
+  static bool scheduled(uint8_t job);
+  // Removes the earliest job due at `now` and queues its next run. Returns
+  // the job, or NO_JOB if nothing is due.
+  static int16_t nextDue(uint32_t now);
+  // Earliest deadline of the jobs that wake the watch, 0 if there are none
+  static uint32_t nextDeadline();
+  static void clear();
+
+private:
+  static int8_t _find(uint8_t job);
+  static void _siftUp(uint8_t i);
+  static void _siftDown(uint8_t i);
+  static void _remove(uint8_t i);
+};
+
+#endif
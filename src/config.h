@@ -55,7 +55,17 @@
 #define APP_STATE       1
 #define FW_UPDATE_STATE 2
 #define MENU_HEIGHT     25
-#define MENU_LENGTH     7
+#define MENU_ROWS       7 // per page
+#define MAX_APPS        16
+// the menu's rows, its entries before apps could be added: Watchy::appCount
+#define MENU_LENGTH MENU_ROWS
+// button session, see Watchy::waitButton()
+#define SESSION_TIMEOUT_MS  5000  // idle time in the menu before deep sleep
+#define APP_IDLE_TIMEOUT_MS 60000 // idle time in Set Time / Accelerometer
+#define DEBOUNCE_MS         20
+#define LONG_PRESS_MS       600
+#define REPEAT_MS           150
+#define SET_TIME_BLINK_MS   500
 // set time
 #define SET_HOUR   0
 #define SET_MINUTE 1
@@ -71,6 +81,54 @@
 #define SOFTWARE_VERSION_PATCH 0
 #define HARDWARE_VERSION_MAJOR 1
 #define HARDWARE_VERSION_MINOR 0
+// RTC wake cadence, see WatchyRTC::setTickInterval()
+#define TICK_INTERVAL    1 // minutes between watch face updates
+#define QUIET_HOURS_FROM 0 // no periodic ticks from this hour...
+#define QUIET_HOURS_TO   0 // ...up to this one, equal: no quiet hours
+#define MAX_TICK_TIMES   4
+#define PREWAKE_MS       0 // wake this long before a tick to draw it, 0: on the tick
+// scheduled jobs, see Watchy::runJob()
+#define MAX_JOBS          8
+#define JOB_WEATHER       0
+#define JOB_NTP_SYNC      1
+#define JOB_STEP_RESET    2
+#define JOB_USER          16 // first id for a watch face's own jobs
+#define NTP_SYNC_INTERVAL 0  // hours, 0: only from the menu
+// wake profiler
+#define PROFILE_DEPTH 8 // wakes kept in RTC memory, 48 bytes each
+// last displayed frame, packed in RTC memory across deep sleep. The example
+// faces' frames pack into 3922 bytes at most, a frame that does not fit is
+// sent whole on the next wake.
+#define FRAME_STORE_SIZE 3968
+// a watch face's static layer, LZ packed in what RTC memory is left. The
+// example faces' layers take 976 bytes at most.
+#define LAYER_STORE_SIZE 1024
+// refresh policy, see WatchyDisplay::refresh()
+#define REFRESH_MAX_PIXELS   100000 // flipped by partial refreshes, then a full one
+#define REFRESH_MAX_PARTIALS 0      // partial refreshes before a full one, 0: no limit
+#define REFRESH_CLEAN_HOUR   3      // daily full refresh from this hour, NO_CLEAN_HOUR: none
+// refreshes nominally this long or longer finish while the ESP32 deep sleeps,
+// 0: none. The break-even of the energy model below: a follow-up boot costs
+// what light sleep would through this much of a waveform.
+#define REFRESH_ASYNC_MS                                                       \
+  (uint16_t)(ENERGY_BOOT_MS * ENERGY_ACTIVE_MA /                               \
+             (ENERGY_LIGHT_SLEEP_MA - ENERGY_DEEP_SLEEP_MA))
+// text bounds memoised by WatchyDisplay::measureText() in RTC memory, for
+// strings shorter than TEXT_BOUNDS_LENGTH
+#define TEXT_BOUNDS_CACHE  8
+#define TEXT_BOUNDS_LENGTH 16
+// energy model: typical currents in mA, see WatchyEnergy.h
+#define ENERGY_ACTIVE_MA          40.0f // CPU at 240 MHz, radios off
+#define ENERGY_LIGHT_SLEEP_MA     0.8f  // light sleep while the panel is BUSY
+#define ENERGY_DEEP_SLEEP_MA      0.06f // whole watch asleep
+#define ENERGY_WIFI_MA            120.0f
+#define ENERGY_BLE_MA             100.0f
+#define ENERGY_FULL_REFRESH_MA    4.0f // panel, for ENERGY_FULL_REFRESH_MS
+#define ENERGY_FULL_REFRESH_MS    2600
+#define ENERGY_PARTIAL_REFRESH_MA 3.0f
+#define ENERGY_PARTIAL_REFRESH_MS 500
+#define ENERGY_BOOT_MS            250 // wake to setup(), not seen by micros()
+#define BATTERY_MAH               200.0f
 // Versioning
 #define WATCHY_LIB_VER "1.4.0"
 #endif